@@ -8,9 +8,16 @@ set(CMAKE_CXX_STANDARD 20)
 set(CMAKE_CXX_STANDARD_REQUIRED ON)
 set(CMAKE_CXX_EXTENSIONS OFF)
 
+set(MACADEMY_CPU_VECTOR_EXTENSION "AVX" CACHE STRING "Vector instruction set used by the CPU backend on x86: AVX, AVX2 or AVX512")
+set_property(CACHE MACADEMY_CPU_VECTOR_EXTENSION PROPERTY STRINGS AVX AVX2 AVX512)
+
 if (CMAKE_CXX_COMPILER_ID MATCHES "GNU" OR CMAKE_CXX_COMPILER_ID MATCHES "Clang")
     if (CMAKE_HOST_SYSTEM_PROCESSOR MATCHES "aarch64")
         set(COMPILER_FLAG_VECTOR_EXTENSIONS "") #NEON is enabled on arm64
+    elseif (MACADEMY_CPU_VECTOR_EXTENSION STREQUAL "AVX512")
+        set(COMPILER_FLAG_VECTOR_EXTENSIONS -mavx512f -mavx2 -mfma)
+    elseif (MACADEMY_CPU_VECTOR_EXTENSION STREQUAL "AVX2")
+        set(COMPILER_FLAG_VECTOR_EXTENSIONS -mavx2 -mfma)
     else()
         set(COMPILER_FLAG_VECTOR_EXTENSIONS "-mavx")
     endif()
@@ -18,7 +25,13 @@ endif()
 
 
 if (CMAKE_CXX_COMPILER_ID MATCHES "MSVC")
-    set(COMPILER_FLAG_VECTOR_EXTENSIONS "/arch:AVX")
+    if (MACADEMY_CPU_VECTOR_EXTENSION STREQUAL "AVX512")
+        set(COMPILER_FLAG_VECTOR_EXTENSIONS "/arch:AVX512")
+    elseif (MACADEMY_CPU_VECTOR_EXTENSION STREQUAL "AVX2")
+        set(COMPILER_FLAG_VECTOR_EXTENSIONS "/arch:AVX2")
+    else()
+        set(COMPILER_FLAG_VECTOR_EXTENSIONS "/arch:AVX")
+    endif()
 endif()
 
 add_compile_options(${COMPILER_FLAG_VECTOR_EXTENSIONS})
\ No newline at end of file
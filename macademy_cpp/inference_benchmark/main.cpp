@@ -0,0 +1,139 @@
+#include "network.h"
+#include "default_weight_initializer.h"
+#include "i_compute_device.h"
+#include "compute_device_factory.h"
+#include "compute_tasks.h"
+#include "inference_server.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace macademy;
+
+namespace {
+struct BenchmarkConfig
+{
+    uint32_t m_device_index = 0;
+    uint32_t m_client_count = 16;
+    uint32_t m_requests_per_client = 500;
+    InferenceServerConfig m_server_config{};
+};
+
+void PrintUsage()
+{
+    std::cout << "Usage: inference_benchmark [--device index] [--clients count] [--requests count per client] [--max_batch size] [--max_wait microseconds] [--workers count]"
+              << std::endl;
+}
+
+std::vector<float> CreateInput(uint32_t input_count, uint32_t seed)
+{
+    std::vector<float> ret;
+    ret.reserve(input_count);
+    for (uint32_t i = 0; i < input_count; ++i) {
+        ret.emplace_back(float((i * 7919u + seed * 104729u) % 256u) / 255.0f);
+    }
+    return ret;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    BenchmarkConfig config;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            PrintUsage();
+            return 1;
+        }
+        const uint32_t value = uint32_t(std::stoul(argv[++i]));
+        if (arg == "--device") {
+            config.m_device_index = value;
+        } else if (arg == "--clients") {
+            config.m_client_count = value;
+        } else if (arg == "--requests") {
+            config.m_requests_per_client = value;
+        } else if (arg == "--max_batch") {
+            config.m_server_config.m_max_batch_size = value;
+        } else if (arg == "--max_wait") {
+            config.m_server_config.m_max_wait_time = std::chrono::microseconds(value);
+        } else if (arg == "--workers") {
+            config.m_server_config.m_worker_count = value;
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    const auto devices = ComputeDeviceFactory::EnumerateComputeDevices();
+    if (config.m_device_index >= devices.size()) {
+        std::cout << "Invalid device index! Available devices:" << std::endl;
+        for (size_t i = 0; i < devices.size(); ++i) {
+            std::cout << "  #" << i << " - " << devices[i].m_device_name << std::endl;
+        }
+        return 1;
+    }
+
+    auto compute_device = ComputeDeviceFactory::CreateComputeDevice(devices[config.m_device_index]);
+    std::cout << "Device: " << compute_device->GetDeviceName() << std::endl;
+
+    // Same topology as the MNIST digit recognizer
+    std::vector<LayerConfig> layers;
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::ReLU, .m_num_neurons = 128});
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = 10});
+    auto network = BuildSequentialNetwork("inference_benchmark", 28 * 28, layers, XavierWeightInitializer{});
+
+    NetworkResourceHandle network_resources(*network, *compute_device);
+    network_resources.PrepareForInference();
+    ComputeTasks compute_tasks;
+
+    const uint64_t total_requests = uint64_t(config.m_client_count) * config.m_requests_per_client;
+
+    // Baseline: the same requests evaluated one by one from a single thread
+    {
+        std::vector<float> output(network->GetOutputCount());
+        const auto start = std::chrono::steady_clock::now();
+        for (uint32_t c = 0; c < config.m_client_count; ++c) {
+            const auto input = CreateInput(network->GetInputCount(), c);
+            for (uint32_t r = 0; r < config.m_requests_per_client; ++r) {
+                compute_tasks.Evaluate(network_resources, input, output);
+            }
+        }
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "One by one: " << uint64_t(total_requests / elapsed) << " requests/s" << std::endl;
+    }
+
+    InferenceServer server(network_resources, config.m_server_config);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> clients;
+    for (uint32_t c = 0; c < config.m_client_count; ++c) {
+        clients.emplace_back([&, c]() {
+            const auto input = CreateInput(network->GetInputCount(), c);
+            for (uint32_t r = 0; r < config.m_requests_per_client; ++r) {
+                server.Submit(input).get();
+            }
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const auto statistics = server.GetStatistics();
+
+    std::cout << "Batched with " << config.m_client_count << " clients: " << uint64_t(total_requests / elapsed) << " requests/s" << std::endl;
+    std::cout << "  Batches: " << statistics.m_batch_count << ", mean batch size: " << double(statistics.m_request_count) / double(std::max<uint64_t>(statistics.m_batch_count, 1))
+              << std::endl;
+    std::cout << "  Latency p50: " << statistics.m_latency_p50.count() << "us, p90: " << statistics.m_latency_p90.count() << "us, p99: " << statistics.m_latency_p99.count()
+              << "us, max: " << statistics.m_latency_max.count() << "us" << std::endl;
+    std::cout << "  Batch size histogram:" << std::endl;
+    for (size_t i = 0; i < statistics.m_batch_size_histogram.size(); ++i) {
+        if (statistics.m_batch_size_histogram[i] > 0) {
+            std::cout << "    " << i << ": " << statistics.m_batch_size_histogram[i] << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -30,12 +30,21 @@ enum class ActivationFunction
     Threshold, //> Also known as 'Step' or 'Binary step'
     SoftPlus,
     ArcTan,
+    Softmax, //> Normalizes the outputs of the layer into a probability distribution. Only supported on the output layer for training.
 };
 
+// The derivative of the other activation functions is calculated from their output, so the training
+// only stores the z values of layers using these activation functions for the backward pass
+constexpr bool ActivationFunctionUsesZValues(ActivationFunction activation_function)
+{
+    return activation_function == ActivationFunction::SoftPlus || activation_function == ActivationFunction::ArcTan;
+}
+
 enum class CostFunction
 {
     MeanSquared,
-    CrossEntropy_Sigmoid
+    CrossEntropy_Sigmoid,
+    CrossEntropy_Softmax //> Categorical cross-entropy, requires a Softmax output layer
 };
 
 enum class Regularization
@@ -45,12 +54,45 @@ enum class Regularization
     L2
 };
 
+enum class Optimizer
+{
+    SGD,      //> Plain (stochastic) gradient descent
+    Momentum, //> Gradient descent with (heavy ball) momentum
+    Nesterov, //> Gradient descent with Nesterov momentum
+    Adam,
+    AdamW, //> Adam with decoupled weight decay
+};
+
 enum class DType
 {
     Float16,
     Float32
 };
 
+// Rows of weights are padded to a multiple of this many elements (64 bytes of float32), so every row starts on a cache line and can be read with aligned vector loads
+constexpr uint32_t DENSE_ROW_ALIGNMENT = 16;
+
+// Memory layout of the weights and biases of a dense layer: a [neuron][row stride] weight matrix with zero padding at the end of each row, followed by the bias vector.
+// The kernels of every backend derive the same layout from the neuron and weight counts.
+struct DenseLayout
+{
+    uint32_t m_num_neurons = 0;
+    uint32_t m_weights_per_neuron = 0;
+
+    static constexpr uint32_t GetRowStride(uint32_t weights_per_neuron) { return (weights_per_neuron + DENSE_ROW_ALIGNMENT - 1) / DENSE_ROW_ALIGNMENT * DENSE_ROW_ALIGNMENT; }
+
+    constexpr uint32_t GetRowStride() const { return GetRowStride(m_weights_per_neuron); }
+    constexpr uint32_t GetWeightIndex(uint32_t neuron_id, uint32_t weight_id) const { return neuron_id * GetRowStride() + weight_id; }
+    constexpr uint32_t GetBiasOffset() const { return m_num_neurons * GetRowStride(); }
+    constexpr uint32_t GetBiasIndex(uint32_t neuron_id) const { return GetBiasOffset() + neuron_id; }
+    constexpr uint32_t GetElementCount() const { return GetBiasOffset() + m_num_neurons; }
+    // Tensors stored after each other, like the members of a population, start at multiples of this, so every tensor is aligned like its rows
+    constexpr uint32_t GetTensorStride() const { return (GetElementCount() + DENSE_ROW_ALIGNMENT - 1) / DENSE_ROW_ALIGNMENT * DENSE_ROW_ALIGNMENT; }
+
+    constexpr bool IsBias(uint32_t element_id) const { return element_id >= GetBiasOffset(); }
+    constexpr bool IsPadding(uint32_t element_id) const { return !IsBias(element_id) && element_id % GetRowStride() >= m_weights_per_neuron; }
+};
+
 struct TrainingResultTracker
 {
     std::atomic<float> m_epoch_progress = 0;
@@ -76,6 +118,14 @@ inline int GetIntFromJson(const nlohmann::json& json_struct, const std::string&
     return default_value;
 }
 
+inline std::string GetStringFromJson(const nlohmann::json& json_struct, const std::string& param_name, const std::string& default_value)
+{
+    if (json_struct.contains(param_name) && json_struct[param_name].is_string()) {
+        return json_struct[param_name].get<std::string>();
+    }
+    return default_value;
+}
+
 } // namespace macademy
 
 #define ASSERTM(x, msg)                                                                                                                                                                                \
@@ -4,6 +4,10 @@
 #include <memory>
 #include <string>
 #include <variant>
+#include <optional>
+#include <utility>
+#include <mutex>
+#include "training_memory_plan.h"
 
 namespace macademy {
 class Network;
@@ -16,51 +20,142 @@ struct UniformDistribution
     float range;
 };
 
+struct GaussianDistribution
+{
+    float sigma;
+};
+
 /// <summary>
-/// A class representing an opaque handle to a neural network compiled for a specific device
+/// A class representing an opaque handle to a neural network compiled for a specific device.
+/// Evaluation only reads the weights and uses scratch buffers from a pool, so multiple threads can evaluate the same handle concurrently.
+/// Training and mutation modify the weights and must not run concurrently with any other task on the same handle.
 /// </summary>
 struct NetworkResourceHandle
 {
-    NetworkResourceHandle(Network& network, IComputeDevice& compute_device);
+    struct EvaluationBuffers
+    {
+        std::unique_ptr<IBuffer> m_layer_result_buffer_a;
+        std::unique_ptr<IBuffer> m_layer_result_buffer_b;
+    };
+
+    // With use_arena, the weights of all layers are stored in a single device buffer, and so are the gradients and the optimizer moments.
+    // The per-layer buffers are views of the arena, so the whole network is uploaded, read back or cleared with a single transfer.
+    NetworkResourceHandle(Network& network, IComputeDevice& compute_device, bool use_arena = false);
 
     void SynchronizeNetworkData();
 
-    void AllocateTrainingResources(uint32_t training_sample_count);
-    void AllocateBatchEvalResources() const;
-    void AllocateMutationBuffer();
+    // Converts the weights into the layout the device evaluates fastest, if it has one (e.g. the panel layout of the CPU), returns false if the device has none.
+    // If the weights were converted, the handle can only be evaluated afterwards, training and mutation throw, and SynchronizeNetworkData has nothing to read back.
+    bool PrepareForInference();
+    bool IsPreparedForInference() const { return m_is_prepared_for_inference; }
+
+    // Allocates the buffers of the training memory plan, throws if the plan doesn't fit into the memory of the device
+    void AllocateTrainingResources(uint32_t training_sample_count, Optimizer optimizer = Optimizer::SGD, uint32_t checkpoint_interval = 0);
+    // Allocates the training resources for a micro-batch of the training suite, or a whole minibatch if micro-batches are not used
+    void AllocateTrainingResources(const TrainingSuite& training_suite);
+    void AllocateOptimizerResources(const TrainingSuite& training_suite);
+
+    EvaluationBuffers AcquireEvaluationBuffers(uint32_t batch_size = 1) const;
+    void ReleaseEvaluationBuffers(EvaluationBuffers&& evaluation_buffers) const;
 
     void FreeCachedResources();
 
     IComputeDevice* GetComputeDevice() { return m_compute_device; }
 
+    const TrainingMemoryPlan& GetTrainingMemoryPlan() const { return m_training_memory_plan; }
+    IBuffer* GetTrainingBuffer(TrainingBufferRole role, uint32_t layer_id = 0) const;
+
+    // Fills the buffers of every layer with zeros, with a single fill if they are views of an arena
+    void QueueClearLayerBuffers(std::unique_ptr<IBuffer>& arena, std::vector<std::unique_ptr<IBuffer>>& layer_buffers);
+
+    // Creates a buffer for each layer with the size of its tensor, the buffers are views of a new arena if the arena is used
+    void CreateLayerBuffers(std::unique_ptr<IBuffer>& arena, std::vector<std::unique_ptr<IBuffer>>& layer_buffers, const std::string& name);
+    void FreeLayerBuffers(std::unique_ptr<IBuffer>& arena, std::vector<std::unique_ptr<IBuffer>>& layer_buffers);
+
     IComputeDevice* const m_compute_device = nullptr;
     Network* const m_network = nullptr;
+    const bool m_use_arena = false;
+    bool m_is_prepared_for_inference = false;
+
+    std::vector<size_t> m_arena_offsets; // offset of the buffer of each layer in an arena, aligned for buffer views
+    size_t m_arena_size = 0;
 
+    // The arenas are declared before their views, so the views are destroyed first
+    std::unique_ptr<IBuffer> m_tensor_arena;
     std::vector<std::unique_ptr<IBuffer>> m_tensor_buffers;
-    mutable std::unique_ptr<IBuffer> m_layer_result_buffer_a;
-    mutable std::unique_ptr<IBuffer> m_layer_result_buffer_b;
 
-    std::unique_ptr<IBuffer> m_input_buffer;
-    std::unique_ptr<IBuffer> m_desired_output_buffer;
-    std::unique_ptr<IBuffer> m_delta_k_buffer_a;
-    std::unique_ptr<IBuffer> m_delta_k_buffer_b;
+    mutable std::mutex m_evaluation_buffers_mutex;
+    mutable std::vector<EvaluationBuffers> m_evaluation_buffers_pool;
+
+    TrainingMemoryPlan m_training_memory_plan;
+    std::vector<std::unique_ptr<IBuffer>> m_training_buffers; // physical buffers of the training memory plan
+    std::unique_ptr<IBuffer> m_gradient_arena;
     std::vector<std::unique_ptr<IBuffer>> m_gradient_buffers;
-    std::vector<std::unique_ptr<IBuffer>> m_activation_buffers;
-    std::vector<std::unique_ptr<IBuffer>> m_zvalue_buffers;
 
-    std::vector<std::unique_ptr<IBuffer>> m_mutation_buffers;
+    std::unique_ptr<IBuffer> m_moment1_arena;
+    std::vector<std::unique_ptr<IBuffer>> m_moment1_buffers;
+    std::unique_ptr<IBuffer> m_moment2_arena;
+    std::vector<std::unique_ptr<IBuffer>> m_moment2_buffers;
+    Optimizer m_moment_optimizer = Optimizer::SGD; // the optimizer the moments were accumulated by
+    uint64_t m_optimizer_step = 0;
+};
+
+/// <summary>
+/// A population of networks with the same topology for evolutionary algorithms. The weights of every member are stored
+/// in a single buffer per layer, so the whole population can be evaluated, mutated or recombined with one dispatch per layer.
+/// </summary>
+struct PopulationResourceHandle
+{
+    PopulationResourceHandle(const Network& network, uint32_t population_size, IComputeDevice& compute_device);
+
+    void ReadMember(uint32_t member_id, Network& network);
+    void WriteMember(uint32_t member_id, const Network& network);
+
+    void AllocateBatchEvalResources() const;
+
+    void FreeCachedResources();
+
+    IComputeDevice* const m_compute_device = nullptr;
+    const Network* const m_network = nullptr;
+    const uint32_t m_population_size = 0;
+
+    std::vector<std::unique_ptr<IBuffer>> m_tensor_buffers; // [member][weights and biases in the DenseLayout of the layer] for each layer
+    std::vector<std::unique_ptr<IBuffer>> m_next_generation_tensor_buffers;
+    std::unique_ptr<IBuffer> m_parent_ids_buffer;
+    mutable std::unique_ptr<IBuffer> m_layer_result_buffer_a;
+    mutable std::unique_ptr<IBuffer> m_layer_result_buffer_b;
 };
 
-using MutationDistribution = std::variant<UniformDistribution>;
+using MutationDistribution = std::variant<UniformDistribution, GaussianDistribution>;
 
 class ComputeTasks
 {
   public:
     std::vector<float> Evaluate(const NetworkResourceHandle& network, std::span<const float> input) const;
+    std::vector<float> EvaluateBatch(const NetworkResourceHandle& network, std::span<const float> inputs, uint32_t batch_size) const;
+
+    // Write the results into the output span instead of allocating them, for latency-critical callers
+    void Evaluate(const NetworkResourceHandle& network, std::span<const float> input, std::span<float> output) const;
+    void EvaluateBatch(const NetworkResourceHandle& network, std::span<const float> inputs, std::span<float> outputs, uint32_t batch_size) const;
+
+    void TrainMinibatch(NetworkResourceHandle& network, const TrainingSuite& training_suite, uint64_t trainingDataBegin, uint64_t trainingDataEnd,
+                        std::span<const uint64_t> training_data_order = {}) const;
+
+    // The two halves of TrainMinibatch, the accumulated gradient is left in the gradient buffers of the handle in between.
+    // The gradients are calculated in micro-batches of at most the sample count the training resources are allocated for.
+    void CalculateGradients(NetworkResourceHandle& network, const TrainingSuite& training_suite, uint64_t trainingDataBegin, uint64_t trainingDataEnd,
+                            std::span<const uint64_t> training_data_order = {}) const;
+    void ApplyGradients(NetworkResourceHandle& network, const TrainingSuite& training_suite, uint32_t num_training_samples) const;
+
+    void ApplyRandomMutation(NetworkResourceHandle& network_handle, MutationDistribution weight_mutation_distribution, MutationDistribution bias_mutation_distribution,
+                             std::optional<uint64_t> seed = {});
+
+    std::vector<float> EvaluatePopulation(const PopulationResourceHandle& population, std::span<const float> inputs) const;
 
-    void TrainMinibatch(NetworkResourceHandle& network, const TrainingSuite& training_suite, uint64_t trainingDataBegin, uint64_t trainingDataEnd) const;
+    void ApplyRandomMutation(PopulationResourceHandle& population, MutationDistribution weight_mutation_distribution, MutationDistribution bias_mutation_distribution,
+                             std::optional<uint64_t> seed = {});
 
-    void ApplyRandomMutation(NetworkResourceHandle& network_handle, MutationDistribution weight_mutation_distribution, MutationDistribution bias_mutation_distribution);
+    void Crossover(PopulationResourceHandle& population, std::span<const std::pair<uint32_t, uint32_t>> parents, std::optional<uint64_t> seed = {});
 };
 
 } // namespace macademy
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace macademy {
+
+struct CPUAllocationStatistics
+{
+    uint64_t m_allocation_count = 0;        // blocks handed out
+    uint64_t m_pool_hit_count = 0;          // blocks reused from the pool instead of allocated from the system
+    uint64_t m_system_allocation_count = 0; // blocks allocated from the system
+    size_t m_bytes_in_use = 0;              // capacity of the blocks in use
+    size_t m_peak_bytes_in_use = 0;
+    size_t m_bytes_cached = 0; // capacity of the freed blocks kept for reuse
+};
+
+/// <summary>
+/// Allocator of the CPU buffers. Sizes are rounded up to size classes, and freed blocks are kept in a pool per size class, so the buffers that are
+/// allocated and freed around every training run are reused instead of being returned to the system. The memory is not zeroed, blocks are aligned
+/// to a cache line, and large blocks are aligned to huge pages and marked as eligible for transparent huge pages on Linux.
+/// </summary>
+class CPUBufferAllocator
+{
+  public:
+    static constexpr size_t ALIGNMENT = 64;
+    static constexpr size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+    static constexpr size_t HUGE_PAGE_MIN_SIZE = 4 * HUGE_PAGE_SIZE; // the size classes from here on are multiples of the huge page size
+
+    // Freed blocks are returned to the system instead of the pool once the pool would exceed max_cached_bytes
+    CPUBufferAllocator(bool use_huge_pages, size_t max_cached_bytes);
+    ~CPUBufferAllocator();
+
+    CPUBufferAllocator(const CPUBufferAllocator&) = delete;
+    CPUBufferAllocator& operator=(const CPUBufferAllocator&) = delete;
+
+    // Returns a block of at least size bytes, its capacity is written into capacity. The contents of the block are undefined.
+    uint8_t* Allocate(size_t size, size_t& capacity);
+    void Free(uint8_t* block, size_t capacity);
+
+    // Returns the cached blocks to the system
+    void ReleaseCachedMemory();
+
+    CPUAllocationStatistics GetStatistics() const;
+
+    // Sizes up to 4 KiB are rounded to a power of two, larger ones to a quarter of a power of two, which wastes at most 25%
+    static size_t GetSizeClass(size_t size);
+
+  private:
+    uint8_t* AllocateFromSystem(size_t capacity);
+    static void FreeToSystem(uint8_t* block);
+
+    const bool m_use_huge_pages = false;
+    const size_t m_max_cached_bytes = 0;
+
+    mutable std::mutex m_mutex;
+    std::map<size_t, std::vector<uint8_t*>> m_free_blocks; // by capacity
+    CPUAllocationStatistics m_statistics;
+};
+
+} // namespace macademy
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "i_compute_device.h"
+#include "cpu_backend/cpu_buffer_allocator.h"
 
 #include <optional>
 
@@ -8,8 +9,31 @@ namespace macademy {
 
 class CPUBuffer : public IBuffer
 {
+    std::shared_ptr<CPUBufferAllocator> m_allocator; // null for views, the buffer keeps the allocator alive
+    size_t m_capacity = 0;
+    uint8_t* m_storage = nullptr;
+
   public:
-    std::vector<uint8_t> m_data;
+    std::span<uint8_t> m_data;
+    bool m_is_panel_packed = false; // the tensor was converted to the panel layout by PrepareTensorForInference
+
+    // The contents of the buffer are undefined
+    CPUBuffer(std::shared_ptr<CPUBufferAllocator> allocator, size_t size)
+        : m_allocator(std::move(allocator)), m_storage(m_allocator->Allocate(size, m_capacity)), m_data(m_storage, size)
+    {
+    }
+    // A view of a range of another buffer, the buffer must outlive the view
+    CPUBuffer(CPUBuffer& buffer, size_t offset, size_t size) : m_data(buffer.m_data.subspan(offset, size)) {}
+
+    ~CPUBuffer()
+    {
+        if (m_allocator) {
+            m_allocator->Free(m_storage, m_capacity);
+        }
+    }
+
+    CPUBuffer(const CPUBuffer&) = delete;
+    CPUBuffer& operator=(const CPUBuffer&) = delete;
 
     size_t GetSize() const override { return m_data.size(); }
 
@@ -20,30 +44,51 @@ class CPUBuffer : public IBuffer
 
 class CPUComputeDevice : public IComputeDevice
 {
+    std::shared_ptr<CPUBufferAllocator> m_allocator;
+
   public:
+    // Reads "use_huge_pages" (default true) and "buffer_pool_size_mb", the memory kept for reusing freed buffers (default 1024) from the device config
+    explicit CPUComputeDevice(const nlohmann::json& device_config = {});
+
+    // The contents of new buffers are undefined, buffers that need initial values are filled with QueueFillBuffer
     std::unique_ptr<IBuffer> CreateBuffer(size_t size, BufferUsage buffer_usage, const std::string& name);
+    std::unique_ptr<IBuffer> CreateBufferView(IBuffer* buffer, size_t offset, size_t size, const std::string& name) override;
+    size_t GetBufferViewAlignment() const override;
 
     void QueueWriteToBuffer(IBuffer* dst_buffer, std::span<const uint8_t> src, size_t buffer_offset) override;
     void QueueReadFromBuffer(IBuffer* src_buffer, std::span<uint8_t> dst, size_t buffer_offset) override;
     void QueueFillBuffer(IBuffer* buffer, uint32_t data, size_t offset, size_t size) override;
+    std::span<uint8_t> MapBuffer(IBuffer* buffer, BufferUsage access, size_t offset_bytes, size_t size_bytes) override;
+    void UnmapBuffer(IBuffer* buffer) override;
     void SubmitQueue() override;
     void WaitQueueIdle() override;
 
     void QueueEvaluateLayer(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function, uint32_t layer_input_count,
                             uint32_t layer_neuron_count) override;
+    void QueueEvaluateLayerBatched(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
+                                   uint32_t layer_input_count, uint32_t layer_neuron_count, uint32_t batch_size, uint32_t weights_batch_stride) override;
     void QueueTrainForwardPass(const IBuffer* tensor_buffer, const IBuffer* prev_activations, IBuffer* activations, IBuffer* zvalues, ActivationFunction activation_function,
                                uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t num_training_samples) override;
-    void QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* prev_activations_buffer, const IBuffer* layer_activations_buffer,
-                                const IBuffer* layer_zvalues_buffer, IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, IBuffer* current_layer_gradient_buffer,
-                                uint32_t layer_neuron_count, uint32_t weights_per_neuron, ActivationFunction activation_function, uint32_t num_training_samples, CostFunction costFunction,
-                                uint32_t next_layer_neuron_count) override;
-    void QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, float regularization_term_1, float regularization_term_2,
-                             float normalized_learning_rate) override;
+    void QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* layer_activations_buffer, const IBuffer* layer_zvalues_buffer,
+                                IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, uint32_t layer_neuron_count, ActivationFunction activation_function,
+                                uint32_t num_training_samples, CostFunction costFunction, uint32_t next_layer_neuron_count) override;
+    void QueueTrainCalculateGradient(const IBuffer* delta_k_vector_buffer, const IBuffer* prev_activations_buffer, IBuffer* current_layer_gradient_buffer, uint32_t layer_neuron_count,
+                                     uint32_t weights_per_neuron, uint32_t num_training_samples) override;
+    void QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, IBuffer* moment1_buffer, IBuffer* moment2_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron,
+                             const OptimizerParameters& optimizer_parameters) override;
+    bool PrepareTensorForInference(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron) override;
+    void QueueApplyMutation(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t tensor_count, const MutationParameters& mutation_parameters) override;
+    void QueueCrossover(const IBuffer* parents_tensor_buffer, IBuffer* children_tensor_buffer, const IBuffer* parent_ids_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron,
+                        uint32_t children_count, uint64_t seed, uint32_t stream) override;
 
     std::string GetDeviceName() const;
     size_t GetTotalMemory() const;
     bool SupportsWeightFormat(DType format) const;
 
+    CPUAllocationStatistics GetAllocationStatistics() const { return m_allocator->GetStatistics(); }
+    // Returns the memory of the freed buffers kept for reuse to the system
+    void ReleaseCachedMemory() { m_allocator->ReleaseCachedMemory(); }
+
     static ComputeDeviceInfo GetCpuComputeDeviceInfo();
 };
 
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX512F__) || defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace macademy::simd {
+
+// Thin wrappers of the float vector types of the instruction set selected at compile time (MACADEMY_CPU_VECTOR_EXTENSION), used by the math functions in cpu_simd_math.h.
+// ScalarFloat implements the same interface for a single value, so the scalar code paths use the same approximations as the vectorized ones.
+
+struct ScalarFloat
+{
+    static constexpr size_t width = 1;
+    using Mask = bool;
+
+    float m_value;
+
+    ScalarFloat() = default;
+    ScalarFloat(float value) : m_value(value) {}
+
+    static ScalarFloat Load(const float* src) { return *src; }
+    void Store(float* dst) const { *dst = m_value; }
+};
+
+inline ScalarFloat operator+(ScalarFloat a, ScalarFloat b) { return a.m_value + b.m_value; }
+inline ScalarFloat operator-(ScalarFloat a, ScalarFloat b) { return a.m_value - b.m_value; }
+inline ScalarFloat operator*(ScalarFloat a, ScalarFloat b) { return a.m_value * b.m_value; }
+inline ScalarFloat operator/(ScalarFloat a, ScalarFloat b) { return a.m_value / b.m_value; }
+inline ScalarFloat MultiplyAdd(ScalarFloat a, ScalarFloat b, ScalarFloat c) { return a.m_value * b.m_value + c.m_value; }
+inline ScalarFloat Min(ScalarFloat a, ScalarFloat b) { return a.m_value < b.m_value ? a.m_value : b.m_value; }
+inline ScalarFloat Max(ScalarFloat a, ScalarFloat b) { return a.m_value > b.m_value ? a.m_value : b.m_value; }
+inline ScalarFloat Round(ScalarFloat a) { return std::nearbyint(a.m_value); }
+inline bool Less(ScalarFloat a, ScalarFloat b) { return a.m_value < b.m_value; }
+inline ScalarFloat Select(bool mask, ScalarFloat if_true, ScalarFloat if_false) { return mask ? if_true : if_false; }
+
+// 2^n for integral n in [-126, 127]
+inline ScalarFloat Pow2i(ScalarFloat n) { return std::bit_cast<float>(uint32_t(int32_t(n.m_value) + 127) << 23); }
+
+#if defined(__AVX512F__)
+
+struct FloatVec
+{
+    static constexpr size_t width = 16;
+    using Mask = __mmask16;
+
+    __m512 m_value;
+
+    FloatVec() = default;
+    FloatVec(__m512 value) : m_value(value) {}
+    FloatVec(float value) : m_value(_mm512_set1_ps(value)) {}
+
+    static FloatVec Load(const float* src) { return _mm512_loadu_ps(src); }
+    void Store(float* dst) const { _mm512_storeu_ps(dst, m_value); }
+};
+
+inline FloatVec operator+(FloatVec a, FloatVec b) { return _mm512_add_ps(a.m_value, b.m_value); }
+inline FloatVec operator-(FloatVec a, FloatVec b) { return _mm512_sub_ps(a.m_value, b.m_value); }
+inline FloatVec operator*(FloatVec a, FloatVec b) { return _mm512_mul_ps(a.m_value, b.m_value); }
+inline FloatVec operator/(FloatVec a, FloatVec b) { return _mm512_div_ps(a.m_value, b.m_value); }
+inline FloatVec MultiplyAdd(FloatVec a, FloatVec b, FloatVec c) { return _mm512_fmadd_ps(a.m_value, b.m_value, c.m_value); }
+inline FloatVec Min(FloatVec a, FloatVec b) { return _mm512_min_ps(a.m_value, b.m_value); }
+inline FloatVec Max(FloatVec a, FloatVec b) { return _mm512_max_ps(a.m_value, b.m_value); }
+inline FloatVec Round(FloatVec a) { return _mm512_roundscale_ps(a.m_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+inline FloatVec::Mask Less(FloatVec a, FloatVec b) { return _mm512_cmp_ps_mask(a.m_value, b.m_value, _CMP_LT_OQ); }
+inline FloatVec Select(FloatVec::Mask mask, FloatVec if_true, FloatVec if_false) { return _mm512_mask_blend_ps(mask, if_false.m_value, if_true.m_value); }
+
+inline FloatVec Pow2i(FloatVec n)
+{
+    const __m512i exponent = _mm512_add_epi32(_mm512_cvtps_epi32(n.m_value), _mm512_set1_epi32(127));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(exponent, 23));
+}
+
+#elif defined(__AVX__)
+
+struct FloatVec
+{
+    static constexpr size_t width = 8;
+    using Mask = FloatVec;
+
+    __m256 m_value;
+
+    FloatVec() = default;
+    FloatVec(__m256 value) : m_value(value) {}
+    FloatVec(float value) : m_value(_mm256_set1_ps(value)) {}
+
+    static FloatVec Load(const float* src) { return _mm256_loadu_ps(src); }
+    void Store(float* dst) const { _mm256_storeu_ps(dst, m_value); }
+};
+
+inline FloatVec operator+(FloatVec a, FloatVec b) { return _mm256_add_ps(a.m_value, b.m_value); }
+inline FloatVec operator-(FloatVec a, FloatVec b) { return _mm256_sub_ps(a.m_value, b.m_value); }
+inline FloatVec operator*(FloatVec a, FloatVec b) { return _mm256_mul_ps(a.m_value, b.m_value); }
+inline FloatVec operator/(FloatVec a, FloatVec b) { return _mm256_div_ps(a.m_value, b.m_value); }
+inline FloatVec Min(FloatVec a, FloatVec b) { return _mm256_min_ps(a.m_value, b.m_value); }
+inline FloatVec Max(FloatVec a, FloatVec b) { return _mm256_max_ps(a.m_value, b.m_value); }
+inline FloatVec Round(FloatVec a) { return _mm256_round_ps(a.m_value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+inline FloatVec Less(FloatVec a, FloatVec b) { return _mm256_cmp_ps(a.m_value, b.m_value, _CMP_LT_OQ); }
+inline FloatVec Select(FloatVec mask, FloatVec if_true, FloatVec if_false) { return _mm256_blendv_ps(if_false.m_value, if_true.m_value, mask.m_value); }
+
+inline FloatVec MultiplyAdd(FloatVec a, FloatVec b, FloatVec c)
+{
+#if defined(__FMA__) || defined(__AVX2__)
+    return _mm256_fmadd_ps(a.m_value, b.m_value, c.m_value);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a.m_value, b.m_value), c.m_value);
+#endif
+}
+
+inline FloatVec Pow2i(FloatVec n)
+{
+    const __m256i integer = _mm256_cvtps_epi32(n.m_value);
+#if defined(__AVX2__)
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(integer, _mm256_set1_epi32(127)), 23));
+#else
+    // AVX has no 256 bit integer instructions, the halves are processed separately
+    const __m128i bias = _mm_set1_epi32(127);
+    const __m128i lo = _mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(integer), bias), 23);
+    const __m128i hi = _mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(integer, 1), bias), 23);
+    return _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1));
+#endif
+}
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+struct FloatVec
+{
+    static constexpr size_t width = 4;
+    using Mask = uint32x4_t;
+
+    float32x4_t m_value;
+
+    FloatVec() = default;
+    FloatVec(float32x4_t value) : m_value(value) {}
+    FloatVec(float value) : m_value(vdupq_n_f32(value)) {}
+
+    static FloatVec Load(const float* src) { return vld1q_f32(src); }
+    void Store(float* dst) const { vst1q_f32(dst, m_value); }
+};
+
+inline FloatVec operator+(FloatVec a, FloatVec b) { return vaddq_f32(a.m_value, b.m_value); }
+inline FloatVec operator-(FloatVec a, FloatVec b) { return vsubq_f32(a.m_value, b.m_value); }
+inline FloatVec operator*(FloatVec a, FloatVec b) { return vmulq_f32(a.m_value, b.m_value); }
+inline FloatVec operator/(FloatVec a, FloatVec b) { return vdivq_f32(a.m_value, b.m_value); }
+inline FloatVec MultiplyAdd(FloatVec a, FloatVec b, FloatVec c) { return vfmaq_f32(c.m_value, a.m_value, b.m_value); }
+inline FloatVec Min(FloatVec a, FloatVec b) { return vminq_f32(a.m_value, b.m_value); }
+inline FloatVec Max(FloatVec a, FloatVec b) { return vmaxq_f32(a.m_value, b.m_value); }
+inline FloatVec Round(FloatVec a) { return vrndnq_f32(a.m_value); }
+inline FloatVec::Mask Less(FloatVec a, FloatVec b) { return vcltq_f32(a.m_value, b.m_value); }
+inline FloatVec Select(FloatVec::Mask mask, FloatVec if_true, FloatVec if_false) { return vbslq_f32(mask, if_true.m_value, if_false.m_value); }
+
+inline FloatVec Pow2i(FloatVec n) { return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n.m_value), vdupq_n_s32(127)), 23)); }
+
+#else
+
+using FloatVec = ScalarFloat;
+
+#endif
+
+} // namespace macademy::simd
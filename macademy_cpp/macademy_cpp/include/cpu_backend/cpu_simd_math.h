@@ -0,0 +1,109 @@
+#pragma once
+
+#include "cpu_backend/cpu_simd.h"
+
+#include <algorithm>
+#include <span>
+
+namespace macademy::simd {
+
+// Polynomial approximations of the transcendental activation functions, for both simd::FloatVec and simd::ScalarFloat.
+// The error bounds are verified by the CpuSimdMath tests.
+
+// exp(x) with the range reduced to [-ln2/2, ln2/2] and a degree 6 polynomial (Cephes expf). The input is clamped to [-87, 88].
+// Max relative error: 3e-7
+template <typename V> inline V Exp(V x)
+{
+    x = Min(Max(x, V(-87.0f)), V(88.0f));
+
+    const V n = Round(x * V(1.44269504088896341f));
+    V r = MultiplyAdd(n, V(-0.693359375f), x); // ln2 is split into two constants to keep the reduction exact
+    r = MultiplyAdd(n, V(2.12194440e-4f), r);
+
+    V p = V(1.9875691500e-4f);
+    p = MultiplyAdd(p, r, V(1.3981999507e-3f));
+    p = MultiplyAdd(p, r, V(8.3334519073e-3f));
+    p = MultiplyAdd(p, r, V(4.1665795894e-2f));
+    p = MultiplyAdd(p, r, V(1.6666665459e-1f));
+    p = MultiplyAdd(p, r, V(5.0000001201e-1f));
+    p = MultiplyAdd(p, r * r, r + V(1.0f));
+
+    return p * Pow2i(n);
+}
+
+// Max absolute error: 2e-7
+template <typename V> inline V Sigmoid(V x) { return V(1.0f) / (V(1.0f) + Exp(V(0.0f) - x)); }
+
+// Max absolute error: 4e-7
+template <typename V> inline V Tanh(V x) { return V(2.0f) / (V(1.0f) + Exp(V(-2.0f) * x)) - V(1.0f); }
+
+// log(1 + exp(x)) = max(x, 0) + log1p(exp(-|x|)). log1p(y) is evaluated on y in (0, 1] using log1p(y) = 2 * atanh(y / (2 + y)) and
+// the series of atanh up to the 13th power. Max relative error: 4e-7
+template <typename V> inline V SoftPlus(V x)
+{
+    const V y = Exp(V(0.0f) - Max(x, V(0.0f) - x));
+
+    const V s = y / (V(2.0f) + y);
+    const V s2 = s * s;
+    V p = V(1.0f / 13.0f);
+    p = MultiplyAdd(p, s2, V(1.0f / 11.0f));
+    p = MultiplyAdd(p, s2, V(1.0f / 9.0f));
+    p = MultiplyAdd(p, s2, V(1.0f / 7.0f));
+    p = MultiplyAdd(p, s2, V(1.0f / 5.0f));
+    p = MultiplyAdd(p, s2, V(1.0f / 3.0f));
+    p = MultiplyAdd(p, s2, V(1.0f));
+
+    return Max(x, V(0.0f)) + V(2.0f) * s * p;
+}
+
+// The argument is reduced to [-tan(pi/8), tan(pi/8)] using atan(x) = pi/2 - atan(1/x) and atan(x) = pi/4 + atan((x-1)/(x+1)),
+// followed by a degree 9 odd polynomial (Cephes atanf). Max absolute error: 3e-7
+template <typename V> inline V ArcTan(V x)
+{
+    const V a = Max(x, V(0.0f) - x);
+
+    const auto large = Less(V(2.414213562373095f), a);
+    const auto medium = Less(V(0.4142135623730950f), a);
+
+    const V offset = Select(large, V(1.570796326794897f), Select(medium, V(0.7853981633974483f), V(0.0f)));
+    const V t = Select(large, V(-1.0f) / a, Select(medium, (a - V(1.0f)) / (a + V(1.0f)), a));
+
+    const V z = t * t;
+    V p = V(8.05374449538e-2f);
+    p = MultiplyAdd(p, z, V(-1.38776856032e-1f));
+    p = MultiplyAdd(p, z, V(1.99777106478e-1f));
+    p = MultiplyAdd(p, z, V(-3.33329491539e-1f));
+
+    const V ret = offset + MultiplyAdd(p * z, t, t);
+    return Select(Less(x, V(0.0f)), V(0.0f) - ret, ret);
+}
+
+inline float HorizontalSum(FloatVec a)
+{
+    float values[FloatVec::width];
+    a.Store(values);
+
+    float sum = 0.0f;
+    for (float f : values) {
+        sum += f;
+    }
+    return sum;
+}
+
+// Applies func to every value with the widest vector type, the remaining values are processed in a zero padded vector
+template <typename Func> inline void Transform(std::span<float> values, Func&& func)
+{
+    size_t i = 0;
+    for (; i + FloatVec::width <= values.size(); i += FloatVec::width) {
+        func(FloatVec::Load(values.data() + i)).Store(values.data() + i);
+    }
+
+    if (i < values.size()) {
+        float tail[FloatVec::width]{};
+        std::copy(values.begin() + i, values.end(), tail);
+        func(FloatVec::Load(tail)).Store(tail);
+        std::copy(tail, tail + (values.size() - i), values.begin() + i);
+    }
+}
+
+} // namespace macademy::simd
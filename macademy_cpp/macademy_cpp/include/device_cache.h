@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace macademy {
+
+// Directory of the per device caches (tuning results, compiled kernels). It is read from the "cache_directory" key of the device config,
+// then from the MACADEMY_CACHE_DIR environment variable, and defaults to a directory in the temp folder. An empty "cache_directory" disables caching.
+std::optional<std::filesystem::path> GetCacheDirectory(const nlohmann::json& device_config);
+
+// Makes a device description usable as a file name
+std::string GetCacheFileName(const std::string& device_key);
+
+std::optional<std::vector<uint8_t>> ReadCacheFile(const std::filesystem::path& path);
+
+// The file is written to a temporary file first, and renamed afterwards, so other processes never read a partially written file
+bool WriteCacheFile(const std::filesystem::path& path, std::span<const uint8_t> data);
+
+} // namespace macademy
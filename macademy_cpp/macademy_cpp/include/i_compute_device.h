@@ -22,29 +22,83 @@ struct ComputeDeviceInfo
     bool operator==(ComputeDeviceInfo const&) const = default;
 };
 
+struct OptimizerParameters
+{
+    Optimizer m_optimizer = Optimizer::SGD;
+    float m_learning_rate = 0.0f;
+    float m_gradient_scale = 1.0f;           // the accumulated gradient is multiplied by this value before it is used
+    float m_regularization_term_1 = 1.0f;    // the weights are multiplied by this value when the step is applied (L2 or decoupled weight decay)
+    float m_regularization_term_2 = 0.0f;    // sign(weight) * term is subtracted from the weights after the step is applied (L1)
+    float m_l1_gradient_term = 0.0f;         // sign(weight) * term is added to the gradient (L1 regularization for adaptive optimizers)
+    float m_l2_gradient_term = 0.0f;         // weight * term is added to the gradient (L2 regularization for adaptive optimizers)
+    float m_beta1 = 0.0f;                    // momentum, or the decay rate of the first moment in Adam
+    float m_beta2 = 0.0f;                    // decay rate of the second moment in Adam
+    float m_epsilon = 0.0f;
+    float m_bias_correction_1 = 1.0f;        // 1 / (1 - beta1^t) in Adam
+    float m_bias_correction_2 = 1.0f;        // 1 / (1 - beta2^t) in Adam
+};
+
+enum class RandomDistribution
+{
+    Uniform,
+    Gaussian
+};
+
+struct MutationParameters
+{
+    uint64_t m_seed = 0;
+    uint32_t m_stream = 0; // mutations with the same seed but different streams are independent (e.g. one stream per layer)
+    RandomDistribution m_weight_distribution = RandomDistribution::Uniform;
+    float m_weight_scale = 0.0f; // the range of the uniform distribution or the standard deviation of the gaussian distribution
+    RandomDistribution m_bias_distribution = RandomDistribution::Uniform;
+    float m_bias_scale = 0.0f;
+};
+
 class IComputeDevice
 {
   public:
     virtual ~IComputeDevice() {}
 
     virtual std::unique_ptr<IBuffer> CreateBuffer(size_t size, BufferUsage buffer_usage, const std::string& name) = 0;
+    // Creates a buffer that refers to a range of an existing buffer, so multiple small buffers can share one allocation.
+    // The offset must be a multiple of GetBufferViewAlignment(), and the buffer must outlive the view.
+    virtual std::unique_ptr<IBuffer> CreateBufferView(IBuffer* buffer, size_t offset, size_t size, const std::string& name) = 0;
+    virtual size_t GetBufferViewAlignment() const = 0;
 
     virtual void QueueWriteToBuffer(IBuffer* dst_buffer, std::span<const uint8_t> src, size_t buffer_offset) = 0;
     virtual void QueueReadFromBuffer(IBuffer* src_buffer, std::span<uint8_t> dst, size_t buffer_offset) = 0;
     virtual void QueueFillBuffer(IBuffer* buffer, uint32_t data, size_t offset_bytes, size_t size_bytes) = 0;
+
+    // Maps a range of the buffer for host access, so it can be filled or read in place instead of through a copy of the data.
+    // The queued work using the buffer is finished before the data is accessible, the contents are undefined with WriteOnly access.
+    // The buffer must not be used by queued work until it is unmapped, the host writes are visible to the work queued afterwards.
+    virtual std::span<uint8_t> MapBuffer(IBuffer* buffer, BufferUsage access, size_t offset_bytes, size_t size_bytes) = 0;
+    virtual void UnmapBuffer(IBuffer* buffer) = 0;
     virtual void SubmitQueue() = 0;
     virtual void WaitQueueIdle() = 0;
 
+    // The tensor buffers store the weights and biases of a layer in the DenseLayout of its neuron count and weights per neuron
     virtual void QueueEvaluateLayer(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function, uint32_t layer_input_count,
                                     uint32_t layer_neuron_count) = 0;
+    virtual void QueueEvaluateLayerBatched(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
+                                           uint32_t layer_input_count, uint32_t layer_neuron_count, uint32_t batch_size, uint32_t weights_batch_stride) = 0;
+    // The z values are only written and read if ActivationFunctionUsesZValues(activation_function), otherwise zvalues may be nullptr
     virtual void QueueTrainForwardPass(const IBuffer* tensor_buffer, const IBuffer* prev_activations, IBuffer* activations, IBuffer* zvalues, ActivationFunction activation_function,
                                        uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t num_training_samples) = 0;
-    virtual void QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* prev_activations_buffer, const IBuffer* layer_activations_buffer,
-                                        const IBuffer* layer_zvalues_buffer, IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, IBuffer* current_layer_gradient_buffer,
-                                        uint32_t layer_neuron_count, uint32_t weights_per_neuron, ActivationFunction activation_function, uint32_t num_training_samples, CostFunction costFunction,
-                                        uint32_t next_layer_neuron_count) = 0;
-    virtual void QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, float regularization_term_1,
-                                     float regularization_term_2, float normalized_learning_rate) = 0;
+    virtual void QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* layer_activations_buffer, const IBuffer* layer_zvalues_buffer,
+                                        IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, uint32_t layer_neuron_count, ActivationFunction activation_function,
+                                        uint32_t num_training_samples, CostFunction costFunction, uint32_t next_layer_neuron_count) = 0;
+    virtual void QueueTrainCalculateGradient(const IBuffer* delta_k_vector_buffer, const IBuffer* prev_activations_buffer, IBuffer* current_layer_gradient_buffer, uint32_t layer_neuron_count,
+                                             uint32_t weights_per_neuron, uint32_t num_training_samples) = 0;
+    virtual void QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, IBuffer* moment1_buffer, IBuffer* moment2_buffer, uint32_t layer_neuron_count,
+                                     uint32_t weights_per_neuron, const OptimizerParameters& optimizer_parameters) = 0;
+    // Converts a tensor buffer in place into a layout that is faster to evaluate, returns false and leaves the buffer unchanged if the device has no such layout.
+    // A prepared buffer can only be evaluated by QueueEvaluateLayer and QueueEvaluateLayerBatched without a weights batch stride.
+    virtual bool PrepareTensorForInference(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron) = 0;
+    // The tensor buffer holds tensor_count tensors of the layer after each other, e.g. the members of a population
+    virtual void QueueApplyMutation(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t tensor_count, const MutationParameters& mutation_parameters) = 0;
+    virtual void QueueCrossover(const IBuffer* parents_tensor_buffer, IBuffer* children_tensor_buffer, const IBuffer* parent_ids_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron,
+                                uint32_t children_count, uint64_t seed, uint32_t stream) = 0;
 
     virtual std::string GetDeviceName() const = 0;
     virtual size_t GetTotalMemory() const = 0;
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "compute_tasks.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace macademy {
+
+struct InferenceServerConfig
+{
+    uint32_t m_max_batch_size = 32;
+    std::chrono::microseconds m_max_wait_time{1000}; // A batch is evaluated at the latest after its oldest request waited this long
+    uint32_t m_worker_count = 1;
+    uint32_t m_latency_sample_count = 1 << 16; // Percentiles are calculated over the most recent requests
+};
+
+struct InferenceServerStatistics
+{
+    uint64_t m_request_count = 0;
+    uint64_t m_batch_count = 0;
+    std::chrono::microseconds m_latency_p50{};
+    std::chrono::microseconds m_latency_p90{};
+    std::chrono::microseconds m_latency_p99{};
+    std::chrono::microseconds m_latency_max{};
+    std::vector<uint64_t> m_batch_size_histogram; // Number of evaluated batches for each batch size, indexed by the batch size
+};
+
+/// <summary>
+/// An in-process inference service. Single inputs are submitted from any thread, and are collected into batches by worker threads,
+/// which evaluate a batch once it reaches the max batch size, or when its oldest request waited for the max wait time.
+/// </summary>
+class InferenceServer
+{
+    struct Request
+    {
+        std::vector<float> m_input;
+        std::promise<std::vector<float>> m_promise;
+        std::chrono::steady_clock::time_point m_submit_time;
+    };
+
+    const NetworkResourceHandle& m_network_resources;
+    const InferenceServerConfig m_config;
+    ComputeTasks m_compute_tasks;
+
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_condition;
+    std::deque<Request> m_queue;
+    bool m_stop = false;
+
+    mutable std::mutex m_statistics_mutex;
+    uint64_t m_request_count = 0;
+    uint64_t m_batch_count = 0;
+    std::vector<uint64_t> m_batch_size_histogram;
+    std::vector<std::chrono::microseconds> m_latencies;
+    size_t m_latency_write_index = 0;
+
+    std::vector<std::thread> m_workers;
+
+    void WorkerThread();
+    void EvaluateBatch(std::vector<Request>& batch);
+
+  public:
+    InferenceServer(const NetworkResourceHandle& network_resources, const InferenceServerConfig& config = {});
+
+    /// Stops accepting requests, and returns after the queued requests are evaluated
+    ~InferenceServer();
+
+    InferenceServer(const InferenceServer&) = delete;
+    InferenceServer& operator=(const InferenceServer&) = delete;
+
+    std::future<std::vector<float>> Submit(std::span<const float> input);
+
+    InferenceServerStatistics GetStatistics() const;
+    void ResetStatistics();
+};
+
+} // namespace macademy
@@ -13,6 +13,7 @@ struct Tensor
     DType m_dtype = DType::Float32;
     std::vector<uint8_t> m_data;
     std::vector<uint32_t> m_shape;
+    DenseLayout m_layout;
 
     uint32_t GetElementSize() const
     {
@@ -23,12 +24,16 @@ struct Tensor
     std::span<uint8_t> GetRawData() { return std::span<uint8_t>(m_data.begin(), m_data.end()); }
     std::span<uint32_t> const GetShape() { return std::span<uint32_t>(m_shape.begin(), m_shape.end()); }
     DType GetDType() const { return m_dtype; }
+    const DenseLayout& GetLayout() const { return m_layout; }
     std::span<float> AsFloat32() { return std::span<float>(reinterpret_cast<float*>(m_data.data()), m_data.size() / sizeof(float)); }
     std::span<const float> AsFloat32() const { return std::span<const float>(reinterpret_cast<const float*>(m_data.data()), m_data.size() / sizeof(float)); }
 
-    Tensor(DType dtype, std::span<const uint8_t> data, std::span<const uint32_t> shape) : m_dtype(dtype), m_data(data.begin(), data.end()), m_shape(shape.begin(), shape.end()) {}
+    Tensor(DType dtype, std::span<const uint8_t> data, const DenseLayout& layout) : m_dtype(dtype), m_data(data.begin(), data.end()), m_shape{layout.GetElementCount()}, m_layout(layout) {}
 
-    explicit Tensor(const Tensor& t) : Tensor(t.m_dtype, t.m_data, t.m_shape) {}
+    // A zero initialized tensor of the layout, so the weights can be written into their final storage
+    Tensor(DType dtype, const DenseLayout& layout) : m_dtype(dtype), m_data(size_t(layout.GetElementCount()) * sizeof(float)), m_shape{layout.GetElementCount()}, m_layout(layout) {}
+
+    explicit Tensor(const Tensor& t) : Tensor(t.m_dtype, t.m_data, t.m_layout) {}
 };
 
 struct LayerConfig
@@ -39,6 +44,10 @@ struct LayerConfig
 
 std::unique_ptr<Tensor> GenerateWeights(DType dtype, const IWeightInitializer& initializer, uint32_t num_neurons, uint32_t weights_per_neuron);
 
+// Conversion from and to the packed format of the exported networks, which stores every neuron as its weights followed by its bias: [neuron][weights..., bias]
+std::vector<float> GetPackedWeights(const Tensor& tensor);
+std::unique_ptr<Tensor> CreateTensorFromPackedWeights(DType dtype, std::span<const float> packed_weights, uint32_t num_neurons, uint32_t weights_per_neuron);
+
 struct Layer
 {
     std::unique_ptr<Tensor> m_tensor;
@@ -55,8 +64,15 @@ class Network
     const uint32_t m_input_arg_count{};
 
   public:
+    // Takes the tensors of the layers without copying them
+    Network(const std::string& name, uint32_t input_count, std::vector<Layer>&& layers);
+    // Deep-copies the tensors of the layers
     Network(const std::string& name, uint32_t input_count, std::span<const Layer> layers);
 
+    Network(const Network&) = delete;
+    Network& operator=(const Network&) = delete;
+    Network(Network&&) = default;
+
     std::span<const Layer> GetLayers() const { return std::span<const Layer>(m_layers.data(), m_layers.size()); }
 
     std::span<Layer> GetLayers() { return std::span<Layer>(m_layers.data(), m_layers.size()); }
@@ -9,6 +9,7 @@ class OpenCLBuffer : public IBuffer
 {
     std::unique_ptr<cl::Buffer> m_buffer;
     const size_t m_size = 0;
+    void* m_mapped_data = nullptr;
 
   public:
     OpenCLBuffer(cl::Context& context, cl_mem_flags flags, size_t size, void* host_ptr = nullptr) : m_size(size)
@@ -22,6 +23,19 @@ class OpenCLBuffer : public IBuffer
         }
     }
 
+    // A sub-buffer referring to a region of the buffer, the memory access flags are inherited. The buffer must outlive the sub-buffer.
+    OpenCLBuffer(OpenCLBuffer& buffer, size_t offset, size_t size) : m_size(size)
+    {
+        cl_int err;
+        cl_buffer_region region{.origin = offset, .size = size};
+        m_buffer = std::make_unique<cl::Buffer>(buffer.GetBuffer().createSubBuffer(0, CL_BUFFER_CREATE_TYPE_REGION, &region, &err));
+
+        if (err != 0) {
+            m_buffer.reset();
+            throw std::runtime_error("Failed to create sub-buffer!");
+        }
+    }
+
     void UploadData(cl::CommandQueue& queue, size_t offset, std::span<uint8_t> data, bool blocking)
     {
         if (m_size == 0) {
@@ -31,6 +45,26 @@ class OpenCLBuffer : public IBuffer
         queue.enqueueWriteBuffer(*m_buffer, blocking, offset, data.size_bytes(), data.data());
     }
 
+    std::span<uint8_t> Map(cl::CommandQueue& queue, cl_map_flags flags, size_t offset, size_t size)
+    {
+        if (m_mapped_data) {
+            throw std::runtime_error("Buffer is already mapped!");
+        }
+
+        m_mapped_data = queue.enqueueMapBuffer(*m_buffer, true, flags, offset, size);
+        return std::span<uint8_t>(static_cast<uint8_t*>(m_mapped_data), size);
+    }
+
+    void Unmap(cl::CommandQueue& queue)
+    {
+        if (!m_mapped_data) {
+            throw std::runtime_error("Buffer is not mapped!");
+        }
+
+        queue.enqueueUnmapMemObject(*m_buffer, m_mapped_data);
+        m_mapped_data = nullptr;
+    }
+
     size_t GetSize() const override { return m_size; }
 
     cl::Buffer& GetBuffer() const { return *m_buffer; }
@@ -4,10 +4,15 @@
 #include "opencl_common.h"
 
 #include <optional>
+#include <filesystem>
+#include <map>
+#include <mutex>
 #include <nlohmann/json.hpp>
 
 namespace macademy {
 
+class OpenCLBuffer;
+
 class OpenCLComputeDevice : public IComputeDevice
 {
     cl::Device m_device;
@@ -15,44 +20,87 @@ class OpenCLComputeDevice : public IComputeDevice
     mutable cl::CommandQueue m_command_queue;
     cl::Program m_program;
 
-    using KernelEval = cl::KernelFunctor<cl::Buffer, cl::Buffer, cl::Buffer, cl_uint, cl_uint, cl_uint>;
+    using KernelEval = cl::KernelFunctor<cl::Buffer, cl::Buffer, cl::Buffer, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint>;
     using KernelTrainingForwardPass = cl::KernelFunctor<cl::Buffer, cl::Buffer, cl::Buffer, cl::Buffer, cl_uint, cl_uint, cl_uint, cl_uint>;
-    using KernelTrainingBackwardPass =
-        cl::KernelFunctor<cl::Buffer, cl::Buffer, cl::Buffer, cl::Buffer, cl::Buffer, cl::Buffer, cl::Buffer, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint>;
-    using KernelTrainingApplyGradient = cl::KernelFunctor<cl::Buffer, cl::Buffer, cl_uint, cl_uint, cl_float, cl_float, cl_float>;
-
-    mutable std::unique_ptr<KernelEval> m_kernel_calc_single_layer;
-    mutable std::unique_ptr<KernelTrainingForwardPass> m_kernel_train_forward_pass;
-    mutable std::unique_ptr<KernelTrainingBackwardPass> m_kernel_train_backward_pass;
+    using KernelTrainingBackwardPass = cl::KernelFunctor<cl::Buffer, cl::Buffer, cl::Buffer, cl::Buffer, cl::Buffer, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint>;
+    using KernelTrainingCalculateGradient = cl::KernelFunctor<cl::Buffer, cl::Buffer, cl::Buffer, cl_uint, cl_uint, cl_uint>;
+    using KernelTrainingApplyGradient = cl::KernelFunctor<cl::Buffer, cl::Buffer, cl::Buffer, cl::Buffer, cl_uint, cl_uint, cl_uint, cl_float, cl_float, cl_float, cl_float, cl_float, cl_float,
+                                                          cl_float, cl_float, cl_float, cl_float, cl_float>;
+    using KernelApplyMutation = cl::KernelFunctor<cl::Buffer, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint, cl_float, cl_uint, cl_float>;
+    using KernelCrossover = cl::KernelFunctor<cl::Buffer, cl::Buffer, cl::Buffer, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint, cl_uint>;
+    using KernelSoftmax = cl::KernelFunctor<cl::Buffer, cl_uint, cl_uint>;
+
+    // Kernels of a program built for a single activation function, so the activation function is resolved at compile time
+    struct ActivationKernels
+    {
+        cl::Program m_program;
+        std::unique_ptr<KernelEval> m_kernel_calc_single_layer;
+        std::unique_ptr<KernelTrainingForwardPass> m_kernel_train_forward_pass;
+        std::unique_ptr<KernelTrainingBackwardPass> m_kernel_train_backward_pass;
+    };
+
+    std::map<ActivationFunction, std::unique_ptr<ActivationKernels>> m_activation_kernels;
+
+    mutable std::unique_ptr<KernelTrainingCalculateGradient> m_kernel_train_calc_gradient;
     mutable std::unique_ptr<KernelTrainingApplyGradient> m_kernel_train_apply_gradient;
+    mutable std::unique_ptr<KernelApplyMutation> m_kernel_apply_mutation;
+    mutable std::unique_ptr<KernelCrossover> m_kernel_crossover;
+    mutable std::unique_ptr<KernelSoftmax> m_kernel_softmax;
+
+    // Setting the arguments and enqueueing a kernel is not atomic, the command queue itself is thread-safe
+    std::mutex m_kernel_mutex;
 
     cl::size_type m_kernel_calc_single_layer_ideal_workgroup_size = 64;
     cl::size_type m_kernel_training_ideal_workgroup_size_x = 8;
     cl::size_type m_kernel_training_ideal_workgroup_size_y = 8;
     cl::size_type m_kernel_training_apply_gradient_ideal_workgroup_size = 64;
     bool m_is_float16_supported = false;
+    bool m_is_host_unified_memory = false; // integrated devices, the buffers are allocated in host accessible memory so mapping them doesn't copy
+
+    std::string m_build_args;
+    std::optional<std::filesystem::path> m_cache_directory;
+
+    // Loads the program binary from the disk cache if possible, otherwise builds it from source and stores it in the cache
+    cl::Program BuildProgram(const std::string& build_args);
+
+    // The programs of the activation functions are built on first use, m_kernel_mutex must be locked when calling this
+    ActivationKernels& GetActivationKernels(ActivationFunction activation_function);
+
+    // Normalizes the rows of the buffer after a Softmax layer was evaluated with its z values, m_kernel_mutex must be locked when calling this
+    void QueueSoftmax(OpenCLBuffer* buffer, uint32_t row_length, uint32_t row_count);
 
   public:
     OpenCLComputeDevice(const ComputeDeviceInfo& device, const nlohmann::json& device_config);
 
     std::unique_ptr<IBuffer> CreateBuffer(size_t size, BufferUsage buffer_usage, const std::string& name) override;
+    std::unique_ptr<IBuffer> CreateBufferView(IBuffer* buffer, size_t offset, size_t size, const std::string& name) override;
+    size_t GetBufferViewAlignment() const override;
 
     void QueueWriteToBuffer(IBuffer* dst_buffer, std::span<const uint8_t> src, size_t buffer_offset) override;
     void QueueReadFromBuffer(IBuffer* src_buffer, std::span<uint8_t> dst, size_t buffer_offset) override;
     void QueueFillBuffer(IBuffer* buffer, uint32_t data, size_t offset, size_t size) override;
+    std::span<uint8_t> MapBuffer(IBuffer* buffer, BufferUsage access, size_t offset_bytes, size_t size_bytes) override;
+    void UnmapBuffer(IBuffer* buffer) override;
     void SubmitQueue() override;
     void WaitQueueIdle() override;
 
     void QueueEvaluateLayer(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function, uint32_t layer_input_count,
                             uint32_t layer_neuron_count) override;
+    void QueueEvaluateLayerBatched(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
+                                   uint32_t layer_input_count, uint32_t layer_neuron_count, uint32_t batch_size, uint32_t weights_batch_stride) override;
     void QueueTrainForwardPass(const IBuffer* tensor_buffer, const IBuffer* prev_activations, IBuffer* activations, IBuffer* zvalues, ActivationFunction activation_function,
                                uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t num_training_samples) override;
-    void QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* prev_activations_buffer, const IBuffer* layer_activations_buffer,
-                                const IBuffer* layer_zvalues_buffer, IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, IBuffer* current_layer_gradient_buffer,
-                                uint32_t layer_neuron_count, uint32_t weights_per_neuron, ActivationFunction activation_function, uint32_t num_training_samples, CostFunction costFunction,
-                                uint32_t next_layer_neuron_count) override;
-    void QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, float regularization_term_1, float regularization_term_2,
-                             float normalized_learning_rate) override;
+    void QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* layer_activations_buffer, const IBuffer* layer_zvalues_buffer,
+                                IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, uint32_t layer_neuron_count, ActivationFunction activation_function,
+                                uint32_t num_training_samples, CostFunction costFunction, uint32_t next_layer_neuron_count) override;
+    void QueueTrainCalculateGradient(const IBuffer* delta_k_vector_buffer, const IBuffer* prev_activations_buffer, IBuffer* current_layer_gradient_buffer, uint32_t layer_neuron_count,
+                                     uint32_t weights_per_neuron, uint32_t num_training_samples) override;
+    void QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, IBuffer* moment1_buffer, IBuffer* moment2_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron,
+                             const OptimizerParameters& optimizer_parameters) override;
+    bool PrepareTensorForInference(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron) override;
+    void QueueApplyMutation(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t tensor_count, const MutationParameters& mutation_parameters) override;
+    void QueueCrossover(const IBuffer* parents_tensor_buffer, IBuffer* children_tensor_buffer, const IBuffer* parent_ids_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron,
+                        uint32_t children_count, uint64_t seed, uint32_t stream) override;
 
     static std::vector<cl::Device> GetDeviceList();
 
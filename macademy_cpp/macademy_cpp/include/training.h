@@ -4,6 +4,7 @@
 #include "training_suite.h"
 
 #include <algorithm>
+#include <span>
 
 namespace macademy {
 
@@ -13,6 +14,11 @@ class Training
 {
   public:
     std::shared_ptr<const TrainingResultTracker> Train(NetworkResourceHandle& network, std::shared_ptr<TrainingSuite> training_suite);
+
+    // Data parallel training: every minibatch is split between the handles proportionally to the measured throughput of their devices,
+    // the gradients are summed on the host and the same update is applied on every device. The handles must hold the same network,
+    // the trained weights are written back to the network of the first handle.
+    std::shared_ptr<const TrainingResultTracker> Train(std::span<NetworkResourceHandle* const> networks, std::shared_ptr<TrainingSuite> training_suite);
 };
 
 } // namespace macademy
\ No newline at end of file
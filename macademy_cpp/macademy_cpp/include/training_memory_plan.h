@@ -0,0 +1,75 @@
+#pragma once
+
+#include "common.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace macademy {
+
+class Network;
+
+enum class TrainingBufferRole
+{
+    Input,
+    DesiredOutput,
+    Activations,
+    ZValues, // only stored for layers whose activation function uses them, see ActivationFunctionUsesZValues
+    DeltaK,
+    ForwardActivations, // output of a recomputed layer in the forward pass, only read by the forward pass of the next layer
+    ForwardZValues,
+};
+
+/// <summary>
+/// Device memory required to train a network with a given number of samples per training step.
+/// The per-sample buffers are assigned to physical buffers by their lifetime in the training step: a buffer that is only used after
+/// the last use of another buffer shares its physical buffer (e.g. the delta_k vectors of the backward pass reuse the activations of later layers).
+///
+/// With a checkpoint interval of k, only the activations of every k-th layer (and of the layers after the last such checkpoint) are kept after the forward pass.
+/// The layers in between are recomputed from the previous checkpoint right before their segment is processed by the backward pass.
+/// </summary>
+struct TrainingMemoryPlan
+{
+    struct Buffer
+    {
+        TrainingBufferRole m_role;
+        uint32_t m_layer_id = 0; // 0 for the input and desired output buffers
+        size_t m_size = 0;
+        uint32_t m_first_use = 0; // index of the pass that writes the buffer first in the training step
+        uint32_t m_last_use = 0;  // index of the last pass that reads the buffer
+        uint32_t m_physical_buffer_id = 0;
+    };
+
+    uint32_t m_training_sample_count = 0;
+    uint32_t m_checkpoint_interval = 0; // 0 if every layer keeps its activations
+    std::vector<Buffer> m_buffers;
+    std::vector<size_t> m_physical_buffer_sizes;
+
+    size_t m_weights_size = 0;   // weights and biases of every layer
+    size_t m_gradients_size = 0; // accumulated gradients of every layer
+    size_t m_optimizer_size = 0; // moment buffers of the optimizer
+
+    const Buffer& GetBuffer(TrainingBufferRole role, uint32_t layer_id = 0) const;
+    bool HasBuffer(TrainingBufferRole role, uint32_t layer_id = 0) const;
+
+    // Recomputed layers are evaluated a second time before the backward pass, their forward pass writes the ForwardActivations and ForwardZValues buffers
+    bool IsRecomputedLayer(uint32_t layer_id) const { return HasBuffer(TrainingBufferRole::ForwardActivations, layer_id); }
+
+    // Size of the physical per-sample buffers
+    size_t GetTransientSize() const;
+
+    // Size the per-sample buffers would take without sharing physical buffers
+    size_t GetTransientSizeWithoutReuse() const;
+
+    size_t GetTotalSize() const { return m_weights_size + m_gradients_size + m_optimizer_size + GetTransientSize(); }
+
+    std::string ToString() const;
+};
+
+TrainingMemoryPlan CreateTrainingMemoryPlan(const Network& network, uint32_t training_sample_count, Optimizer optimizer, uint32_t checkpoint_interval = 0);
+
+// Returns the largest number of training samples per training step whose plan fits into memory_budget bytes, 0 if not even a single sample fits
+uint32_t CalculateMaxTrainingSampleCount(const Network& network, Optimizer optimizer, size_t memory_budget, uint32_t checkpoint_interval = 0);
+
+} // namespace macademy
@@ -25,6 +25,26 @@ struct TrainingSuite
     /// </summary>
     std::optional<uint64_t> m_mini_batch_size;
 
+    /// <summary>
+    /// Size of the micro-batches a minibatch is processed in.
+    /// The gradients of the micro-batches are accumulated and applied once per minibatch, so the result matches
+    /// training on the whole minibatch, but the training resources are only allocated for a single micro-batch.
+    /// This allows large minibatches (or full batch gradient descent) in bounded device memory.
+    ///
+    /// If not specified, a minibatch is processed at once.
+    /// </summary>
+    std::optional<uint64_t> m_micro_batch_size;
+
+    /// <summary>
+    /// Gradient checkpointing: if specified, only the activations of every n-th layer are kept after the forward pass,
+    /// the layers in between are evaluated again from the previous checkpoint when the backward pass reaches them.
+    /// This trades an extra forward pass of most layers for far less memory per training sample in deep networks,
+    /// so larger minibatches fit into the device memory. The calculated gradients are the same.
+    ///
+    /// If not specified, the activations of every layer are kept.
+    /// </summary>
+    std::optional<uint32_t> m_checkpoint_interval;
+
     /// <summary>
     /// The learning rate
     /// After a gradient is calculated on a minibatch, the gradient descent will take a step along the
@@ -47,6 +67,50 @@ struct TrainingSuite
     /// </summary>
     bool m_shuffle_training_data = true;
 
+    /// <summary>
+    /// If true, training runs are reproducible: every random decision made during training (e.g. the order of
+    /// the shuffled training data) is derived from m_random_seed, so training the same network with the same suite
+    /// on the same device produces bit-identical weights. Gradients are always reduced in a fixed order on all backends.
+    /// If false, a new random seed is used for every training run.
+    /// </summary>
+    bool m_deterministic = false;
+
+    /// <summary>
+    /// The seed of the random number generators used during training, if m_deterministic is enabled
+    /// </summary>
+    uint64_t m_random_seed = 5489U;
+
+    /// <summary>
+    /// The optimizer that turns the gradient of a minibatch into a step of the weights and biases.
+    /// SGD follows the gradient directly, Momentum and Nesterov accumulate a velocity of the past gradients,
+    /// Adam and AdamW scale the step of every parameter by the running averages of its gradient and squared gradient.
+    ///
+    /// SGD, Momentum and Nesterov use m_learning_rate the same way, Adam and AdamW use it as the (bias corrected) step size of
+    /// the mean gradient of the minibatch, typical values are around 0.001
+    /// </summary>
+    Optimizer m_optimizer = Optimizer::SGD;
+
+    /// <summary>
+    /// The momentum coefficient of the Momentum and Nesterov optimizers
+    /// </summary>
+    float m_momentum = 0.9f;
+
+    /// <summary>
+    /// The decay rates of the first and second moment estimates of the Adam and AdamW optimizers
+    /// </summary>
+    float m_adam_beta1 = 0.9f;
+    float m_adam_beta2 = 0.999f;
+
+    /// <summary>
+    /// Small value added to the denominator of the Adam and AdamW update to avoid divisions by zero
+    /// </summary>
+    float m_adam_epsilon = 1e-8f;
+
+    /// <summary>
+    /// The decoupled weight decay of AdamW. AdamW uses this instead of L2 regularization
+    /// </summary>
+    float m_weight_decay = 0.01f;
+
     /// <summary>
     /// The cost function to use on the network's output
     /// </summary>
@@ -6,6 +6,43 @@
 #define Activation_Threshold 5
 #define Activation_SoftPlus 6
 #define Activation_ArcTan 7
+#define Activation_Softmax 8
+
+#define CostFunction_MeanSquared 0
+#define CostFunction_CrossEntropy_Sigmoid 1
+#define CostFunction_CrossEntropy_Softmax 2
+
+// Layout of the weights and biases of a layer, see DenseLayout in common.h: a [neuron][row stride] weight matrix with zero padded rows, followed by the bias vector
+#define DENSE_ROW_ALIGNMENT 16
+
+uint GetRowStride(uint weights_per_neuron)
+{
+    return (weights_per_neuron + DENSE_ROW_ALIGNMENT - 1) / DENSE_ROW_ALIGNMENT * DENSE_ROW_ALIGNMENT;
+}
+
+uint GetBiasOffset(uint layer_neuron_count, uint weights_per_neuron)
+{
+    return layer_neuron_count * GetRowStride(weights_per_neuron);
+}
+
+uint GetTensorElementCount(uint layer_neuron_count, uint weights_per_neuron)
+{
+    return GetBiasOffset(layer_neuron_count, weights_per_neuron) + layer_neuron_count;
+}
+
+// Tensors stored after each other, like the members of a population, start at multiples of this
+uint GetTensorStride(uint layer_neuron_count, uint weights_per_neuron)
+{
+    return (GetTensorElementCount(layer_neuron_count, weights_per_neuron) + DENSE_ROW_ALIGNMENT - 1) / DENSE_ROW_ALIGNMENT * DENSE_ROW_ALIGNMENT;
+}
+
+// Kernels specialized for a single activation function set this constant, and the activation function in the push constants is ignored
+layout(constant_id = 2) const uint ACTIVATION_FUNCTION = 0xFFFFFFFFu;
+
+uint SelectActivationFunction(uint functionId)
+{
+    return ACTIVATION_FUNCTION != 0xFFFFFFFFu ? ACTIVATION_FUNCTION : functionId;
+}
 
 float ActivationFunction(uint functionId, float x)
 {
@@ -26,34 +63,39 @@ float ActivationFunction(uint functionId, float x)
         return log(1 + exp(x));
     case Activation_ArcTan:
         return atan(x);
+    case Activation_Softmax:
+        return x; // the rows are normalized by kernel_softmax
     default:
         return 0;
     }
 }
 
-float ActivationFunctionPrime(uint functionId, float x)
+// The derivative of the other activation functions is calculated from their output, their z values are not stored
+bool ActivationFunctionUsesZValues(uint functionId)
+{
+    return functionId == Activation_SoftPlus || functionId == Activation_ArcTan;
+}
+
+// Derivative of the activation function at z, where a is the activation of z
+float ActivationFunctionPrime(uint functionId, float z, float a)
 {
 	switch (functionId) {
-    case Activation_Sigmoid: {
-        const float sigm = ActivationFunction(Activation_Sigmoid, x);
-        return sigm * (1.0f - sigm);
-    }
+    case Activation_Sigmoid:
+        return a * (1.0f - a);
     case Activation_ReLU:
-        return x < 0.0f ? 0.0f : 1.0f;
-    case Activation_Tanh: {
-        const float sigm = ActivationFunction(Activation_Tanh, x);
-        return 1.0f - sigm * sigm;
-    }
+        return a > 0.0f ? 1.0f : 0.0f;
+    case Activation_Tanh:
+        return 1.0f - a * a;
     case Activation_Identity:
         return 1.0f;
     case Activation_Threshold:
         return 0.0f;
     case Activation_LeakyReLU:
-        return x < 0.0f ? 0.01f : 1.0f;
+        return a < 0.0f ? 0.01f : 1.0f;
     case Activation_SoftPlus:
-        return 1.0f / (1.0f + exp(-x));
+        return 1.0f / (1.0f + exp(-z));
     case Activation_ArcTan:
-        return 1.0f / (x * x + 1);
+        return 1.0f / (z * z + 1);
     default:
         return 0;
     }
@@ -63,9 +105,10 @@ float CostFunctionDelta(uint costFunctionId, uint activationFunctionId, float z,
 {
 	switch(costFunctionId)
 	{
-		case 0: //Mean-squared error cost function
-			return (a - desiredOutput) * ActivationFunctionPrime(activationFunctionId, z);
-		case 1: //Cross-entropy cost function
+		case CostFunction_MeanSquared:
+			return (a - desiredOutput) * ActivationFunctionPrime(activationFunctionId, z, a);
+		case CostFunction_CrossEntropy_Sigmoid:
+		case CostFunction_CrossEntropy_Softmax:
 		default:
 			return a - desiredOutput;
 	}
@@ -93,3 +136,16 @@ void atomicAdd_g_f(volatile __global float *addr, float val)
     } while( current.u32 != expected.u32 );
 }
 #endif
+
+// Philox4x32-10 counter based random number generator, see Salmon et al.: Parallel Random Numbers: As Easy as 1, 2, 3
+uvec4 philox4x32_10(uvec4 counter, uvec2 key)
+{
+    for (int round = 0; round < 10; ++round) {
+        uint hi0, lo0, hi1, lo1;
+        umulExtended(0xD2511F53u, counter.x, hi0, lo0);
+        umulExtended(0xCD9E8D57u, counter.z, hi1, lo1);
+        counter = uvec4(hi1 ^ counter.y ^ key.x, lo1, hi0 ^ counter.w ^ key.y, lo0);
+        key += uvec2(0x9E3779B9u, 0xBB67AE85u);
+    }
+    return counter;
+}
@@ -14,28 +14,76 @@ layout(std430, binding = 1) readonly buffer gradient_buf {
    float gradient[];
 };
 
+layout(std430, binding = 2) buffer moment1_buf {
+   float moment1[];
+};
+
+layout(std430, binding = 3) buffer moment2_buf {
+   float moment2[];
+};
+
 #include "common.glsl"
 
+#define Optimizer_SGD 0
+#define Optimizer_Momentum 1
+#define Optimizer_Nesterov 2
+#define Optimizer_Adam 3
+#define Optimizer_AdamW 4
+
 layout(local_size_x_id = 0, local_size_y = 1, local_size_z = 1) in;
 
 void main()
 {
-    const uint layer_neuron_id = gl_GlobalInvocationID.x;
+    const uint element_id = gl_GlobalInvocationID.x;
  
-    if (layer_neuron_id >= pc.layer_neuron_count)
+    if (element_id >= GetTensorElementCount(pc.layer_neuron_count, pc.weights_per_neuron))
         return;
 
-    const bool applyRegularizationTerm2 = pc.regularization_term_2 != 0.0;
+    // The padding has zero weights and gradients, so it stays zero
+    const bool is_bias = element_id >= GetBiasOffset(pc.layer_neuron_count, pc.weights_per_neuron);
+
+    float weight = weights_biases[element_id];
 
-    const uint neuron_offset_idx = layer_neuron_id * (pc.weights_per_neuron + 1);
+    float g = gradient[element_id] * pc.gradient_scale;
+    if (!is_bias) {
+        g += pc.l2_gradient_term * weight + pc.l1_gradient_term * sign(weight);
+    }
 
-    for (uint j = 0; j < pc.weights_per_neuron; ++j) {
-        float weight = weights_biases[neuron_offset_idx + j];
-        weight = pc.regularization_term_1 * weight - gradient[neuron_offset_idx + j] * pc.normalized_learning_rate;
-        if (applyRegularizationTerm2) {
+    float step = g;
+    switch (pc.optimizer) {
+    case Optimizer_Momentum: {
+        const float m = pc.beta1 * moment1[element_id] + g;
+        moment1[element_id] = m;
+        step = m;
+        break;
+    }
+    case Optimizer_Nesterov: {
+        const float m = pc.beta1 * moment1[element_id] + g;
+        moment1[element_id] = m;
+        step = g + pc.beta1 * m;
+        break;
+    }
+    case Optimizer_Adam:
+    case Optimizer_AdamW: {
+        const float m = pc.beta1 * moment1[element_id] + (1.0 - pc.beta1) * g;
+        const float v = pc.beta2 * moment2[element_id] + (1.0 - pc.beta2) * g * g;
+        moment1[element_id] = m;
+        moment2[element_id] = v;
+        step = (m * pc.bias_correction_1) / (sqrt(v * pc.bias_correction_2) + pc.epsilon);
+        break;
+    }
+    default:
+        break;
+    }
+
+    if (is_bias) {
+        weight -= step * pc.learning_rate;
+    } else {
+        weight = pc.regularization_term_1 * weight - step * pc.learning_rate;
+        if (pc.regularization_term_2 != 0.0) {
             weight -= pc.regularization_term_2 * sign(weight);
         }
-        weights_biases[neuron_offset_idx + j] = weight;
     }
-    weights_biases[neuron_offset_idx + pc.weights_per_neuron] -= gradient[neuron_offset_idx + pc.weights_per_neuron] * pc.normalized_learning_rate; //bias
+
+    weights_biases[element_id] = weight;
 }
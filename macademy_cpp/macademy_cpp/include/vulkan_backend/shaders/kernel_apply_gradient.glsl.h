@@ -1,14 +1,33 @@
-std::array<uint32_t, 516> vulkan_kernel_source_kernel_apply_gradient_glsl = {0x7230203, 0x10300, 0xd000b, 0x84, 0x0, 0x20011, 0x1, 0x6000b, 0x1, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x4, 0x6e69616d, 0x0, 0xb, 0x60010, 0x4, 0x11, 0x1, 0x1, 0x1, 0x40047, 0xb, 0xb, 0x1c, 0x50048, 0x12, 0x0, 0x23, 0x0, 0x50048, 0x12, 0x1,
-0x23, 0x4, 0x50048, 0x12, 0x2, 0x23, 0x8, 0x50048, 0x12, 0x3, 0x23, 0xc, 0x50048, 0x12, 0x4, 0x23, 0x10, 0x30047, 0x12, 0x2, 0x40047, 0x3b, 0x6, 0x4, 0x50048, 0x3c, 0x0, 0x23, 0x0, 0x30047, 0x3c, 0x2, 0x40047, 0x3e, 0x22, 0x0, 0x40047, 0x3e, 0x21, 0x0,
-0x40047, 0x4a, 0x6, 0x4, 0x40048, 0x4b, 0x0, 0x18, 0x50048, 0x4b, 0x0, 0x23, 0x0, 0x30047, 0x4b, 0x2, 0x40047, 0x4d, 0x22, 0x0, 0x40047, 0x4d, 0x21, 0x1, 0x40047, 0x7a, 0x1, 0x0, 0x40047, 0x7b, 0xb, 0x19, 0x20013, 0x2, 0x30021, 0x3, 0x2, 0x40015, 0x6, 0x20,
-0x0, 0x40017, 0x9, 0x6, 0x3, 0x40020, 0xa, 0x1, 0x9, 0x4003b, 0xa, 0xb, 0x1, 0x4002b, 0x6, 0xc, 0x0, 0x40020, 0xd, 0x1, 0x6, 0x30016, 0x11, 0x20, 0x7001e, 0x12, 0x6, 0x6, 0x11, 0x11, 0x11, 0x40020, 0x13, 0x9, 0x12, 0x4003b, 0x13, 0x14, 0x9, 0x40015,
-0x15, 0x20, 0x1, 0x4002b, 0x15, 0x16, 0x0, 0x40020, 0x17, 0x9, 0x6, 0x20014, 0x1a, 0x4002b, 0x15, 0x21, 0x3, 0x40020, 0x22, 0x9, 0x11, 0x4002b, 0x11, 0x25, 0x0, 0x4002b, 0x15, 0x29, 0x1, 0x4002b, 0x6, 0x2c, 0x1, 0x3001d, 0x3b, 0x11, 0x3001e, 0x3c, 0x3b, 0x40020,
-0x3d, 0xc, 0x3c, 0x4003b, 0x3d, 0x3e, 0xc, 0x40020, 0x42, 0xc, 0x11, 0x4002b, 0x15, 0x45, 0x2, 0x3001d, 0x4a, 0x11, 0x3001e, 0x4b, 0x4a, 0x40020, 0x4c, 0xc, 0x4b, 0x4003b, 0x4c, 0x4d, 0xc, 0x4002b, 0x15, 0x53, 0x4, 0x40032, 0x6, 0x7a, 0x1, 0x60033, 0x9, 0x7b,
-0x7a, 0x2c, 0x2c, 0x50036, 0x2, 0x4, 0x0, 0x3, 0x200f8, 0x5, 0x300f7, 0x7c, 0x0, 0x300fb, 0xc, 0x7d, 0x200f8, 0x7d, 0x50041, 0xd, 0xe, 0xb, 0xc, 0x4003d, 0x6, 0xf, 0xe, 0x50041, 0x17, 0x18, 0x14, 0x16, 0x4003d, 0x6, 0x19, 0x18, 0x500ae, 0x1a, 0x1b, 0xf,
-0x19, 0x300f7, 0x1d, 0x0, 0x400fa, 0x1b, 0x1c, 0x1d, 0x200f8, 0x1c, 0x200f9, 0x7c, 0x200f8, 0x1d, 0x50041, 0x22, 0x23, 0x14, 0x21, 0x4003d, 0x11, 0x24, 0x23, 0x500b7, 0x1a, 0x26, 0x24, 0x25, 0x50041, 0x17, 0x2a, 0x14, 0x29, 0x4003d, 0x6, 0x2b, 0x2a, 0x50080, 0x6, 0x2d,
-0x2b, 0x2c, 0x50084, 0x6, 0x2e, 0xf, 0x2d, 0x200f9, 0x30, 0x200f8, 0x30, 0x700f5, 0x6, 0x81, 0xc, 0x1d, 0x68, 0x33, 0x500b0, 0x1a, 0x38, 0x81, 0x2b, 0x400f6, 0x32, 0x33, 0x0, 0x400fa, 0x38, 0x31, 0x32, 0x200f8, 0x31, 0x50080, 0x6, 0x41, 0x2e, 0x81, 0x60041, 0x42,
-0x43, 0x3e, 0x16, 0x41, 0x4003d, 0x11, 0x44, 0x43, 0x50041, 0x22, 0x46, 0x14, 0x45, 0x4003d, 0x11, 0x47, 0x46, 0x50085, 0x11, 0x49, 0x47, 0x44, 0x60041, 0x42, 0x51, 0x4d, 0x16, 0x41, 0x4003d, 0x11, 0x52, 0x51, 0x50041, 0x22, 0x54, 0x14, 0x53, 0x4003d, 0x11, 0x55,
-0x54, 0x50085, 0x11, 0x56, 0x52, 0x55, 0x50083, 0x11, 0x57, 0x49, 0x56, 0x300f7, 0x5a, 0x0, 0x400fa, 0x26, 0x59, 0x5a, 0x200f8, 0x59, 0x6000c, 0x11, 0x5e, 0x1, 0x6, 0x57, 0x50085, 0x11, 0x5f, 0x24, 0x5e, 0x50083, 0x11, 0x61, 0x57, 0x5f, 0x200f9, 0x5a, 0x200f8, 0x5a,
-0x700f5, 0x11, 0x83, 0x57, 0x31, 0x61, 0x59, 0x3003e, 0x43, 0x83, 0x200f9, 0x33, 0x200f8, 0x33, 0x50080, 0x6, 0x68, 0x81, 0x29, 0x200f9, 0x30, 0x200f8, 0x32, 0x50080, 0x6, 0x6c, 0x2e, 0x2b, 0x60041, 0x42, 0x71, 0x4d, 0x16, 0x6c, 0x4003d, 0x11, 0x72, 0x71, 0x50041, 0x22,
-0x73, 0x14, 0x53, 0x4003d, 0x11, 0x74, 0x73, 0x50085, 0x11, 0x75, 0x72, 0x74, 0x60041, 0x42, 0x76, 0x3e, 0x16, 0x6c, 0x4003d, 0x11, 0x77, 0x76, 0x50083, 0x11, 0x78, 0x77, 0x75, 0x3003e, 0x76, 0x78, 0x200f9, 0x7c, 0x200f8, 0x7c, 0x100fd, 0x10038,
+std::array<uint32_t, 1247> vulkan_kernel_source_kernel_apply_gradient_glsl = {0x7230203, 0x10300, 0x0, 0xdb, 0x0, 0x20011, 0x1, 0x6000b, 0x53, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x1d, 0x6e69616d, 0x0, 0x21, 0x60010, 0x1d, 0x11, 0x1, 0x1, 0x1, 0x30047, 0x3, 0x2, 0x50048, 0x3, 0x0, 0x23, 0x0, 0x50048, 0x3, 0x1, 0x23,
+0x4, 0x50048, 0x3, 0x2, 0x23, 0x8, 0x50048, 0x3, 0x3, 0x23, 0xc, 0x50048, 0x3, 0x4, 0x23, 0x10, 0x50048, 0x3, 0x5, 0x23, 0x14, 0x50048, 0x3, 0x6, 0x23, 0x18, 0x50048, 0x3, 0x7, 0x23, 0x1c, 0x50048, 0x3, 0x8, 0x23, 0x20, 0x50048, 0x3, 0x9, 0x23,
+0x24, 0x50048, 0x3, 0xa, 0x23, 0x28, 0x50048, 0x3, 0xb, 0x23, 0x2c, 0x50048, 0x3, 0xc, 0x23, 0x30, 0x50048, 0x3, 0xd, 0x23, 0x34, 0x40047, 0x6, 0x6, 0x4, 0x30047, 0x7, 0x2, 0x50048, 0x7, 0x0, 0x23, 0x0, 0x40047, 0x8, 0x22, 0x0, 0x40047, 0x8, 0x21,
+0x0, 0x40047, 0xc, 0x6, 0x4, 0x30047, 0xd, 0x2, 0x50048, 0xd, 0x0, 0x23, 0x0, 0x40048, 0xd, 0x0, 0x18, 0x40047, 0xe, 0x22, 0x0, 0x40047, 0xe, 0x21, 0x1, 0x40047, 0x11, 0x6, 0x4, 0x30047, 0x12, 0x2, 0x50048, 0x12, 0x0, 0x23, 0x0, 0x40047, 0x13, 0x22,
+0x0, 0x40047, 0x13, 0x21, 0x2, 0x40047, 0x16, 0x6, 0x4, 0x30047, 0x17, 0x2, 0x50048, 0x17, 0x0, 0x23, 0x0, 0x40047, 0x18, 0x22, 0x0, 0x40047, 0x18, 0x21, 0x3, 0x40047, 0x1c, 0x1, 0x2, 0x40047, 0x21, 0xb, 0x1c, 0x40047, 0xd9, 0x1, 0x0, 0x40047, 0xda, 0xb,
+0x19, 0x40015, 0x1, 0x20, 0x0, 0x30016, 0x2, 0x20, 0x10001e, 0x3, 0x1, 0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x40020, 0x5, 0x9, 0x3, 0x4003b, 0x5, 0x4, 0x9, 0x3001d, 0x6, 0x2, 0x3001e, 0x7, 0x6, 0x40020, 0x9,
+0xc, 0x7, 0x4003b, 0x9, 0x8, 0xc, 0x40015, 0xa, 0x20, 0x1, 0x4002b, 0xa, 0xb, 0x0, 0x3001d, 0xc, 0x2, 0x3001e, 0xd, 0xc, 0x40020, 0xf, 0xc, 0xd, 0x4003b, 0xf, 0xe, 0xc, 0x4002b, 0xa, 0x10, 0x1, 0x3001d, 0x11, 0x2, 0x3001e, 0x12, 0x11, 0x40020, 0x14,
+0xc, 0x12, 0x4003b, 0x14, 0x13, 0xc, 0x4002b, 0xa, 0x15, 0x2, 0x3001d, 0x16, 0x2, 0x3001e, 0x17, 0x16, 0x40020, 0x19, 0xc, 0x17, 0x4003b, 0x19, 0x18, 0xc, 0x4002b, 0xa, 0x1a, 0x3, 0x4002b, 0x1, 0x1b, 0xffffffff, 0x40032, 0x1, 0x1c, 0xffffffff, 0x20013, 0x1e, 0x30021, 0x1f,
+0x1e, 0x40017, 0x22, 0x1, 0x3, 0x40020, 0x23, 0x1, 0x22, 0x4003b, 0x23, 0x21, 0x1, 0x40020, 0x27, 0x9, 0x1, 0x50021, 0x2c, 0x1, 0x1, 0x1, 0x20014, 0x2f, 0x40020, 0x3a, 0xc, 0x2, 0x40020, 0x3d, 0x7, 0x2, 0x4002b, 0xa, 0x40, 0x4, 0x40020, 0x42, 0x9, 0x2,
+0x4002b, 0xa, 0x4a, 0x8, 0x4002b, 0xa, 0x4f, 0x7, 0x4002b, 0xa, 0x61, 0x9, 0x4002b, 0x2, 0x7c, 0x3f800000, 0x4002b, 0xa, 0x83, 0xa, 0x4002b, 0xa, 0x93, 0xc, 0x4002b, 0xa, 0x97, 0xd, 0x4002b, 0xa, 0x9c, 0xb, 0x4002b, 0xa, 0xaa, 0x5, 0x4002b, 0xa, 0xb4, 0x6,
+0x4002b, 0x2, 0xb7, 0x0, 0x40021, 0xcd, 0x1, 0x1, 0x4002b, 0xa, 0xd2, 0x10, 0x4002b, 0x1, 0xd3, 0x10, 0x4002b, 0x1, 0xd5, 0x1, 0x40032, 0x1, 0xd9, 0x1, 0x60033, 0x22, 0xda, 0xd9, 0xd5, 0xd5, 0x50036, 0x1e, 0x1d, 0x0, 0x1f, 0x200f8, 0x20, 0x4003b, 0x3d, 0x3c,
+0x7, 0x4003b, 0x3d, 0x45, 0x7, 0x4003b, 0x3d, 0x59, 0x7, 0x4003d, 0x22, 0x24, 0x21, 0x50051, 0x1, 0x25, 0x24, 0x0, 0x50041, 0x27, 0x26, 0x4, 0xb, 0x4003d, 0x1, 0x28, 0x26, 0x50041, 0x27, 0x29, 0x4, 0x10, 0x4003d, 0x1, 0x2a, 0x29, 0x60039, 0x1, 0x2d, 0x2b,
+0x28, 0x2a, 0x500ae, 0x2f, 0x2e, 0x25, 0x2d, 0x300f7, 0x30, 0x0, 0x400fa, 0x2e, 0x31, 0x30, 0x200f8, 0x31, 0x100fd, 0x200f8, 0x30, 0x50041, 0x27, 0x32, 0x4, 0xb, 0x4003d, 0x1, 0x33, 0x32, 0x50041, 0x27, 0x34, 0x4, 0x10, 0x4003d, 0x1, 0x35, 0x34, 0x60039, 0x1, 0x37,
+0x36, 0x33, 0x35, 0x500ae, 0x2f, 0x38, 0x25, 0x37, 0x60041, 0x3a, 0x39, 0x8, 0xb, 0x25, 0x4003d, 0x2, 0x3b, 0x39, 0x3003e, 0x3c, 0x3b, 0x60041, 0x3a, 0x3e, 0xe, 0xb, 0x25, 0x4003d, 0x2, 0x3f, 0x3e, 0x50041, 0x42, 0x41, 0x4, 0x40, 0x4003d, 0x2, 0x43, 0x41,
+0x50085, 0x2, 0x44, 0x3f, 0x43, 0x3003e, 0x45, 0x44, 0x400a8, 0x2f, 0x46, 0x38, 0x300f7, 0x47, 0x0, 0x400fa, 0x46, 0x48, 0x47, 0x200f8, 0x48, 0x4003d, 0x2, 0x49, 0x45, 0x50041, 0x42, 0x4b, 0x4, 0x4a, 0x4003d, 0x2, 0x4c, 0x4b, 0x4003d, 0x2, 0x4d, 0x3c, 0x50085, 0x2,
+0x4e, 0x4c, 0x4d, 0x50041, 0x42, 0x50, 0x4, 0x4f, 0x4003d, 0x2, 0x51, 0x50, 0x4003d, 0x2, 0x52, 0x3c, 0x6000c, 0x2, 0x54, 0x53, 0x6, 0x52, 0x50085, 0x2, 0x55, 0x51, 0x54, 0x50081, 0x2, 0x56, 0x4e, 0x55, 0x50081, 0x2, 0x57, 0x49, 0x56, 0x3003e, 0x45, 0x57,
+0x200f9, 0x47, 0x200f8, 0x47, 0x4003d, 0x2, 0x58, 0x45, 0x3003e, 0x59, 0x58, 0x50041, 0x27, 0x5a, 0x4, 0x15, 0x4003d, 0x1, 0x5b, 0x5a, 0x300f7, 0x5c, 0x0, 0xb00fb, 0x5b, 0x60, 0x1, 0x5d, 0x2, 0x5e, 0x3, 0x5f, 0x4, 0x5f, 0x200f8, 0x5d, 0x50041, 0x42, 0x62, 0x4,
+0x61, 0x4003d, 0x2, 0x63, 0x62, 0x60041, 0x3a, 0x64, 0x13, 0xb, 0x25, 0x4003d, 0x2, 0x65, 0x64, 0x50085, 0x2, 0x66, 0x63, 0x65, 0x4003d, 0x2, 0x67, 0x45, 0x50081, 0x2, 0x68, 0x66, 0x67, 0x60041, 0x3a, 0x69, 0x13, 0xb, 0x25, 0x3003e, 0x69, 0x68, 0x3003e, 0x59,
+0x68, 0x200f9, 0x5c, 0x200f8, 0x5e, 0x50041, 0x42, 0x6a, 0x4, 0x61, 0x4003d, 0x2, 0x6b, 0x6a, 0x60041, 0x3a, 0x6c, 0x13, 0xb, 0x25, 0x4003d, 0x2, 0x6d, 0x6c, 0x50085, 0x2, 0x6e, 0x6b, 0x6d, 0x4003d, 0x2, 0x6f, 0x45, 0x50081, 0x2, 0x70, 0x6e, 0x6f, 0x60041, 0x3a,
+0x71, 0x13, 0xb, 0x25, 0x3003e, 0x71, 0x70, 0x4003d, 0x2, 0x72, 0x45, 0x50041, 0x42, 0x73, 0x4, 0x61, 0x4003d, 0x2, 0x74, 0x73, 0x50085, 0x2, 0x75, 0x74, 0x70, 0x50081, 0x2, 0x76, 0x72, 0x75, 0x3003e, 0x59, 0x76, 0x200f9, 0x5c, 0x200f8, 0x5f, 0x50041, 0x42, 0x77,
+0x4, 0x61, 0x4003d, 0x2, 0x78, 0x77, 0x60041, 0x3a, 0x79, 0x13, 0xb, 0x25, 0x4003d, 0x2, 0x7a, 0x79, 0x50085, 0x2, 0x7b, 0x78, 0x7a, 0x50041, 0x42, 0x7d, 0x4, 0x61, 0x4003d, 0x2, 0x7e, 0x7d, 0x50083, 0x2, 0x7f, 0x7c, 0x7e, 0x4003d, 0x2, 0x80, 0x45, 0x50085,
+0x2, 0x81, 0x7f, 0x80, 0x50081, 0x2, 0x82, 0x7b, 0x81, 0x50041, 0x42, 0x84, 0x4, 0x83, 0x4003d, 0x2, 0x85, 0x84, 0x60041, 0x3a, 0x86, 0x18, 0xb, 0x25, 0x4003d, 0x2, 0x87, 0x86, 0x50085, 0x2, 0x88, 0x85, 0x87, 0x50041, 0x42, 0x89, 0x4, 0x83, 0x4003d, 0x2,
+0x8a, 0x89, 0x50083, 0x2, 0x8b, 0x7c, 0x8a, 0x4003d, 0x2, 0x8c, 0x45, 0x50085, 0x2, 0x8d, 0x8b, 0x8c, 0x4003d, 0x2, 0x8e, 0x45, 0x50085, 0x2, 0x8f, 0x8d, 0x8e, 0x50081, 0x2, 0x90, 0x88, 0x8f, 0x60041, 0x3a, 0x91, 0x13, 0xb, 0x25, 0x3003e, 0x91, 0x82, 0x60041,
+0x3a, 0x92, 0x18, 0xb, 0x25, 0x3003e, 0x92, 0x90, 0x50041, 0x42, 0x94, 0x4, 0x93, 0x4003d, 0x2, 0x95, 0x94, 0x50085, 0x2, 0x96, 0x82, 0x95, 0x50041, 0x42, 0x98, 0x4, 0x97, 0x4003d, 0x2, 0x99, 0x98, 0x50085, 0x2, 0x9a, 0x90, 0x99, 0x6000c, 0x2, 0x9b, 0x53,
+0x1f, 0x9a, 0x50041, 0x42, 0x9d, 0x4, 0x9c, 0x4003d, 0x2, 0x9e, 0x9d, 0x50081, 0x2, 0x9f, 0x9b, 0x9e, 0x50088, 0x2, 0xa0, 0x96, 0x9f, 0x3003e, 0x59, 0xa0, 0x200f9, 0x5c, 0x200f8, 0x60, 0x200f9, 0x5c, 0x200f8, 0x5c, 0x300f7, 0xa1, 0x0, 0x400fa, 0x38, 0xa2, 0xa3, 0x200f8,
+0xa2, 0x4003d, 0x2, 0xa4, 0x3c, 0x4003d, 0x2, 0xa5, 0x59, 0x50041, 0x42, 0xa6, 0x4, 0x1a, 0x4003d, 0x2, 0xa7, 0xa6, 0x50085, 0x2, 0xa8, 0xa5, 0xa7, 0x50083, 0x2, 0xa9, 0xa4, 0xa8, 0x3003e, 0x3c, 0xa9, 0x200f9, 0xa1, 0x200f8, 0xa3, 0x50041, 0x42, 0xab, 0x4, 0xaa,
+0x4003d, 0x2, 0xac, 0xab, 0x4003d, 0x2, 0xad, 0x3c, 0x50085, 0x2, 0xae, 0xac, 0xad, 0x4003d, 0x2, 0xaf, 0x59, 0x50041, 0x42, 0xb0, 0x4, 0x1a, 0x4003d, 0x2, 0xb1, 0xb0, 0x50085, 0x2, 0xb2, 0xaf, 0xb1, 0x50083, 0x2, 0xb3, 0xae, 0xb2, 0x3003e, 0x3c, 0xb3, 0x50041,
+0x42, 0xb5, 0x4, 0xb4, 0x4003d, 0x2, 0xb6, 0xb5, 0x500b7, 0x2f, 0xb8, 0xb6, 0xb7, 0x300f7, 0xb9, 0x0, 0x400fa, 0xb8, 0xba, 0xb9, 0x200f8, 0xba, 0x4003d, 0x2, 0xbb, 0x3c, 0x50041, 0x42, 0xbc, 0x4, 0xb4, 0x4003d, 0x2, 0xbd, 0xbc, 0x4003d, 0x2, 0xbe, 0x3c, 0x6000c,
+0x2, 0xbf, 0x53, 0x6, 0xbe, 0x50085, 0x2, 0xc0, 0xbd, 0xbf, 0x50083, 0x2, 0xc1, 0xbb, 0xc0, 0x3003e, 0x3c, 0xc1, 0x200f9, 0xb9, 0x200f8, 0xb9, 0x200f9, 0xa1, 0x200f8, 0xa1, 0x4003d, 0x2, 0xc2, 0x3c, 0x60041, 0x3a, 0xc3, 0x8, 0xb, 0x25, 0x3003e, 0xc3, 0xc2, 0x100fd,
+0x10038, 0x50036, 0x1, 0x2b, 0x0, 0x2c, 0x30037, 0x1, 0xc4, 0x30037, 0x1, 0xc5, 0x200f8, 0xc6, 0x60039, 0x1, 0xc7, 0x36, 0xc4, 0xc5, 0x50080, 0x1, 0xc8, 0xc7, 0xc4, 0x200fe, 0xc8, 0x10038, 0x50036, 0x1, 0x36, 0x0, 0x2c, 0x30037, 0x1, 0xc9, 0x30037, 0x1, 0xca, 0x200f8,
+0xcb, 0x50039, 0x1, 0xce, 0xcc, 0xca, 0x50084, 0x1, 0xcf, 0xc9, 0xce, 0x200fe, 0xcf, 0x10038, 0x50036, 0x1, 0xcc, 0x0, 0xcd, 0x30037, 0x1, 0xd0, 0x200f8, 0xd1, 0x50080, 0x1, 0xd4, 0xd0, 0xd3, 0x50082, 0x1, 0xd6, 0xd4, 0xd5, 0x50086, 0x1, 0xd7, 0xd6, 0xd3, 0x50084,
+0x1, 0xd8, 0xd7, 0xd3, 0x200fe, 0xd8, 0x10038,
 };
\ No newline at end of file
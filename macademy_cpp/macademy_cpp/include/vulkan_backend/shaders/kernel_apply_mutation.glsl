@@ -0,0 +1,58 @@
+#version 460
+///
+/// Vulkan kernels implementing network calculations, and backpropagation
+///
+
+#define VK_CONSTANTS_GLSL
+#include "kernel_apply_mutation_constants.h"
+
+layout(std430, binding = 0) buffer weights_biases_buf {
+   float weights_biases[];
+};
+
+#include "common.glsl"
+
+#define RandomDistribution_Uniform 0
+#define RandomDistribution_Gaussian 1
+
+layout(local_size_x_id = 0, local_size_y = 1, local_size_z = 1) in;
+
+// The counter is keyed on the tensor and the element within it, so a population doesn't run out of 32 bit element ids
+float generateMutation(uint distribution, float scale, uint tensor_id, uint element_id)
+{
+    const uvec4 random = philox4x32_10(uvec4(element_id, pc.stream, tensor_id, 0), uvec2(pc.seed_lo, pc.seed_hi));
+
+    if (distribution == RandomDistribution_Gaussian) {
+        // Box-Muller transform
+        const float u1 = float((random.x >> 8) + 1) * (1.0 / 16777216.0);
+        const float u2 = float(random.y >> 8) * (1.0 / 16777216.0);
+        return sqrt(-2.0 * log(u1)) * cos(6.28318530718 * u2) * scale;
+    }
+
+    const float u = float(random.x >> 8) * (1.0 / 16777216.0);
+    return (2.0 * u - 1.0) * scale;
+}
+
+void main()
+{
+    const uint element_id = gl_GlobalInvocationID.x;
+
+    const uint tensor_stride = GetTensorStride(pc.layer_neuron_count, pc.weights_per_neuron);
+
+    if (element_id >= pc.tensor_count * tensor_stride)
+        return;
+
+    const uint tensor_id = element_id / tensor_stride;
+    const uint tensor_element_id = element_id % tensor_stride;
+
+    if (tensor_element_id >= GetTensorElementCount(pc.layer_neuron_count, pc.weights_per_neuron))
+        return; // padding between the tensors
+
+    const bool is_bias = tensor_element_id >= GetBiasOffset(pc.layer_neuron_count, pc.weights_per_neuron);
+
+    if (!is_bias && tensor_element_id % GetRowStride(pc.weights_per_neuron) >= pc.weights_per_neuron)
+        return; // padding
+
+    weights_biases[element_id] += is_bias ? generateMutation(pc.bias_distribution, pc.bias_scale, tensor_id, tensor_element_id)
+                                          : generateMutation(pc.weight_distribution, pc.weight_scale, tensor_id, tensor_element_id);
+}
@@ -0,0 +1,33 @@
+std::array<uint32_t, 1280> vulkan_kernel_source_kernel_apply_mutation_glsl = {0x7230203, 0x10300, 0x0, 0xf5, 0x0, 0x20011, 0x1, 0x6000b, 0xa7, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x10, 0x6e69616d, 0x0, 0x14, 0x60010, 0x10, 0x11, 0x1, 0x1, 0x1, 0x30047, 0x3, 0x2, 0x50048, 0x3, 0x0, 0x23, 0x0, 0x50048, 0x3, 0x1, 0x23,
+0x4, 0x50048, 0x3, 0x2, 0x23, 0x8, 0x50048, 0x3, 0x3, 0x23, 0xc, 0x50048, 0x3, 0x4, 0x23, 0x10, 0x50048, 0x3, 0x5, 0x23, 0x14, 0x50048, 0x3, 0x6, 0x23, 0x18, 0x50048, 0x3, 0x7, 0x23, 0x1c, 0x50048, 0x3, 0x8, 0x23, 0x20, 0x50048, 0x3, 0x9, 0x23,
+0x24, 0x40047, 0x6, 0x6, 0x4, 0x30047, 0x7, 0x2, 0x50048, 0x7, 0x0, 0x23, 0x0, 0x40047, 0x8, 0x22, 0x0, 0x40047, 0x8, 0x21, 0x0, 0x40047, 0xd, 0x1, 0x2, 0x40047, 0x14, 0xb, 0x1c, 0x40047, 0xf3, 0x1, 0x0, 0x40047, 0xf4, 0xb, 0x19, 0x40015, 0x1, 0x20,
+0x0, 0x30016, 0x2, 0x20, 0xc001e, 0x3, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x2, 0x1, 0x2, 0x40020, 0x5, 0x9, 0x3, 0x4003b, 0x5, 0x4, 0x9, 0x3001d, 0x6, 0x2, 0x3001e, 0x7, 0x6, 0x40020, 0x9, 0xc, 0x7, 0x4003b, 0x9, 0x8, 0xc, 0x40015, 0xa,
+0x20, 0x1, 0x4002b, 0xa, 0xb, 0x0, 0x4002b, 0x1, 0xc, 0xffffffff, 0x40032, 0x1, 0xd, 0xffffffff, 0x4002b, 0xa, 0xe, 0x2, 0x4002b, 0xa, 0xf, 0x1, 0x20013, 0x11, 0x30021, 0x12, 0x11, 0x40017, 0x15, 0x1, 0x3, 0x40020, 0x16, 0x1, 0x15, 0x4003b, 0x16, 0x14, 0x1, 0x40020,
+0x1a, 0x9, 0x1, 0x50021, 0x1f, 0x1, 0x1, 0x1, 0x20014, 0x25, 0x40021, 0x40, 0x1, 0x1, 0x3002a, 0x25, 0x46, 0x40020, 0x4b, 0xc, 0x2, 0x4002b, 0xa, 0x50, 0x8, 0x4002b, 0xa, 0x53, 0x9, 0x40020, 0x55, 0x9, 0x2, 0x70021, 0x58, 0x2, 0x1, 0x2, 0x1, 0x1,
+0x4002b, 0xa, 0x5a, 0x6, 0x4002b, 0xa, 0x5d, 0x7, 0x4002b, 0xa, 0x68, 0x10, 0x4002b, 0x1, 0x69, 0x10, 0x4002b, 0x1, 0x6b, 0x1, 0x4002b, 0xa, 0x84, 0x5, 0x4002b, 0x1, 0x87, 0x0, 0x40017, 0x89, 0x1, 0x4, 0x4002b, 0xa, 0x8a, 0x3, 0x4002b, 0xa, 0x8d, 0x4,
+0x40017, 0x91, 0x1, 0x2, 0x50021, 0x93, 0x89, 0x89, 0x91, 0x4002b, 0x1, 0x99, 0x8, 0x4002b, 0x2, 0x9d, 0x3f800000, 0x4002b, 0x2, 0x9e, 0x4b800000, 0x4002b, 0x2, 0x9f, 0x33800000, 0x4002b, 0x2, 0xa5, 0x40000000, 0x4002b, 0x2, 0xa6, 0xc0000000, 0x4002b, 0x2, 0xab, 0x40c90fdb, 0x40020, 0xbb, 0x7,
+0x89, 0x40020, 0xbd, 0x7, 0x91, 0x40020, 0xbf, 0x7, 0xa, 0x4002b, 0xa, 0xc6, 0xa, 0x40020, 0xc9, 0x7, 0x1, 0x4002b, 0x1, 0xcd, 0xd2511f53, 0x4001e, 0xd1, 0x1, 0x1, 0x4002b, 0x1, 0xd4, 0xcd9e8d57, 0x4002b, 0x1, 0xec, 0x9e3779b9, 0x4002b, 0x1, 0xed, 0xbb67ae85, 0x5002c, 0x91, 0xee,
+0xec, 0xed, 0x40032, 0x1, 0xf3, 0x1, 0x60033, 0x15, 0xf4, 0xf3, 0x6b, 0x6b, 0x50036, 0x11, 0x10, 0x0, 0x12, 0x200f8, 0x13, 0x4003d, 0x15, 0x17, 0x14, 0x50051, 0x1, 0x18, 0x17, 0x0, 0x50041, 0x1a, 0x19, 0x4, 0xb, 0x4003d, 0x1, 0x1b, 0x19, 0x50041, 0x1a, 0x1c,
+0x4, 0xf, 0x4003d, 0x1, 0x1d, 0x1c, 0x60039, 0x1, 0x20, 0x1e, 0x1b, 0x1d, 0x50041, 0x1a, 0x21, 0x4, 0xe, 0x4003d, 0x1, 0x22, 0x21, 0x50084, 0x1, 0x23, 0x22, 0x20, 0x500ae, 0x25, 0x24, 0x18, 0x23, 0x300f7, 0x26, 0x0, 0x400fa, 0x24, 0x27, 0x26, 0x200f8, 0x27,
+0x100fd, 0x200f8, 0x26, 0x50086, 0x1, 0x28, 0x18, 0x20, 0x50089, 0x1, 0x29, 0x18, 0x20, 0x50041, 0x1a, 0x2a, 0x4, 0xb, 0x4003d, 0x1, 0x2b, 0x2a, 0x50041, 0x1a, 0x2c, 0x4, 0xf, 0x4003d, 0x1, 0x2d, 0x2c, 0x60039, 0x1, 0x2f, 0x2e, 0x2b, 0x2d, 0x500ae, 0x25, 0x30,
+0x29, 0x2f, 0x300f7, 0x31, 0x0, 0x400fa, 0x30, 0x32, 0x31, 0x200f8, 0x32, 0x100fd, 0x200f8, 0x31, 0x50041, 0x1a, 0x33, 0x4, 0xb, 0x4003d, 0x1, 0x34, 0x33, 0x50041, 0x1a, 0x35, 0x4, 0xf, 0x4003d, 0x1, 0x36, 0x35, 0x60039, 0x1, 0x38, 0x37, 0x34, 0x36, 0x500ae, 0x25,
+0x39, 0x29, 0x38, 0x400a8, 0x25, 0x3a, 0x39, 0x300f7, 0x3c, 0x0, 0x400fa, 0x3a, 0x3b, 0x3c, 0x200f8, 0x3b, 0x50041, 0x1a, 0x3d, 0x4, 0xf, 0x4003d, 0x1, 0x3e, 0x3d, 0x50039, 0x1, 0x41, 0x3f, 0x3e, 0x50089, 0x1, 0x42, 0x29, 0x41, 0x50041, 0x1a, 0x43, 0x4, 0xf,
+0x4003d, 0x1, 0x44, 0x43, 0x500ae, 0x25, 0x45, 0x42, 0x44, 0x200f9, 0x3c, 0x200f8, 0x3c, 0x700f5, 0x25, 0x47, 0x46, 0x31, 0x45, 0x3b, 0x300f7, 0x48, 0x0, 0x400fa, 0x47, 0x49, 0x48, 0x200f8, 0x49, 0x100fd, 0x200f8, 0x48, 0x60041, 0x4b, 0x4a, 0x8, 0xb, 0x18, 0x4003d, 0x2,
+0x4c, 0x4a, 0x300f7, 0x4f, 0x0, 0x400fa, 0x39, 0x4d, 0x4e, 0x200f8, 0x4d, 0x50041, 0x1a, 0x51, 0x4, 0x50, 0x4003d, 0x1, 0x52, 0x51, 0x50041, 0x55, 0x54, 0x4, 0x53, 0x4003d, 0x2, 0x56, 0x54, 0x80039, 0x2, 0x59, 0x57, 0x52, 0x56, 0x28, 0x29, 0x200f9, 0x4f, 0x200f8,
+0x4e, 0x50041, 0x1a, 0x5b, 0x4, 0x5a, 0x4003d, 0x1, 0x5c, 0x5b, 0x50041, 0x55, 0x5e, 0x4, 0x5d, 0x4003d, 0x2, 0x5f, 0x5e, 0x80039, 0x2, 0x60, 0x57, 0x5c, 0x5f, 0x28, 0x29, 0x200f9, 0x4f, 0x200f8, 0x4f, 0x700f5, 0x2, 0x61, 0x59, 0x4d, 0x60, 0x4e, 0x50081, 0x2,
+0x62, 0x4c, 0x61, 0x60041, 0x4b, 0x63, 0x8, 0xb, 0x18, 0x3003e, 0x63, 0x62, 0x100fd, 0x10038, 0x50036, 0x1, 0x1e, 0x0, 0x1f, 0x30037, 0x1, 0x64, 0x30037, 0x1, 0x65, 0x200f8, 0x66, 0x60039, 0x1, 0x67, 0x2e, 0x64, 0x65, 0x50080, 0x1, 0x6a, 0x67, 0x69, 0x50082, 0x1,
+0x6c, 0x6a, 0x6b, 0x50086, 0x1, 0x6d, 0x6c, 0x69, 0x50084, 0x1, 0x6e, 0x6d, 0x69, 0x200fe, 0x6e, 0x10038, 0x50036, 0x1, 0x2e, 0x0, 0x1f, 0x30037, 0x1, 0x6f, 0x30037, 0x1, 0x70, 0x200f8, 0x71, 0x60039, 0x1, 0x72, 0x37, 0x6f, 0x70, 0x50080, 0x1, 0x73, 0x72, 0x6f,
+0x200fe, 0x73, 0x10038, 0x50036, 0x1, 0x37, 0x0, 0x1f, 0x30037, 0x1, 0x74, 0x30037, 0x1, 0x75, 0x200f8, 0x76, 0x50039, 0x1, 0x77, 0x3f, 0x75, 0x50084, 0x1, 0x78, 0x74, 0x77, 0x200fe, 0x78, 0x10038, 0x50036, 0x1, 0x3f, 0x0, 0x40, 0x30037, 0x1, 0x79, 0x200f8, 0x7a, 0x50080,
+0x1, 0x7b, 0x79, 0x69, 0x50082, 0x1, 0x7c, 0x7b, 0x6b, 0x50086, 0x1, 0x7d, 0x7c, 0x69, 0x50084, 0x1, 0x7e, 0x7d, 0x69, 0x200fe, 0x7e, 0x10038, 0x50036, 0x2, 0x57, 0x0, 0x58, 0x30037, 0x1, 0x7f, 0x30037, 0x2, 0x80, 0x30037, 0x1, 0x81, 0x30037, 0x1, 0x82, 0x200f8,
+0x83, 0x50041, 0x1a, 0x85, 0x4, 0x84, 0x4003d, 0x1, 0x86, 0x85, 0x70050, 0x89, 0x88, 0x82, 0x86, 0x81, 0x87, 0x50041, 0x1a, 0x8b, 0x4, 0x8a, 0x4003d, 0x1, 0x8c, 0x8b, 0x50041, 0x1a, 0x8e, 0x4, 0x8d, 0x4003d, 0x1, 0x8f, 0x8e, 0x50050, 0x91, 0x90, 0x8c, 0x8f,
+0x60039, 0x89, 0x94, 0x92, 0x88, 0x90, 0x500aa, 0x25, 0x95, 0x7f, 0x6b, 0x300f7, 0x96, 0x0, 0x400fa, 0x95, 0x97, 0x96, 0x200f8, 0x97, 0x50051, 0x1, 0x98, 0x94, 0x0, 0x500c2, 0x1, 0x9a, 0x98, 0x99, 0x50080, 0x1, 0x9b, 0x9a, 0x6b, 0x40070, 0x2, 0x9c, 0x9b, 0x50085,
+0x2, 0xa0, 0x9c, 0x9f, 0x50051, 0x1, 0xa1, 0x94, 0x1, 0x500c2, 0x1, 0xa2, 0xa1, 0x99, 0x40070, 0x2, 0xa3, 0xa2, 0x50085, 0x2, 0xa4, 0xa3, 0x9f, 0x6000c, 0x2, 0xa8, 0xa7, 0x1c, 0xa0, 0x50085, 0x2, 0xa9, 0xa6, 0xa8, 0x6000c, 0x2, 0xaa, 0xa7, 0x1f, 0xa9,
+0x50085, 0x2, 0xac, 0xab, 0xa4, 0x6000c, 0x2, 0xad, 0xa7, 0xe, 0xac, 0x50085, 0x2, 0xae, 0xaa, 0xad, 0x50085, 0x2, 0xaf, 0xae, 0x80, 0x200fe, 0xaf, 0x200f8, 0x96, 0x50051, 0x1, 0xb0, 0x94, 0x0, 0x500c2, 0x1, 0xb1, 0xb0, 0x99, 0x40070, 0x2, 0xb2, 0xb1, 0x50085,
+0x2, 0xb3, 0xb2, 0x9f, 0x50085, 0x2, 0xb4, 0xa5, 0xb3, 0x50083, 0x2, 0xb5, 0xb4, 0x9d, 0x50085, 0x2, 0xb6, 0xb5, 0x80, 0x200fe, 0xb6, 0x10038, 0x50036, 0x89, 0x92, 0x0, 0x93, 0x30037, 0x89, 0xb7, 0x30037, 0x91, 0xb8, 0x200f8, 0xb9, 0x4003b, 0xbb, 0xba, 0x7, 0x4003b,
+0xbd, 0xbc, 0x7, 0x4003b, 0xbf, 0xbe, 0x7, 0x4003b, 0xc9, 0xc8, 0x7, 0x4003b, 0xc9, 0xca, 0x7, 0x4003b, 0xc9, 0xcb, 0x7, 0x4003b, 0xc9, 0xcc, 0x7, 0x3003e, 0xba, 0xb7, 0x3003e, 0xbc, 0xb8, 0x3003e, 0xbe, 0xb, 0x200f9, 0xc0, 0x200f8, 0xc0, 0x400f6, 0xc4, 0xc3, 0x0,
+0x200f9, 0xc1, 0x200f8, 0xc1, 0x4003d, 0xa, 0xc5, 0xbe, 0x500b1, 0x25, 0xc7, 0xc5, 0xc6, 0x400fa, 0xc7, 0xc2, 0xc4, 0x200f8, 0xc2, 0x4003d, 0x89, 0xce, 0xba, 0x50051, 0x1, 0xcf, 0xce, 0x0, 0x50097, 0xd1, 0xd0, 0xcd, 0xcf, 0x50051, 0x1, 0xd2, 0xd0, 0x1, 0x3003e, 0xc8,
+0xd2, 0x50051, 0x1, 0xd3, 0xd0, 0x0, 0x3003e, 0xca, 0xd3, 0x4003d, 0x89, 0xd5, 0xba, 0x50051, 0x1, 0xd6, 0xd5, 0x2, 0x50097, 0xd1, 0xd7, 0xd4, 0xd6, 0x50051, 0x1, 0xd8, 0xd7, 0x1, 0x3003e, 0xcb, 0xd8, 0x50051, 0x1, 0xd9, 0xd7, 0x0, 0x3003e, 0xcc, 0xd9, 0x4003d,
+0x1, 0xda, 0xcb, 0x4003d, 0x89, 0xdb, 0xba, 0x50051, 0x1, 0xdc, 0xdb, 0x1, 0x500c6, 0x1, 0xdd, 0xda, 0xdc, 0x4003d, 0x91, 0xde, 0xbc, 0x50051, 0x1, 0xdf, 0xde, 0x0, 0x500c6, 0x1, 0xe0, 0xdd, 0xdf, 0x4003d, 0x1, 0xe1, 0xcc, 0x4003d, 0x1, 0xe2, 0xc8, 0x4003d,
+0x89, 0xe3, 0xba, 0x50051, 0x1, 0xe4, 0xe3, 0x3, 0x500c6, 0x1, 0xe5, 0xe2, 0xe4, 0x4003d, 0x91, 0xe6, 0xbc, 0x50051, 0x1, 0xe7, 0xe6, 0x1, 0x500c6, 0x1, 0xe8, 0xe5, 0xe7, 0x4003d, 0x1, 0xe9, 0xca, 0x70050, 0x89, 0xea, 0xe0, 0xe1, 0xe8, 0xe9, 0x3003e, 0xba,
+0xea, 0x4003d, 0x91, 0xeb, 0xbc, 0x50080, 0x91, 0xef, 0xeb, 0xee, 0x3003e, 0xbc, 0xef, 0x200f9, 0xc3, 0x200f8, 0xc3, 0x4003d, 0xa, 0xf0, 0xbe, 0x50080, 0xa, 0xf1, 0xf0, 0xf, 0x3003e, 0xbe, 0xf1, 0x200f9, 0xc0, 0x200f8, 0xc4, 0x4003d, 0x89, 0xf2, 0xba, 0x200fe, 0xf2, 0x10038,
+};
\ No newline at end of file
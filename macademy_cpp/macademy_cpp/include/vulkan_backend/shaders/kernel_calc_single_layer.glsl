@@ -25,20 +25,21 @@ layout(local_size_x_id = 0, local_size_y = 1, local_size_z = 1) in;
 void main()
 {
     const uint layer_neuron_id = gl_GlobalInvocationID.x;
+    const uint batch_id = gl_GlobalInvocationID.y;
 
-    if (layer_neuron_id >= pc.layer_neuron_count)
+    if (layer_neuron_id >= pc.layer_neuron_count || batch_id >= pc.batch_size)
         return;
 
-    const uint neuron_data_size = pc.weights_per_neuron + 1; //weights in prev layer + 1 bias
-
-    const uint neuron_weights_biases_begin_idx = layer_neuron_id * neuron_data_size;
+    const uint batch_weights_biases_begin_idx = batch_id * pc.weights_batch_stride;
+    const uint neuron_weights_begin_idx = batch_weights_biases_begin_idx + layer_neuron_id * GetRowStride(pc.weights_per_neuron);
+    const uint batch_input_begin_idx = batch_id * pc.weights_per_neuron;
 
     float acc = 0;
     for(uint i = 0; i < pc.weights_per_neuron; ++i)
     {
-        acc += weights_biases[neuron_weights_biases_begin_idx + i] * input_buffer[i];
+        acc += weights_biases[neuron_weights_begin_idx + i] * input_buffer[batch_input_begin_idx + i];
     }
-    acc += weights_biases[neuron_weights_biases_begin_idx + pc.weights_per_neuron]; //bias
+    acc += weights_biases[batch_weights_biases_begin_idx + GetBiasOffset(pc.layer_neuron_count, pc.weights_per_neuron) + layer_neuron_id]; //bias
 
-    output_buffer[layer_neuron_id] = ActivationFunction(pc.activation_function, acc);
+    output_buffer[batch_id * pc.layer_neuron_count + layer_neuron_id] = ActivationFunction(SelectActivationFunction(pc.activation_function), acc);
 }
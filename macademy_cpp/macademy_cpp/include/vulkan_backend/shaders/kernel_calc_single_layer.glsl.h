@@ -1,18 +1,26 @@
-std::array<uint32_t, 678> vulkan_kernel_source_kernel_calc_single_layer_glsl = {0x7230203, 0x10300, 0xd000b, 0xf1, 0x0, 0x20011, 0x1, 0x6000b, 0x1, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x4, 0x6e69616d, 0x0, 0x55, 0x60010, 0x4, 0x11, 0x1, 0x1, 0x1, 0x40047, 0x55, 0xb, 0x1c, 0x50048, 0x5b, 0x0, 0x23, 0x0, 0x50048, 0x5b, 0x1,
-0x23, 0x4, 0x50048, 0x5b, 0x2, 0x23, 0x8, 0x30047, 0x5b, 0x2, 0x40047, 0x79, 0x6, 0x4, 0x40048, 0x7a, 0x0, 0x18, 0x50048, 0x7a, 0x0, 0x23, 0x0, 0x30047, 0x7a, 0x2, 0x40047, 0x7c, 0x22, 0x0, 0x40047, 0x7c, 0x21, 0x0, 0x40047, 0x83, 0x6, 0x4, 0x40048, 0x84,
-0x0, 0x18, 0x50048, 0x84, 0x0, 0x23, 0x0, 0x30047, 0x84, 0x2, 0x40047, 0x86, 0x22, 0x0, 0x40047, 0x86, 0x21, 0x1, 0x40047, 0x97, 0x6, 0x4, 0x40048, 0x98, 0x0, 0x19, 0x50048, 0x98, 0x0, 0x23, 0x0, 0x30047, 0x98, 0x2, 0x40047, 0x9a, 0x22, 0x0, 0x40047, 0x9a,
-0x21, 0x2, 0x40047, 0xa4, 0x1, 0x0, 0x40047, 0xa5, 0xb, 0x19, 0x20013, 0x2, 0x30021, 0x3, 0x2, 0x40015, 0x6, 0x20, 0x0, 0x30016, 0x8, 0x20, 0x4002b, 0x8, 0x1a, 0x3f800000, 0x4002b, 0x8, 0x22, 0x0, 0x20014, 0x23, 0x4002b, 0x8, 0x28, 0x40000000, 0x4002b, 0x8, 0x29, 0xc0000000,
-0x40015, 0x35, 0x20, 0x1, 0x4002b, 0x35, 0x36, 0x0, 0x4002b, 0x35, 0x37, 0x1, 0x4002b, 0x8, 0x40, 0x3c23d70a, 0x40017, 0x53, 0x6, 0x3, 0x40020, 0x54, 0x1, 0x53, 0x4003b, 0x54, 0x55, 0x1, 0x4002b, 0x6, 0x56, 0x0, 0x40020, 0x57, 0x1, 0x6, 0x5001e, 0x5b, 0x6, 0x6,
-0x6, 0x40020, 0x5c, 0x9, 0x5b, 0x4003b, 0x5c, 0x5d, 0x9, 0x40020, 0x5e, 0x9, 0x6, 0x4002b, 0x6, 0x68, 0x1, 0x3001d, 0x79, 0x8, 0x3001e, 0x7a, 0x79, 0x40020, 0x7b, 0xc, 0x7a, 0x4003b, 0x7b, 0x7c, 0xc, 0x40020, 0x80, 0xc, 0x8, 0x3001d, 0x83, 0x8, 0x3001e, 0x84,
-0x83, 0x40020, 0x85, 0xc, 0x84, 0x4003b, 0x85, 0x86, 0xc, 0x3001d, 0x97, 0x8, 0x3001e, 0x98, 0x97, 0x40020, 0x99, 0xc, 0x98, 0x4003b, 0x99, 0x9a, 0xc, 0x4002b, 0x35, 0x9c, 0x2, 0x40032, 0x6, 0xa4, 0x1, 0x60033, 0x53, 0xa5, 0xa4, 0x68, 0x68, 0x50036, 0x2, 0x4,
-0x0, 0x3, 0x200f8, 0x5, 0x300f7, 0xa6, 0x0, 0x300fb, 0x56, 0xa7, 0x200f8, 0xa7, 0x50041, 0x57, 0x58, 0x55, 0x56, 0x4003d, 0x6, 0x59, 0x58, 0x50041, 0x5e, 0x5f, 0x5d, 0x37, 0x4003d, 0x6, 0x60, 0x5f, 0x500ae, 0x23, 0x61, 0x59, 0x60, 0x300f7, 0x63, 0x0, 0x400fa, 0x61,
-0x62, 0x63, 0x200f8, 0x62, 0x200f9, 0xa6, 0x200f8, 0x63, 0x50041, 0x5e, 0x66, 0x5d, 0x36, 0x4003d, 0x6, 0x67, 0x66, 0x50080, 0x6, 0x69, 0x67, 0x68, 0x50084, 0x6, 0x6d, 0x59, 0x69, 0x200f9, 0x70, 0x200f8, 0x70, 0x700f5, 0x8, 0xec, 0x22, 0x63, 0x8c, 0x71, 0x700f5, 0x6,
-0xeb, 0x56, 0x63, 0x8e, 0x71, 0x500b0, 0x23, 0x78, 0xeb, 0x67, 0x400f6, 0x72, 0x71, 0x0, 0x400fa, 0x78, 0x71, 0x72, 0x200f8, 0x71, 0x50080, 0x6, 0x7f, 0x6d, 0xeb, 0x60041, 0x80, 0x81, 0x7c, 0x36, 0x7f, 0x4003d, 0x8, 0x82, 0x81, 0x60041, 0x80, 0x88, 0x86, 0x36,
-0xeb, 0x4003d, 0x8, 0x89, 0x88, 0x50085, 0x8, 0x8a, 0x82, 0x89, 0x50081, 0x8, 0x8c, 0xec, 0x8a, 0x50080, 0x6, 0x8e, 0xeb, 0x37, 0x200f9, 0x70, 0x200f8, 0x72, 0x50080, 0x6, 0x92, 0x6d, 0x67, 0x60041, 0x80, 0x93, 0x7c, 0x36, 0x92, 0x4003d, 0x8, 0x94, 0x93, 0x50081,
-0x8, 0x96, 0xec, 0x94, 0x50041, 0x5e, 0x9e, 0x5d, 0x9c, 0x4003d, 0x6, 0x9f, 0x9e, 0x300f7, 0xe6, 0x0, 0x1300fb, 0x9f, 0xba, 0x0, 0xbb, 0x1, 0xc1, 0x2, 0xc6, 0x4, 0xcd, 0x5, 0xcf, 0x3, 0xd4, 0x6, 0xde, 0x7, 0xe3, 0x200f8, 0xe3, 0x6000c, 0x8, 0xe5,
-0x1, 0x12, 0x96, 0x200f9, 0xe6, 0x200f8, 0xde, 0x6000c, 0x8, 0xe0, 0x1, 0x1b, 0x96, 0x50081, 0x8, 0xe1, 0x1a, 0xe0, 0x6000c, 0x8, 0xe2, 0x1, 0x1c, 0xe1, 0x200f9, 0xe6, 0x200f8, 0xd4, 0x500b8, 0x23, 0xd6, 0x96, 0x22, 0x300f7, 0xdc, 0x0, 0x400fa, 0xd6, 0xd7, 0xda,
-0x200f8, 0xda, 0x200f9, 0xdc, 0x200f8, 0xd7, 0x50085, 0x8, 0xd9, 0x40, 0x96, 0x200f9, 0xdc, 0x200f8, 0xdc, 0x700f5, 0x8, 0xed, 0xd9, 0xd7, 0x96, 0xda, 0x200f9, 0xe6, 0x200f8, 0xcf, 0x500b8, 0x23, 0xd1, 0x96, 0x22, 0x600a9, 0x35, 0xd2, 0xd1, 0x36, 0x37, 0x4006f, 0x8, 0xd3,
-0xd2, 0x200f9, 0xe6, 0x200f8, 0xcd, 0x200f9, 0xe6, 0x200f8, 0xc6, 0x50085, 0x8, 0xc8, 0x29, 0x96, 0x6000c, 0x8, 0xc9, 0x1, 0x1b, 0xc8, 0x50081, 0x8, 0xca, 0x1a, 0xc9, 0x50088, 0x8, 0xcb, 0x28, 0xca, 0x50083, 0x8, 0xcc, 0xcb, 0x1a, 0x200f9, 0xe6, 0x200f8, 0xc1, 0x500b8,
-0x23, 0xc3, 0x96, 0x22, 0x600a9, 0x8, 0xc5, 0xc3, 0x22, 0x96, 0x200f9, 0xe6, 0x200f8, 0xbb, 0x4007f, 0x8, 0xbd, 0x96, 0x6000c, 0x8, 0xbe, 0x1, 0x1b, 0xbd, 0x50081, 0x8, 0xbf, 0x1a, 0xbe, 0x50088, 0x8, 0xc0, 0x1a, 0xbf, 0x200f9, 0xe6, 0x200f8, 0xba, 0x200f9, 0xe6,
-0x200f8, 0xe6, 0x1500f5, 0x8, 0xf0, 0x22, 0xba, 0xc0, 0xbb, 0xc5, 0xc1, 0xcc, 0xc6, 0x96, 0xcd, 0xd3, 0xcf, 0xed, 0xdc, 0xe2, 0xde, 0xe5, 0xe3, 0x60041, 0x80, 0xa3, 0x9a, 0x36, 0x59, 0x3003e, 0xa3, 0xf0, 0x200f9, 0xa6, 0x200f8, 0xa6, 0x100fd, 0x10038,
+std::array<uint32_t, 983> vulkan_kernel_source_kernel_calc_single_layer_glsl = {0x7230203, 0x10300, 0x0, 0xb4, 0x0, 0x20011, 0x1, 0x6000b, 0x9a, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x18, 0x6e69616d, 0x0, 0x1c, 0x60010, 0x18, 0x11, 0x1, 0x1, 0x1, 0x30047, 0x2, 0x2, 0x50048, 0x2, 0x0, 0x23, 0x0, 0x50048, 0x2, 0x1, 0x23,
+0x4, 0x50048, 0x2, 0x2, 0x23, 0x8, 0x50048, 0x2, 0x3, 0x23, 0xc, 0x50048, 0x2, 0x4, 0x23, 0x10, 0x40047, 0x6, 0x6, 0x4, 0x30047, 0x7, 0x2, 0x50048, 0x7, 0x0, 0x23, 0x0, 0x40048, 0x7, 0x0, 0x18, 0x40047, 0x8, 0x22, 0x0, 0x40047, 0x8, 0x21, 0x0,
+0x40047, 0xc, 0x6, 0x4, 0x30047, 0xd, 0x2, 0x50048, 0xd, 0x0, 0x23, 0x0, 0x40048, 0xd, 0x0, 0x18, 0x40047, 0xe, 0x22, 0x0, 0x40047, 0xe, 0x21, 0x1, 0x40047, 0x11, 0x6, 0x4, 0x30047, 0x12, 0x2, 0x50048, 0x12, 0x0, 0x23, 0x0, 0x40048, 0x12, 0x0, 0x19,
+0x40047, 0x13, 0x22, 0x0, 0x40047, 0x13, 0x21, 0x2, 0x40047, 0x17, 0x1, 0x2, 0x40047, 0x1c, 0xb, 0x1c, 0x40047, 0xb2, 0x1, 0x0, 0x40047, 0xb3, 0xb, 0x19, 0x40015, 0x1, 0x20, 0x0, 0x7001e, 0x2, 0x1, 0x1, 0x1, 0x1, 0x1, 0x40020, 0x4, 0x9, 0x2, 0x4003b,
+0x4, 0x3, 0x9, 0x30016, 0x5, 0x20, 0x3001d, 0x6, 0x5, 0x3001e, 0x7, 0x6, 0x40020, 0x9, 0xc, 0x7, 0x4003b, 0x9, 0x8, 0xc, 0x40015, 0xa, 0x20, 0x1, 0x4002b, 0xa, 0xb, 0x0, 0x3001d, 0xc, 0x5, 0x3001e, 0xd, 0xc, 0x40020, 0xf, 0xc, 0xd, 0x4003b, 0xf,
+0xe, 0xc, 0x4002b, 0xa, 0x10, 0x1, 0x3001d, 0x11, 0x5, 0x3001e, 0x12, 0x11, 0x40020, 0x14, 0xc, 0x12, 0x4003b, 0x14, 0x13, 0xc, 0x4002b, 0xa, 0x15, 0x2, 0x4002b, 0x1, 0x16, 0xffffffff, 0x40032, 0x1, 0x17, 0xffffffff, 0x20013, 0x19, 0x30021, 0x1a, 0x19, 0x40017, 0x1d, 0x1,
+0x3, 0x40020, 0x1e, 0x1, 0x1d, 0x4003b, 0x1e, 0x1c, 0x1, 0x40020, 0x24, 0x9, 0x1, 0x20014, 0x27, 0x4002b, 0xa, 0x28, 0x3, 0x4002b, 0xa, 0x2f, 0x4, 0x40021, 0x36, 0x1, 0x1, 0x4002b, 0x5, 0x3d, 0x0, 0x40020, 0x3f, 0x7, 0x5, 0x4002b, 0x1, 0x40, 0x0, 0x40020,
+0x42, 0x7, 0x1, 0x40020, 0x50, 0xc, 0x5, 0x4002b, 0x1, 0x59, 0x1, 0x50021, 0x61, 0x1, 0x1, 0x1, 0x50021, 0x72, 0x5, 0x1, 0x5, 0x4002b, 0xa, 0x77, 0x10, 0x4002b, 0x1, 0x78, 0x10, 0x4002b, 0xa, 0x94, 0x5, 0x4002b, 0xa, 0x95, 0x6, 0x4002b, 0xa, 0x96,
+0x7, 0x4002b, 0xa, 0x97, 0x8, 0x4002b, 0x5, 0x98, 0x3f800000, 0x4002b, 0x5, 0xa0, 0x40000000, 0x4002b, 0x5, 0xa1, 0xc0000000, 0x4002b, 0x5, 0xab, 0x3c23d70a, 0x40032, 0x1, 0xb2, 0x1, 0x60033, 0x1d, 0xb3, 0xb2, 0x59, 0x59, 0x50036, 0x19, 0x18, 0x0, 0x1a, 0x200f8, 0x1b, 0x4003b, 0x3f,
+0x3e, 0x7, 0x4003b, 0x42, 0x41, 0x7, 0x4003d, 0x1d, 0x1f, 0x1c, 0x50051, 0x1, 0x20, 0x1f, 0x0, 0x4003d, 0x1d, 0x21, 0x1c, 0x50051, 0x1, 0x22, 0x21, 0x1, 0x50041, 0x24, 0x23, 0x3, 0x10, 0x4003d, 0x1, 0x25, 0x23, 0x500ae, 0x27, 0x26, 0x20, 0x25, 0x50041, 0x24,
+0x29, 0x3, 0x28, 0x4003d, 0x1, 0x2a, 0x29, 0x500ae, 0x27, 0x2b, 0x22, 0x2a, 0x500a6, 0x27, 0x2c, 0x26, 0x2b, 0x300f7, 0x2d, 0x0, 0x400fa, 0x2c, 0x2e, 0x2d, 0x200f8, 0x2e, 0x100fd, 0x200f8, 0x2d, 0x50041, 0x24, 0x30, 0x3, 0x2f, 0x4003d, 0x1, 0x31, 0x30, 0x50084, 0x1,
+0x32, 0x22, 0x31, 0x50041, 0x24, 0x33, 0x3, 0xb, 0x4003d, 0x1, 0x34, 0x33, 0x50039, 0x1, 0x37, 0x35, 0x34, 0x50084, 0x1, 0x38, 0x20, 0x37, 0x50080, 0x1, 0x39, 0x32, 0x38, 0x50041, 0x24, 0x3a, 0x3, 0xb, 0x4003d, 0x1, 0x3b, 0x3a, 0x50084, 0x1, 0x3c, 0x22,
+0x3b, 0x3003e, 0x3e, 0x3d, 0x3003e, 0x41, 0x40, 0x200f9, 0x43, 0x200f8, 0x43, 0x400f6, 0x47, 0x46, 0x0, 0x200f9, 0x44, 0x200f8, 0x44, 0x4003d, 0x1, 0x48, 0x41, 0x50041, 0x24, 0x49, 0x3, 0xb, 0x4003d, 0x1, 0x4a, 0x49, 0x500b0, 0x27, 0x4b, 0x48, 0x4a, 0x400fa, 0x4b, 0x45,
+0x47, 0x200f8, 0x45, 0x4003d, 0x5, 0x4c, 0x3e, 0x4003d, 0x1, 0x4d, 0x41, 0x50080, 0x1, 0x4e, 0x39, 0x4d, 0x60041, 0x50, 0x4f, 0x8, 0xb, 0x4e, 0x4003d, 0x5, 0x51, 0x4f, 0x4003d, 0x1, 0x52, 0x41, 0x50080, 0x1, 0x53, 0x3c, 0x52, 0x60041, 0x50, 0x54, 0xe, 0xb,
+0x53, 0x4003d, 0x5, 0x55, 0x54, 0x50085, 0x5, 0x56, 0x51, 0x55, 0x50081, 0x5, 0x57, 0x4c, 0x56, 0x3003e, 0x3e, 0x57, 0x200f9, 0x46, 0x200f8, 0x46, 0x4003d, 0x1, 0x58, 0x41, 0x50080, 0x1, 0x5a, 0x58, 0x59, 0x3003e, 0x41, 0x5a, 0x200f9, 0x43, 0x200f8, 0x47, 0x4003d, 0x5,
+0x5b, 0x3e, 0x50041, 0x24, 0x5c, 0x3, 0x10, 0x4003d, 0x1, 0x5d, 0x5c, 0x50041, 0x24, 0x5e, 0x3, 0xb, 0x4003d, 0x1, 0x5f, 0x5e, 0x60039, 0x1, 0x62, 0x60, 0x5d, 0x5f, 0x50080, 0x1, 0x63, 0x32, 0x62, 0x50080, 0x1, 0x64, 0x63, 0x20, 0x60041, 0x50, 0x65, 0x8,
+0xb, 0x64, 0x4003d, 0x5, 0x66, 0x65, 0x50081, 0x5, 0x67, 0x5b, 0x66, 0x3003e, 0x3e, 0x67, 0x50041, 0x24, 0x68, 0x3, 0x10, 0x4003d, 0x1, 0x69, 0x68, 0x50084, 0x1, 0x6a, 0x22, 0x69, 0x50080, 0x1, 0x6b, 0x6a, 0x20, 0x50041, 0x24, 0x6c, 0x3, 0x15, 0x4003d, 0x1,
+0x6d, 0x6c, 0x50039, 0x1, 0x6f, 0x6e, 0x6d, 0x4003d, 0x5, 0x70, 0x3e, 0x60039, 0x5, 0x73, 0x71, 0x6f, 0x70, 0x60041, 0x50, 0x74, 0x13, 0xb, 0x6b, 0x3003e, 0x74, 0x73, 0x100fd, 0x10038, 0x50036, 0x1, 0x35, 0x0, 0x36, 0x30037, 0x1, 0x75, 0x200f8, 0x76, 0x50080, 0x1,
+0x79, 0x75, 0x78, 0x50082, 0x1, 0x7a, 0x79, 0x59, 0x50086, 0x1, 0x7b, 0x7a, 0x78, 0x50084, 0x1, 0x7c, 0x7b, 0x78, 0x200fe, 0x7c, 0x10038, 0x50036, 0x1, 0x60, 0x0, 0x61, 0x30037, 0x1, 0x7d, 0x30037, 0x1, 0x7e, 0x200f8, 0x7f, 0x50039, 0x1, 0x80, 0x35, 0x7e, 0x50084,
+0x1, 0x81, 0x7d, 0x80, 0x200fe, 0x81, 0x10038, 0x50036, 0x1, 0x6e, 0x0, 0x36, 0x30037, 0x1, 0x82, 0x200f8, 0x83, 0x500ab, 0x27, 0x84, 0x17, 0x16, 0x600a9, 0x1, 0x85, 0x84, 0x17, 0x82, 0x200fe, 0x85, 0x10038, 0x50036, 0x5, 0x71, 0x0, 0x72, 0x30037, 0x1, 0x86, 0x30037,
+0x5, 0x87, 0x200f8, 0x88, 0x300f7, 0x89, 0x0, 0x1500fb, 0x86, 0x93, 0x0, 0x8a, 0x1, 0x8b, 0x2, 0x8c, 0x4, 0x8d, 0x5, 0x8e, 0x3, 0x8f, 0x6, 0x90, 0x7, 0x91, 0x8, 0x92, 0x200f8, 0x8a, 0x4007f, 0x5, 0x99, 0x87, 0x6000c, 0x5, 0x9b, 0x9a, 0x1b, 0x99,
+0x50081, 0x5, 0x9c, 0x98, 0x9b, 0x50088, 0x5, 0x9d, 0x98, 0x9c, 0x200fe, 0x9d, 0x200f8, 0x8b, 0x500b8, 0x27, 0x9e, 0x87, 0x3d, 0x600a9, 0x5, 0x9f, 0x9e, 0x3d, 0x87, 0x200fe, 0x9f, 0x200f8, 0x8c, 0x50085, 0x5, 0xa2, 0xa1, 0x87, 0x6000c, 0x5, 0xa3, 0x9a, 0x1b, 0xa2,
+0x50081, 0x5, 0xa4, 0x98, 0xa3, 0x50088, 0x5, 0xa5, 0xa0, 0xa4, 0x50083, 0x5, 0xa6, 0xa5, 0x98, 0x200fe, 0xa6, 0x200f8, 0x8d, 0x200fe, 0x87, 0x200f8, 0x8e, 0x500b8, 0x27, 0xa7, 0x87, 0x3d, 0x600a9, 0xa, 0xa8, 0xa7, 0xb, 0x10, 0x4006f, 0x5, 0xa9, 0xa8, 0x200fe, 0xa9,
+0x200f8, 0x8f, 0x500b8, 0x27, 0xaa, 0x87, 0x3d, 0x50085, 0x5, 0xac, 0xab, 0x87, 0x600a9, 0x5, 0xad, 0xaa, 0xac, 0x87, 0x200fe, 0xad, 0x200f8, 0x90, 0x6000c, 0x5, 0xae, 0x9a, 0x1b, 0x87, 0x50081, 0x5, 0xaf, 0x98, 0xae, 0x6000c, 0x5, 0xb0, 0x9a, 0x1c, 0xaf, 0x200fe,
+0xb0, 0x200f8, 0x91, 0x6000c, 0x5, 0xb1, 0x9a, 0x12, 0x87, 0x200fe, 0xb1, 0x200f8, 0x92, 0x200fe, 0x87, 0x200f8, 0x93, 0x200fe, 0x3d, 0x200f8, 0x89, 0x100ff, 0x10038,
 };
\ No newline at end of file
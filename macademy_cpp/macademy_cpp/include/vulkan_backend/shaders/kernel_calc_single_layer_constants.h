@@ -12,6 +12,8 @@ layout(push_constant) uniform constants_
     uint weights_per_neuron;
     uint layer_neuron_count;
     uint activation_function;
+    uint batch_size;
+    uint weights_batch_stride;
 
 #ifdef VK_CONSTANTS_HOST
 };
@@ -0,0 +1,46 @@
+#version 460
+///
+/// Vulkan kernels implementing network calculations, and backpropagation
+///
+
+#define VK_CONSTANTS_GLSL
+#include "kernel_crossover_constants.h"
+
+layout(std430, binding = 0) readonly buffer parents_buf {
+   float parents[];
+};
+
+layout(std430, binding = 1) writeonly buffer children_buf {
+   float children[];
+};
+
+layout(std430, binding = 2) readonly buffer parent_ids_buf {
+   uint parent_ids[];
+};
+
+#include "common.glsl"
+
+layout(local_size_x_id = 0, local_size_y = 1, local_size_z = 1) in;
+
+void main()
+{
+    const uint element_id = gl_GlobalInvocationID.x;
+    const uint tensor_stride = GetTensorStride(pc.layer_neuron_count, pc.weights_per_neuron);
+    const uint bias_offset = GetBiasOffset(pc.layer_neuron_count, pc.weights_per_neuron);
+
+    if (element_id >= pc.children_count * tensor_stride)
+        return;
+
+    const uint child_id = element_id / tensor_stride;
+    const uint tensor_element_id = element_id % tensor_stride;
+
+    if (tensor_element_id >= GetTensorElementCount(pc.layer_neuron_count, pc.weights_per_neuron))
+        return; // padding between the tensors
+    const uint neuron_id = tensor_element_id >= bias_offset ? tensor_element_id - bias_offset : tensor_element_id / GetRowStride(pc.weights_per_neuron);
+
+    // Every neuron of a child inherits its weights and bias from one of its two parents, chosen by a random bit
+    const uvec4 random = philox4x32_10(uvec4(neuron_id, pc.stream, child_id, 0), uvec2(pc.seed_lo, pc.seed_hi));
+    const uint parent_id = parent_ids[child_id * 2 + (random.x & 1)];
+
+    children[element_id] = parents[parent_id * tensor_stride + tensor_element_id];
+}
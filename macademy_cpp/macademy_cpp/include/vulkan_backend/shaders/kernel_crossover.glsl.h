@@ -0,0 +1,28 @@
+std::array<uint32_t, 1069> vulkan_kernel_source_kernel_crossover_glsl = {0x7230203, 0x10300, 0x0, 0xc6, 0x0, 0x20011, 0x1, 0x6000b, 0xc3, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x18, 0x6e69616d, 0x0, 0x1c, 0x60010, 0x18, 0x11, 0x1, 0x1, 0x1, 0x30047, 0x2, 0x2, 0x50048, 0x2, 0x0, 0x23, 0x0, 0x50048, 0x2, 0x1, 0x23,
+0x4, 0x50048, 0x2, 0x2, 0x23, 0x8, 0x50048, 0x2, 0x3, 0x23, 0xc, 0x50048, 0x2, 0x4, 0x23, 0x10, 0x50048, 0x2, 0x5, 0x23, 0x14, 0x40047, 0x6, 0x6, 0x4, 0x30047, 0x7, 0x2, 0x50048, 0x7, 0x0, 0x23, 0x0, 0x40048, 0x7, 0x0, 0x18, 0x40047, 0x8, 0x22,
+0x0, 0x40047, 0x8, 0x21, 0x0, 0x40047, 0xc, 0x6, 0x4, 0x30047, 0xd, 0x2, 0x50048, 0xd, 0x0, 0x23, 0x0, 0x40048, 0xd, 0x0, 0x19, 0x40047, 0xe, 0x22, 0x0, 0x40047, 0xe, 0x21, 0x1, 0x40047, 0x11, 0x6, 0x4, 0x30047, 0x12, 0x2, 0x50048, 0x12, 0x0, 0x23,
+0x0, 0x40048, 0x12, 0x0, 0x18, 0x40047, 0x13, 0x22, 0x0, 0x40047, 0x13, 0x21, 0x2, 0x40047, 0x17, 0x1, 0x2, 0x40047, 0x1c, 0xb, 0x1c, 0x40047, 0xc4, 0x1, 0x0, 0x40047, 0xc5, 0xb, 0x19, 0x40015, 0x1, 0x20, 0x0, 0x8001e, 0x2, 0x1, 0x1, 0x1, 0x1, 0x1,
+0x1, 0x40020, 0x4, 0x9, 0x2, 0x4003b, 0x4, 0x3, 0x9, 0x30016, 0x5, 0x20, 0x3001d, 0x6, 0x5, 0x3001e, 0x7, 0x6, 0x40020, 0x9, 0xc, 0x7, 0x4003b, 0x9, 0x8, 0xc, 0x40015, 0xa, 0x20, 0x1, 0x4002b, 0xa, 0xb, 0x0, 0x3001d, 0xc, 0x5, 0x3001e, 0xd, 0xc,
+0x40020, 0xf, 0xc, 0xd, 0x4003b, 0xf, 0xe, 0xc, 0x4002b, 0xa, 0x10, 0x1, 0x3001d, 0x11, 0x1, 0x3001e, 0x12, 0x11, 0x40020, 0x14, 0xc, 0x12, 0x4003b, 0x14, 0x13, 0xc, 0x4002b, 0xa, 0x15, 0x2, 0x4002b, 0x1, 0x16, 0xffffffff, 0x40032, 0x1, 0x17, 0xffffffff, 0x20013, 0x19,
+0x30021, 0x1a, 0x19, 0x40017, 0x1d, 0x1, 0x3, 0x40020, 0x1e, 0x1, 0x1d, 0x4003b, 0x1e, 0x1c, 0x1, 0x40020, 0x22, 0x9, 0x1, 0x50021, 0x27, 0x1, 0x1, 0x1, 0x20014, 0x33, 0x40021, 0x49, 0x1, 0x1, 0x4002b, 0xa, 0x4d, 0x5, 0x4002b, 0x1, 0x50, 0x0, 0x40017, 0x52,
+0x1, 0x4, 0x4002b, 0xa, 0x53, 0x3, 0x4002b, 0xa, 0x56, 0x4, 0x40017, 0x5a, 0x1, 0x2, 0x50021, 0x5c, 0x52, 0x52, 0x5a, 0x4002b, 0x1, 0x5e, 0x2, 0x4002b, 0x1, 0x61, 0x1, 0x40020, 0x65, 0xc, 0x1, 0x40020, 0x6a, 0xc, 0x5, 0x4002b, 0xa, 0x71, 0x10, 0x4002b,
+0x1, 0x72, 0x10, 0x40020, 0x8b, 0x7, 0x52, 0x40020, 0x8d, 0x7, 0x5a, 0x40020, 0x8f, 0x7, 0xa, 0x4002b, 0xa, 0x96, 0xa, 0x40020, 0x99, 0x7, 0x1, 0x4002b, 0x1, 0x9d, 0xd2511f53, 0x4001e, 0xa1, 0x1, 0x1, 0x4002b, 0x1, 0xa4, 0xcd9e8d57, 0x4002b, 0x1, 0xbc, 0x9e3779b9, 0x4002b,
+0x1, 0xbd, 0xbb67ae85, 0x5002c, 0x5a, 0xbe, 0xbc, 0xbd, 0x40032, 0x1, 0xc4, 0x1, 0x60033, 0x1d, 0xc5, 0xc4, 0x61, 0x61, 0x50036, 0x19, 0x18, 0x0, 0x1a, 0x200f8, 0x1b, 0x4003d, 0x1d, 0x1f, 0x1c, 0x50051, 0x1, 0x20, 0x1f, 0x0, 0x50041, 0x22, 0x21, 0x3, 0xb, 0x4003d,
+0x1, 0x23, 0x21, 0x50041, 0x22, 0x24, 0x3, 0x10, 0x4003d, 0x1, 0x25, 0x24, 0x60039, 0x1, 0x28, 0x26, 0x23, 0x25, 0x50041, 0x22, 0x29, 0x3, 0xb, 0x4003d, 0x1, 0x2a, 0x29, 0x50041, 0x22, 0x2b, 0x3, 0x10, 0x4003d, 0x1, 0x2c, 0x2b, 0x60039, 0x1, 0x2e, 0x2d,
+0x2a, 0x2c, 0x50041, 0x22, 0x2f, 0x3, 0x15, 0x4003d, 0x1, 0x30, 0x2f, 0x50084, 0x1, 0x31, 0x30, 0x28, 0x500ae, 0x33, 0x32, 0x20, 0x31, 0x300f7, 0x34, 0x0, 0x400fa, 0x32, 0x35, 0x34, 0x200f8, 0x35, 0x100fd, 0x200f8, 0x34, 0x50086, 0x1, 0x36, 0x20, 0x28, 0x50089, 0x1,
+0x37, 0x20, 0x28, 0x50041, 0x22, 0x38, 0x3, 0xb, 0x4003d, 0x1, 0x39, 0x38, 0x50041, 0x22, 0x3a, 0x3, 0x10, 0x4003d, 0x1, 0x3b, 0x3a, 0x60039, 0x1, 0x3d, 0x3c, 0x39, 0x3b, 0x500ae, 0x33, 0x3e, 0x37, 0x3d, 0x300f7, 0x3f, 0x0, 0x400fa, 0x3e, 0x40, 0x3f, 0x200f8,
+0x40, 0x100fd, 0x200f8, 0x3f, 0x500ae, 0x33, 0x41, 0x37, 0x2e, 0x300f7, 0x44, 0x0, 0x400fa, 0x41, 0x42, 0x43, 0x200f8, 0x42, 0x50082, 0x1, 0x45, 0x37, 0x2e, 0x200f9, 0x44, 0x200f8, 0x43, 0x50041, 0x22, 0x46, 0x3, 0x10, 0x4003d, 0x1, 0x47, 0x46, 0x50039, 0x1, 0x4a, 0x48,
+0x47, 0x50086, 0x1, 0x4b, 0x37, 0x4a, 0x200f9, 0x44, 0x200f8, 0x44, 0x700f5, 0x1, 0x4c, 0x45, 0x42, 0x4b, 0x43, 0x50041, 0x22, 0x4e, 0x3, 0x4d, 0x4003d, 0x1, 0x4f, 0x4e, 0x70050, 0x52, 0x51, 0x4c, 0x4f, 0x36, 0x50, 0x50041, 0x22, 0x54, 0x3, 0x53, 0x4003d, 0x1,
+0x55, 0x54, 0x50041, 0x22, 0x57, 0x3, 0x56, 0x4003d, 0x1, 0x58, 0x57, 0x50050, 0x5a, 0x59, 0x55, 0x58, 0x60039, 0x52, 0x5d, 0x5b, 0x51, 0x59, 0x50084, 0x1, 0x5f, 0x36, 0x5e, 0x50051, 0x1, 0x60, 0x5d, 0x0, 0x500c7, 0x1, 0x62, 0x60, 0x61, 0x50080, 0x1, 0x63,
+0x5f, 0x62, 0x60041, 0x65, 0x64, 0x13, 0xb, 0x63, 0x4003d, 0x1, 0x66, 0x64, 0x50084, 0x1, 0x67, 0x66, 0x28, 0x50080, 0x1, 0x68, 0x67, 0x37, 0x60041, 0x6a, 0x69, 0x8, 0xb, 0x68, 0x4003d, 0x5, 0x6b, 0x69, 0x60041, 0x6a, 0x6c, 0xe, 0xb, 0x20, 0x3003e, 0x6c,
+0x6b, 0x100fd, 0x10038, 0x50036, 0x1, 0x26, 0x0, 0x27, 0x30037, 0x1, 0x6d, 0x30037, 0x1, 0x6e, 0x200f8, 0x6f, 0x60039, 0x1, 0x70, 0x3c, 0x6d, 0x6e, 0x50080, 0x1, 0x73, 0x70, 0x72, 0x50082, 0x1, 0x74, 0x73, 0x61, 0x50086, 0x1, 0x75, 0x74, 0x72, 0x50084, 0x1, 0x76,
+0x75, 0x72, 0x200fe, 0x76, 0x10038, 0x50036, 0x1, 0x2d, 0x0, 0x27, 0x30037, 0x1, 0x77, 0x30037, 0x1, 0x78, 0x200f8, 0x79, 0x50039, 0x1, 0x7a, 0x48, 0x78, 0x50084, 0x1, 0x7b, 0x77, 0x7a, 0x200fe, 0x7b, 0x10038, 0x50036, 0x1, 0x3c, 0x0, 0x27, 0x30037, 0x1, 0x7c, 0x30037,
+0x1, 0x7d, 0x200f8, 0x7e, 0x60039, 0x1, 0x7f, 0x2d, 0x7c, 0x7d, 0x50080, 0x1, 0x80, 0x7f, 0x7c, 0x200fe, 0x80, 0x10038, 0x50036, 0x1, 0x48, 0x0, 0x49, 0x30037, 0x1, 0x81, 0x200f8, 0x82, 0x50080, 0x1, 0x83, 0x81, 0x72, 0x50082, 0x1, 0x84, 0x83, 0x61, 0x50086, 0x1,
+0x85, 0x84, 0x72, 0x50084, 0x1, 0x86, 0x85, 0x72, 0x200fe, 0x86, 0x10038, 0x50036, 0x52, 0x5b, 0x0, 0x5c, 0x30037, 0x52, 0x87, 0x30037, 0x5a, 0x88, 0x200f8, 0x89, 0x4003b, 0x8b, 0x8a, 0x7, 0x4003b, 0x8d, 0x8c, 0x7, 0x4003b, 0x8f, 0x8e, 0x7, 0x4003b, 0x99, 0x98, 0x7,
+0x4003b, 0x99, 0x9a, 0x7, 0x4003b, 0x99, 0x9b, 0x7, 0x4003b, 0x99, 0x9c, 0x7, 0x3003e, 0x8a, 0x87, 0x3003e, 0x8c, 0x88, 0x3003e, 0x8e, 0xb, 0x200f9, 0x90, 0x200f8, 0x90, 0x400f6, 0x94, 0x93, 0x0, 0x200f9, 0x91, 0x200f8, 0x91, 0x4003d, 0xa, 0x95, 0x8e, 0x500b1, 0x33, 0x97,
+0x95, 0x96, 0x400fa, 0x97, 0x92, 0x94, 0x200f8, 0x92, 0x4003d, 0x52, 0x9e, 0x8a, 0x50051, 0x1, 0x9f, 0x9e, 0x0, 0x50097, 0xa1, 0xa0, 0x9d, 0x9f, 0x50051, 0x1, 0xa2, 0xa0, 0x1, 0x3003e, 0x98, 0xa2, 0x50051, 0x1, 0xa3, 0xa0, 0x0, 0x3003e, 0x9a, 0xa3, 0x4003d, 0x52,
+0xa5, 0x8a, 0x50051, 0x1, 0xa6, 0xa5, 0x2, 0x50097, 0xa1, 0xa7, 0xa4, 0xa6, 0x50051, 0x1, 0xa8, 0xa7, 0x1, 0x3003e, 0x9b, 0xa8, 0x50051, 0x1, 0xa9, 0xa7, 0x0, 0x3003e, 0x9c, 0xa9, 0x4003d, 0x1, 0xaa, 0x9b, 0x4003d, 0x52, 0xab, 0x8a, 0x50051, 0x1, 0xac, 0xab,
+0x1, 0x500c6, 0x1, 0xad, 0xaa, 0xac, 0x4003d, 0x5a, 0xae, 0x8c, 0x50051, 0x1, 0xaf, 0xae, 0x0, 0x500c6, 0x1, 0xb0, 0xad, 0xaf, 0x4003d, 0x1, 0xb1, 0x9c, 0x4003d, 0x1, 0xb2, 0x98, 0x4003d, 0x52, 0xb3, 0x8a, 0x50051, 0x1, 0xb4, 0xb3, 0x3, 0x500c6, 0x1, 0xb5,
+0xb2, 0xb4, 0x4003d, 0x5a, 0xb6, 0x8c, 0x50051, 0x1, 0xb7, 0xb6, 0x1, 0x500c6, 0x1, 0xb8, 0xb5, 0xb7, 0x4003d, 0x1, 0xb9, 0x9a, 0x70050, 0x52, 0xba, 0xb0, 0xb1, 0xb8, 0xb9, 0x3003e, 0x8a, 0xba, 0x4003d, 0x5a, 0xbb, 0x8c, 0x50080, 0x5a, 0xbf, 0xbb, 0xbe, 0x3003e,
+0x8c, 0xbf, 0x200f9, 0x93, 0x200f8, 0x93, 0x4003d, 0xa, 0xc0, 0x8e, 0x50080, 0xa, 0xc1, 0xc0, 0x10, 0x3003e, 0x8e, 0xc1, 0x200f9, 0x90, 0x200f8, 0x94, 0x4003d, 0x52, 0xc2, 0x8a, 0x200fe, 0xc2, 0x10038,
+};
\ No newline at end of file
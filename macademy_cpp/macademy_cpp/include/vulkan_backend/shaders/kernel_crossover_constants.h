@@ -0,0 +1,25 @@
+
+
+#ifdef VK_CONSTANTS_HOST
+struct CrossoverPushConstantData
+{
+#define uint uint32_t
+#elif defined VK_CONSTANTS_GLSL
+layout(push_constant) uniform constants_
+{
+#endif
+
+    uint layer_neuron_count;
+    uint weights_per_neuron;
+    uint children_count;
+    uint seed_lo;
+    uint seed_hi;
+    uint stream;
+
+#ifdef VK_CONSTANTS_HOST
+};
+#undef uint
+#elif defined VK_CONSTANTS_GLSL
+}
+pc;
+#endif
\ No newline at end of file
@@ -0,0 +1,42 @@
+#version 460
+///
+/// Vulkan kernels implementing network calculations, and backpropagation
+///
+
+#define VK_CONSTANTS_GLSL
+#include "kernel_softmax_constants.h"
+
+layout(std430, binding = 0) buffer values_buf {
+   float values[];
+};
+
+layout(local_size_x_id = 0, local_size_y = 1, local_size_z = 1) in;
+
+// Normalizes every row of the values with softmax, one invocation per row
+void main()
+{
+    const uint row_id = gl_GlobalInvocationID.x;
+
+    if (row_id >= pc.row_count)
+        return;
+
+    const uint row_offset = row_id * pc.row_length;
+
+    // Subtracting the maximum doesn't change the result, but avoids the overflow of exp
+    float max_value = values[row_offset];
+    for (uint i = 1; i < pc.row_length; ++i) {
+        max_value = max(max_value, values[row_offset + i]);
+    }
+
+    float sum = 0.0f;
+    for (uint i = 0; i < pc.row_length; ++i) {
+        const float e = exp(values[row_offset + i] - max_value);
+        values[row_offset + i] = e;
+        sum += e;
+    }
+
+    const float scale = 1.0f / sum;
+    for (uint i = 0; i < pc.row_length; ++i) {
+        values[row_offset + i] *= scale;
+    }
+}
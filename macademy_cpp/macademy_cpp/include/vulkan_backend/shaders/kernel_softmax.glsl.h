@@ -0,0 +1,16 @@
+std::array<uint32_t, 589> vulkan_kernel_source_kernel_softmax_glsl = {0x7230203, 0x10300, 0x0, 0x6c, 0x0, 0x20011, 0x1, 0x6000b, 0x36, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0xd, 0x6e69616d, 0x0, 0x11, 0x60010, 0xd, 0x11, 0x1, 0x1, 0x1, 0x30047, 0x2, 0x2, 0x50048, 0x2, 0x0, 0x23, 0x0, 0x50048, 0x2, 0x1, 0x23,
+0x4, 0x40047, 0x6, 0x6, 0x4, 0x30047, 0x7, 0x2, 0x50048, 0x7, 0x0, 0x23, 0x0, 0x40047, 0x8, 0x22, 0x0, 0x40047, 0x8, 0x21, 0x0, 0x40047, 0x11, 0xb, 0x1c, 0x40047, 0x6a, 0x1, 0x0, 0x40047, 0x6b, 0xb, 0x19, 0x40015, 0x1, 0x20, 0x0, 0x4001e, 0x2, 0x1,
+0x1, 0x40020, 0x4, 0x9, 0x2, 0x4003b, 0x4, 0x3, 0x9, 0x30016, 0x5, 0x20, 0x3001d, 0x6, 0x5, 0x3001e, 0x7, 0x6, 0x40020, 0x9, 0xc, 0x7, 0x4003b, 0x9, 0x8, 0xc, 0x40015, 0xa, 0x20, 0x1, 0x4002b, 0xa, 0xb, 0x0, 0x4002b, 0xa, 0xc, 0x1, 0x20013, 0xe,
+0x30021, 0xf, 0xe, 0x40017, 0x12, 0x1, 0x3, 0x40020, 0x13, 0x1, 0x12, 0x4003b, 0x13, 0x11, 0x1, 0x40020, 0x17, 0x9, 0x1, 0x20014, 0x1a, 0x40020, 0x21, 0xc, 0x5, 0x40020, 0x24, 0x7, 0x5, 0x4002b, 0x1, 0x25, 0x1, 0x40020, 0x27, 0x7, 0x1, 0x4002b, 0x5, 0x3a,
+0x0, 0x4002b, 0x1, 0x3c, 0x0, 0x4002b, 0x5, 0x55, 0x3f800000, 0x40032, 0x1, 0x6a, 0x1, 0x60033, 0x12, 0x6b, 0x6a, 0x25, 0x25, 0x50036, 0xe, 0xd, 0x0, 0xf, 0x200f8, 0x10, 0x4003b, 0x24, 0x23, 0x7, 0x4003b, 0x27, 0x26, 0x7, 0x4003b, 0x24, 0x3b, 0x7, 0x4003b, 0x27,
+0x3d, 0x7, 0x4003b, 0x27, 0x58, 0x7, 0x4003d, 0x12, 0x14, 0x11, 0x50051, 0x1, 0x15, 0x14, 0x0, 0x50041, 0x17, 0x16, 0x3, 0xc, 0x4003d, 0x1, 0x18, 0x16, 0x500ae, 0x1a, 0x19, 0x15, 0x18, 0x300f7, 0x1b, 0x0, 0x400fa, 0x19, 0x1c, 0x1b, 0x200f8, 0x1c, 0x100fd, 0x200f8,
+0x1b, 0x50041, 0x17, 0x1d, 0x3, 0xb, 0x4003d, 0x1, 0x1e, 0x1d, 0x50084, 0x1, 0x1f, 0x15, 0x1e, 0x60041, 0x21, 0x20, 0x8, 0xb, 0x1f, 0x4003d, 0x5, 0x22, 0x20, 0x3003e, 0x23, 0x22, 0x3003e, 0x26, 0x25, 0x200f9, 0x28, 0x200f8, 0x28, 0x400f6, 0x2c, 0x2b, 0x0, 0x200f9,
+0x29, 0x200f8, 0x29, 0x4003d, 0x1, 0x2d, 0x26, 0x50041, 0x17, 0x2e, 0x3, 0xb, 0x4003d, 0x1, 0x2f, 0x2e, 0x500b0, 0x1a, 0x30, 0x2d, 0x2f, 0x400fa, 0x30, 0x2a, 0x2c, 0x200f8, 0x2a, 0x4003d, 0x5, 0x31, 0x23, 0x4003d, 0x1, 0x32, 0x26, 0x50080, 0x1, 0x33, 0x1f, 0x32,
+0x60041, 0x21, 0x34, 0x8, 0xb, 0x33, 0x4003d, 0x5, 0x35, 0x34, 0x7000c, 0x5, 0x37, 0x36, 0x28, 0x31, 0x35, 0x3003e, 0x23, 0x37, 0x200f9, 0x2b, 0x200f8, 0x2b, 0x4003d, 0x1, 0x38, 0x26, 0x50080, 0x1, 0x39, 0x38, 0x25, 0x3003e, 0x26, 0x39, 0x200f9, 0x28, 0x200f8, 0x2c,
+0x3003e, 0x3b, 0x3a, 0x3003e, 0x3d, 0x3c, 0x200f9, 0x3e, 0x200f8, 0x3e, 0x400f6, 0x42, 0x41, 0x0, 0x200f9, 0x3f, 0x200f8, 0x3f, 0x4003d, 0x1, 0x43, 0x3d, 0x50041, 0x17, 0x44, 0x3, 0xb, 0x4003d, 0x1, 0x45, 0x44, 0x500b0, 0x1a, 0x46, 0x43, 0x45, 0x400fa, 0x46, 0x40, 0x42,
+0x200f8, 0x40, 0x4003d, 0x1, 0x47, 0x3d, 0x50080, 0x1, 0x48, 0x1f, 0x47, 0x60041, 0x21, 0x49, 0x8, 0xb, 0x48, 0x4003d, 0x5, 0x4a, 0x49, 0x4003d, 0x5, 0x4b, 0x23, 0x50083, 0x5, 0x4c, 0x4a, 0x4b, 0x6000c, 0x5, 0x4d, 0x36, 0x1b, 0x4c, 0x4003d, 0x1, 0x4e, 0x3d,
+0x50080, 0x1, 0x4f, 0x1f, 0x4e, 0x60041, 0x21, 0x50, 0x8, 0xb, 0x4f, 0x3003e, 0x50, 0x4d, 0x4003d, 0x5, 0x51, 0x3b, 0x50081, 0x5, 0x52, 0x51, 0x4d, 0x3003e, 0x3b, 0x52, 0x200f9, 0x41, 0x200f8, 0x41, 0x4003d, 0x1, 0x53, 0x3d, 0x50080, 0x1, 0x54, 0x53, 0x25, 0x3003e,
+0x3d, 0x54, 0x200f9, 0x3e, 0x200f8, 0x42, 0x4003d, 0x5, 0x56, 0x3b, 0x50088, 0x5, 0x57, 0x55, 0x56, 0x3003e, 0x58, 0x3c, 0x200f9, 0x59, 0x200f8, 0x59, 0x400f6, 0x5d, 0x5c, 0x0, 0x200f9, 0x5a, 0x200f8, 0x5a, 0x4003d, 0x1, 0x5e, 0x58, 0x50041, 0x17, 0x5f, 0x3, 0xb, 0x4003d,
+0x1, 0x60, 0x5f, 0x500b0, 0x1a, 0x61, 0x5e, 0x60, 0x400fa, 0x61, 0x5b, 0x5d, 0x200f8, 0x5b, 0x4003d, 0x1, 0x62, 0x58, 0x50080, 0x1, 0x63, 0x1f, 0x62, 0x60041, 0x21, 0x64, 0x8, 0xb, 0x63, 0x4003d, 0x5, 0x65, 0x64, 0x50085, 0x5, 0x66, 0x65, 0x57, 0x60041, 0x21,
+0x67, 0x8, 0xb, 0x63, 0x3003e, 0x67, 0x66, 0x200f9, 0x5c, 0x200f8, 0x5c, 0x4003d, 0x1, 0x68, 0x58, 0x50080, 0x1, 0x69, 0x68, 0x25, 0x3003e, 0x58, 0x69, 0x200f9, 0x59, 0x200f8, 0x5d, 0x100fd, 0x10038,
+};
\ No newline at end of file
@@ -0,0 +1,19 @@
+#ifdef VK_CONSTANTS_HOST
+struct SoftmaxPushConstantData
+{
+#define uint uint32_t
+#elif defined VK_CONSTANTS_GLSL
+layout(push_constant) uniform constants_
+{
+#endif
+
+    uint row_length;
+    uint row_count;
+
+#ifdef VK_CONSTANTS_HOST
+};
+#undef uint
+#elif defined VK_CONSTANTS_GLSL
+}
+pc;
+#endif
\ No newline at end of file
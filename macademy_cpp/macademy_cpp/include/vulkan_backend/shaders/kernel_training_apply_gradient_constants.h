@@ -11,9 +11,18 @@ layout(push_constant) uniform constants_
 
     uint layer_neuron_count;
     uint weights_per_neuron;
+    uint optimizer;
+    float learning_rate;
+    float gradient_scale;
     float regularization_term_1;
     float regularization_term_2;
-    float normalized_learning_rate;
+    float l1_gradient_term;
+    float l2_gradient_term;
+    float beta1;
+    float beta2;
+    float epsilon;
+    float bias_correction_1;
+    float bias_correction_2;
 
 #ifdef VK_CONSTANTS_HOST
 };
@@ -1,2 +1,85 @@
 #version 460
-#include "kernel_training_backward_pass_base.glsl"
+///
+/// Vulkan kernels implementing network calculations, and backpropagation
+///
+
+#define VK_CONSTANTS_GLSL
+#include "kernel_training_backward_pass_constants.h"
+
+layout(std430, binding = 0) readonly buffer next_layer_data_buf {
+   float next_layer_data[];
+};
+
+layout(std430, binding = 1) readonly buffer layer_activations_buf {
+   float layer_activations[];
+};
+
+layout(std430, binding = 2) readonly buffer layer_zvalues_buf {
+   float layer_zvalues[];
+};
+
+layout(std430, binding = 3) buffer delta_k_vector_write_buf {
+   float delta_k_vector_write[];
+};
+
+layout(std430, binding = 4) readonly buffer delta_k_vector_read_buf {
+   float delta_k_vector_read[];
+};
+
+#include "common.glsl"
+
+layout(local_size_x_id = 0, local_size_y_id = 1, local_size_z = 1) in;
+
+void main()
+{
+    const uint layer_neuron_id = gl_GlobalInvocationID.x;
+    const uint trainingSampleId = gl_GlobalInvocationID.y;
+
+    if (trainingSampleId >= pc.num_training_samples || layer_neuron_id >= pc.layer_neuron_count)
+    {
+        return;
+    }
+    
+    const uint layer_offset = pc.layer_neuron_count * trainingSampleId;
+    const uint next_layer_offset = pc.next_layer_neuron_count * trainingSampleId;
+    const uint delta_k_read_offset = next_layer_offset;
+    const uint delta_k_write_offset = layer_offset;
+
+    const float zValue = ActivationFunctionUsesZValues(SelectActivationFunction(pc.activation_function)) ? layer_zvalues[layer_offset + layer_neuron_id] : 0.0f;
+    const float activation = layer_activations[layer_offset + layer_neuron_id];
+
+    float delta_k;
+    
+    if ( pc.is_output_layer != 0u )
+    {
+        //Output layer
+        const float desiredOutput = next_layer_data[layer_offset + layer_neuron_id];
+        if (SelectActivationFunction(pc.activation_function) == Activation_Softmax && pc.cost_function == CostFunction_MeanSquared)
+        {
+            // Every output of softmax depends on every z value of the row, the error is multiplied by the full Jacobian
+            float dot = 0;
+            for(uint i = 0; i < pc.layer_neuron_count; ++i)
+            {
+                dot += (layer_activations[layer_offset + i] - next_layer_data[layer_offset + i]) * layer_activations[layer_offset + i];
+            }
+            delta_k = activation * ((activation - desiredOutput) - dot);
+        }
+        else
+        {
+            delta_k = CostFunctionDelta(pc.cost_function, SelectActivationFunction(pc.activation_function), zValue, activation, desiredOutput);
+        }
+    }
+    else 
+    {
+        //Hidden layer
+        delta_k = 0;
+        const uint next_layer_row_stride = GetRowStride(pc.layer_neuron_count);
+        for(uint i = 0; i < pc.next_layer_neuron_count; ++i)
+        {
+            delta_k += delta_k_vector_read[delta_k_read_offset + i] * next_layer_data[layer_neuron_id + i * next_layer_row_stride];
+        }
+        delta_k *= ActivationFunctionPrime(SelectActivationFunction(pc.activation_function), zValue, activation);
+    }
+
+   delta_k_vector_write[delta_k_write_offset + layer_neuron_id] = delta_k;
+}
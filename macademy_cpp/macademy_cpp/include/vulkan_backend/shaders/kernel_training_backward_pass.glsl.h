@@ -1,36 +1,37 @@
-std::array<uint32_t, 1383> vulkan_kernel_source_kernel_training_backward_pass_glsl = {0x7230203, 0x10300, 0xd000b, 0x323, 0x0, 0x20011, 0x1, 0x20011, 0x1791, 0x9000a, 0x5f565053, 0x5f545845, 0x64616873, 0x615f7265, 0x696d6f74, 0x6c665f63, 0x5f74616f, 0x646461, 0x6000b, 0x1, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x4, 0x6e69616d, 0x0, 0xaf, 0x60010, 0x4, 0x11, 0x1, 0x1, 0x1, 0x40047,
-0xaf, 0xb, 0x1c, 0x50048, 0xb8, 0x0, 0x23, 0x0, 0x50048, 0xb8, 0x1, 0x23, 0x4, 0x50048, 0xb8, 0x2, 0x23, 0x8, 0x50048, 0xb8, 0x3, 0x23, 0xc, 0x50048, 0xb8, 0x4, 0x23, 0x10, 0x50048, 0xb8, 0x5, 0x23, 0x14, 0x50048, 0xb8, 0x6, 0x23, 0x18, 0x30047, 0xb8,
-0x2, 0x40047, 0xe4, 0x6, 0x4, 0x40048, 0xe5, 0x0, 0x18, 0x50048, 0xe5, 0x0, 0x23, 0x0, 0x30047, 0xe5, 0x2, 0x40047, 0xe7, 0x22, 0x0, 0x40047, 0xe7, 0x21, 0x3, 0x40047, 0xf5, 0x6, 0x4, 0x40048, 0xf6, 0x0, 0x18, 0x50048, 0xf6, 0x0, 0x23, 0x0, 0x30047, 0xf6,
-0x2, 0x40047, 0xf8, 0x22, 0x0, 0x40047, 0xf8, 0x21, 0x2, 0x40047, 0xff, 0x6, 0x4, 0x40048, 0x100, 0x0, 0x18, 0x50048, 0x100, 0x0, 0x23, 0x0, 0x30047, 0x100, 0x2, 0x40047, 0x102, 0x22, 0x0, 0x40047, 0x102, 0x21, 0x0, 0x40047, 0x127, 0x6, 0x4, 0x40048, 0x128, 0x0,
-0x18, 0x50048, 0x128, 0x0, 0x23, 0x0, 0x30047, 0x128, 0x2, 0x40047, 0x12a, 0x22, 0x0, 0x40047, 0x12a, 0x21, 0x5, 0x40047, 0x154, 0x6, 0x4, 0x50048, 0x155, 0x0, 0x23, 0x0, 0x30047, 0x155, 0x2, 0x40047, 0x157, 0x22, 0x0, 0x40047, 0x157, 0x21, 0x6, 0x40047, 0x15d, 0x6,
-0x4, 0x40048, 0x15e, 0x0, 0x18, 0x50048, 0x15e, 0x0, 0x23, 0x0, 0x30047, 0x15e, 0x2, 0x40047, 0x160, 0x22, 0x0, 0x40047, 0x160, 0x21, 0x1, 0x40047, 0x171, 0x6, 0x4, 0x50048, 0x172, 0x0, 0x23, 0x0, 0x30047, 0x172, 0x2, 0x40047, 0x174, 0x22, 0x0, 0x40047, 0x174, 0x21,
-0x4, 0x40047, 0x17a, 0x1, 0x0, 0x40047, 0x17b, 0x1, 0x1, 0x40047, 0x17c, 0xb, 0x19, 0x20013, 0x2, 0x30021, 0x3, 0x2, 0x40015, 0x6, 0x20, 0x0, 0x30016, 0x8, 0x20, 0x4002b, 0x8, 0x26, 0x3f800000, 0x4002b, 0x8, 0x2e, 0x0, 0x20014, 0x2f, 0x4002b, 0x8, 0x34, 0x40000000, 0x4002b,
-0x8, 0x35, 0xc0000000, 0x40015, 0x41, 0x20, 0x1, 0x4002b, 0x41, 0x42, 0x0, 0x4002b, 0x41, 0x43, 0x1, 0x4002b, 0x8, 0x4c, 0x3c23d70a, 0x4002b, 0x6, 0x6a, 0x0, 0x40017, 0xad, 0x6, 0x3, 0x40020, 0xae, 0x1, 0xad, 0x4003b, 0xae, 0xaf, 0x1, 0x40020, 0xb0, 0x1, 0x6, 0x4002b,
-0x6, 0xb4, 0x1, 0x9001e, 0xb8, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x40020, 0xb9, 0x9, 0xb8, 0x4003b, 0xb9, 0xba, 0x9, 0x4002b, 0x41, 0xbb, 0x3, 0x40020, 0xbc, 0x9, 0x6, 0x4002b, 0x41, 0xd8, 0x5, 0x3001d, 0xe4, 0x8, 0x3001e, 0xe5, 0xe4, 0x40020, 0xe6,
-0xc, 0xe5, 0x4003b, 0xe6, 0xe7, 0xc, 0x40020, 0xeb, 0xc, 0x8, 0x4002b, 0x41, 0xee, 0x6, 0x3001d, 0xf5, 0x8, 0x3001e, 0xf6, 0xf5, 0x40020, 0xf7, 0xc, 0xf6, 0x4003b, 0xf7, 0xf8, 0xc, 0x3001d, 0xff, 0x8, 0x3001e, 0x100, 0xff, 0x40020, 0x101, 0xc, 0x100, 0x4003b, 0x101,
-0x102, 0xc, 0x4002b, 0x41, 0x109, 0x4, 0x4002b, 0x41, 0x10a, 0x2, 0x3001d, 0x127, 0x8, 0x3001e, 0x128, 0x127, 0x40020, 0x129, 0xc, 0x128, 0x4003b, 0x129, 0x12a, 0xc, 0x3001d, 0x154, 0x8, 0x3001e, 0x155, 0x154, 0x40020, 0x156, 0xc, 0x155, 0x4003b, 0x156, 0x157, 0xc, 0x3001d, 0x15d,
-0x8, 0x3001e, 0x15e, 0x15d, 0x40020, 0x15f, 0xc, 0x15e, 0x4003b, 0x15f, 0x160, 0xc, 0x3001d, 0x171, 0x8, 0x3001e, 0x172, 0x171, 0x40020, 0x173, 0xc, 0x172, 0x4003b, 0x173, 0x174, 0xc, 0x40032, 0x6, 0x17a, 0x1, 0x40032, 0x6, 0x17b, 0x1, 0x60033, 0xad, 0x17c, 0x17a, 0x17b, 0xb4,
-0x50036, 0x2, 0x4, 0x0, 0x3, 0x200f8, 0x5, 0x300f7, 0x17d, 0x0, 0x300fb, 0x6a, 0x17e, 0x200f8, 0x17e, 0x50041, 0xb0, 0xb1, 0xaf, 0x6a, 0x4003d, 0x6, 0xb2, 0xb1, 0x50041, 0xb0, 0xb5, 0xaf, 0xb4, 0x4003d, 0x6, 0xb6, 0xb5, 0x50041, 0xbc, 0xbd, 0xba, 0xbb, 0x4003d, 0x6,
-0xbe, 0xbd, 0x500ae, 0x2f, 0xbf, 0xb6, 0xbe, 0x400a8, 0x2f, 0xc0, 0xbf, 0x300f7, 0xc2, 0x0, 0x400fa, 0xc0, 0xc1, 0xc2, 0x200f8, 0xc1, 0x50041, 0xbc, 0xc4, 0xba, 0x42, 0x4003d, 0x6, 0xc5, 0xc4, 0x500ae, 0x2f, 0xc6, 0xb2, 0xc5, 0x200f9, 0xc2, 0x200f8, 0xc2, 0x700f5, 0x2f,
-0xc7, 0xbf, 0x17e, 0xc6, 0xc1, 0x300f7, 0xc9, 0x0, 0x400fa, 0xc7, 0xc8, 0xc9, 0x200f8, 0xc8, 0x200f9, 0x17d, 0x200f8, 0xc9, 0x50041, 0xbc, 0xcc, 0xba, 0x43, 0x4003d, 0x6, 0xcd, 0xcc, 0x50084, 0x6, 0xd1, 0xcd, 0xb6, 0x50041, 0xbc, 0xd3, 0xba, 0x42, 0x4003d, 0x6, 0xd4,
-0xd3, 0x50084, 0x6, 0xd6, 0xd4, 0xb6, 0x50041, 0xbc, 0xd9, 0xba, 0xd8, 0x4003d, 0x6, 0xda, 0xd9, 0x50084, 0x6, 0xdc, 0xda, 0xb6, 0x50080, 0x6, 0xea, 0xd6, 0xb2, 0x60041, 0xeb, 0xec, 0xe7, 0x42, 0xea, 0x4003d, 0x8, 0xed, 0xec, 0x50041, 0xbc, 0xef, 0xba, 0xee,
-0x4003d, 0x6, 0xf0, 0xef, 0x500ab, 0x2f, 0xf1, 0xf0, 0x6a, 0x300f7, 0xf3, 0x0, 0x400fa, 0xf1, 0xf2, 0x118, 0x200f8, 0x118, 0x50080, 0x6, 0x11c, 0xd4, 0xb4, 0x200f9, 0x11e, 0x200f8, 0x11e, 0x700f5, 0x8, 0x30b, 0x2e, 0x118, 0x139, 0x11f, 0x700f5, 0x6, 0x2fd, 0x6a, 0x118, 0x13b,
-0x11f, 0x500b0, 0x2f, 0x126, 0x2fd, 0xda, 0x400f6, 0x120, 0x11f, 0x0, 0x400fa, 0x126, 0x11f, 0x120, 0x200f8, 0x11f, 0x50080, 0x6, 0x12d, 0xdc, 0x2fd, 0x60041, 0xeb, 0x12e, 0x12a, 0x42, 0x12d, 0x4003d, 0x8, 0x12f, 0x12e, 0x50084, 0x6, 0x133, 0x2fd, 0x11c, 0x50080, 0x6, 0x134, 0xb2,
-0x133, 0x60041, 0xeb, 0x135, 0x102, 0x42, 0x134, 0x4003d, 0x8, 0x136, 0x135, 0x50085, 0x8, 0x137, 0x12f, 0x136, 0x50081, 0x8, 0x139, 0x30b, 0x137, 0x50080, 0x6, 0x13b, 0x2fd, 0x43, 0x200f9, 0x11e, 0x200f8, 0x120, 0x50041, 0xbc, 0x13d, 0xba, 0x10a, 0x4003d, 0x6, 0x13e, 0x13d, 0x300f7,
-0x288, 0x0, 0x1300fb, 0x13e, 0x263, 0x0, 0x264, 0x1, 0x26b, 0x2, 0x26f, 0x4, 0x276, 0x5, 0x277, 0x3, 0x278, 0x6, 0x27c, 0x7, 0x282, 0x200f8, 0x282, 0x50085, 0x8, 0x285, 0xed, 0xed, 0x50081, 0x8, 0x286, 0x285, 0x26, 0x50088, 0x8, 0x287, 0x26, 0x286, 0x200f9, 0x288,
-0x200f8, 0x27c, 0x4007f, 0x8, 0x27e, 0xed, 0x6000c, 0x8, 0x27f, 0x1, 0x1b, 0x27e, 0x50081, 0x8, 0x280, 0x26, 0x27f, 0x50088, 0x8, 0x281, 0x26, 0x280, 0x200f9, 0x288, 0x200f8, 0x278, 0x500b8, 0x2f, 0x27a, 0xed, 0x2e, 0x600a9, 0x8, 0x27b, 0x27a, 0x4c, 0x26, 0x200f9, 0x288, 0x200f8,
-0x277, 0x200f9, 0x288, 0x200f8, 0x276, 0x200f9, 0x288, 0x200f8, 0x26f, 0x50085, 0x8, 0x2da, 0x35, 0xed, 0x6000c, 0x8, 0x2db, 0x1, 0x1b, 0x2da, 0x50081, 0x8, 0x2dc, 0x26, 0x2db, 0x50088, 0x8, 0x2dd, 0x34, 0x2dc, 0x50083, 0x8, 0x2de, 0x2dd, 0x26, 0x50085, 0x8, 0x274, 0x2de, 0x2de,
-0x50083, 0x8, 0x275, 0x26, 0x274, 0x200f9, 0x288, 0x200f8, 0x26b, 0x500b8, 0x2f, 0x26d, 0xed, 0x2e, 0x600a9, 0x8, 0x26e, 0x26d, 0x2e, 0x26, 0x200f9, 0x288, 0x200f8, 0x264, 0x4007f, 0x8, 0x297, 0xed, 0x6000c, 0x8, 0x298, 0x1, 0x1b, 0x297, 0x50081, 0x8, 0x299, 0x26, 0x298, 0x50088,
-0x8, 0x29a, 0x26, 0x299, 0x50083, 0x8, 0x269, 0x26, 0x29a, 0x50085, 0x8, 0x26a, 0x29a, 0x269, 0x200f9, 0x288, 0x200f8, 0x263, 0x200f9, 0x288, 0x200f8, 0x288, 0x1500f5, 0x8, 0x308, 0x2e, 0x263, 0x26a, 0x264, 0x26e, 0x26b, 0x275, 0x26f, 0x26, 0x276, 0x2e, 0x277, 0x27b, 0x278, 0x281,
-0x27c, 0x287, 0x282, 0x50085, 0x8, 0x143, 0x30b, 0x308, 0x200f9, 0xf3, 0x200f8, 0xf2, 0x60041, 0xeb, 0xfc, 0xf8, 0x42, 0xea, 0x4003d, 0x8, 0xfd, 0xfc, 0x60041, 0xeb, 0x106, 0x102, 0x42, 0xea, 0x4003d, 0x8, 0x107, 0x106, 0x50041, 0xbc, 0x10c, 0xba, 0x109, 0x4003d, 0x6, 0x10d,
-0x10c, 0x50041, 0xbc, 0x10f, 0xba, 0x10a, 0x4003d, 0x6, 0x110, 0x10f, 0x300f7, 0x1ac, 0x0, 0x700fb, 0x10d, 0x1a0, 0x0, 0x1a4, 0x1, 0x1a0, 0x200f8, 0x1a4, 0x50083, 0x8, 0x1a7, 0xfd, 0x107, 0x300f7, 0x1e2, 0x0, 0x1300fb, 0x110, 0x1bd, 0x0, 0x1be, 0x1, 0x1c5, 0x2, 0x1c9, 0x4,
-0x1d0, 0x5, 0x1d1, 0x3, 0x1d2, 0x6, 0x1d6, 0x7, 0x1dc, 0x200f8, 0x1dc, 0x50085, 0x8, 0x1df, 0xed, 0xed, 0x50081, 0x8, 0x1e0, 0x1df, 0x26, 0x50088, 0x8, 0x1e1, 0x26, 0x1e0, 0x200f9, 0x1e2, 0x200f8, 0x1d6, 0x4007f, 0x8, 0x1d8, 0xed, 0x6000c, 0x8, 0x1d9, 0x1, 0x1b, 0x1d8,
-0x50081, 0x8, 0x1da, 0x26, 0x1d9, 0x50088, 0x8, 0x1db, 0x26, 0x1da, 0x200f9, 0x1e2, 0x200f8, 0x1d2, 0x500b8, 0x2f, 0x1d4, 0xed, 0x2e, 0x600a9, 0x8, 0x1d5, 0x1d4, 0x4c, 0x26, 0x200f9, 0x1e2, 0x200f8, 0x1d1, 0x200f9, 0x1e2, 0x200f8, 0x1d0, 0x200f9, 0x1e2, 0x200f8, 0x1c9, 0x50085, 0x8, 0x234,
-0x35, 0xed, 0x6000c, 0x8, 0x235, 0x1, 0x1b, 0x234, 0x50081, 0x8, 0x236, 0x26, 0x235, 0x50088, 0x8, 0x237, 0x34, 0x236, 0x50083, 0x8, 0x238, 0x237, 0x26, 0x50085, 0x8, 0x1ce, 0x238, 0x238, 0x50083, 0x8, 0x1cf, 0x26, 0x1ce, 0x200f9, 0x1e2, 0x200f8, 0x1c5, 0x500b8, 0x2f, 0x1c7,
-0xed, 0x2e, 0x600a9, 0x8, 0x1c8, 0x1c7, 0x2e, 0x26, 0x200f9, 0x1e2, 0x200f8, 0x1be, 0x4007f, 0x8, 0x1f1, 0xed, 0x6000c, 0x8, 0x1f2, 0x1, 0x1b, 0x1f1, 0x50081, 0x8, 0x1f3, 0x26, 0x1f2, 0x50088, 0x8, 0x1f4, 0x26, 0x1f3, 0x50083, 0x8, 0x1c3, 0x26, 0x1f4, 0x50085, 0x8, 0x1c4,
-0x1f4, 0x1c3, 0x200f9, 0x1e2, 0x200f8, 0x1bd, 0x200f9, 0x1e2, 0x200f8, 0x1e2, 0x1500f5, 0x8, 0x31c, 0x2e, 0x1bd, 0x1c4, 0x1be, 0x1c8, 0x1c5, 0x1cf, 0x1c9, 0x26, 0x1d0, 0x2e, 0x1d1, 0x1d5, 0x1d2, 0x1db, 0x1d6, 0x1e1, 0x1dc, 0x50085, 0x8, 0x1ab, 0x1a7, 0x31c, 0x200f9, 0x1ac, 0x200f8, 0x1a0,
-0x50083, 0x8, 0x1a3, 0xfd, 0x107, 0x200f9, 0x1ac, 0x200f8, 0x1ac, 0x700f5, 0x8, 0x31f, 0x1a3, 0x1a0, 0x1ab, 0x1e2, 0x200f9, 0xf3, 0x200f8, 0xf3, 0x700f5, 0x8, 0x322, 0x31f, 0x1ac, 0x143, 0x288, 0x50080, 0x6, 0x148, 0xcd, 0xb4, 0x50084, 0x6, 0x149, 0xb2, 0x148, 0x200f9, 0x14b, 0x200f8,
-0x14b, 0x700f5, 0x6, 0x320, 0x6a, 0xf3, 0x169, 0x14c, 0x500b0, 0x2f, 0x153, 0x320, 0xcd, 0x400f6, 0x14d, 0x14c, 0x0, 0x400fa, 0x153, 0x14c, 0x14d, 0x200f8, 0x14c, 0x50080, 0x6, 0x15a, 0x149, 0x320, 0x60041, 0xeb, 0x15b, 0x157, 0x42, 0x15a, 0x50080, 0x6, 0x163, 0xd1, 0x320, 0x60041,
-0xeb, 0x164, 0x160, 0x42, 0x163, 0x4003d, 0x8, 0x165, 0x164, 0x50085, 0x8, 0x166, 0x322, 0x165, 0x71793, 0x8, 0x167, 0x15b, 0xb4, 0x6a, 0x166, 0x50080, 0x6, 0x169, 0x320, 0x43, 0x200f9, 0x14b, 0x200f8, 0x14d, 0x50080, 0x6, 0x16d, 0x149, 0xcd, 0x60041, 0xeb, 0x16e, 0x157, 0x42,
-0x16d, 0x71793, 0x8, 0x170, 0x16e, 0xb4, 0x6a, 0x322, 0x60041, 0xeb, 0x179, 0x174, 0x42, 0xea, 0x3003e, 0x179, 0x322, 0x200f9, 0x17d, 0x200f8, 0x17d, 0x100fd, 0x10038,
+std::array<uint32_t, 1432> vulkan_kernel_source_kernel_training_backward_pass_glsl = {0x7230203, 0x10300, 0x0, 0x103, 0x0, 0x20011, 0x1, 0x6000b, 0xf9, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x22, 0x6e69616d, 0x0, 0x26, 0x60010, 0x22, 0x11, 0x1, 0x1, 0x1, 0x30047, 0x2, 0x2, 0x50048, 0x2, 0x0, 0x23, 0x0, 0x50048, 0x2, 0x1, 0x23,
+0x4, 0x50048, 0x2, 0x2, 0x23, 0x8, 0x50048, 0x2, 0x3, 0x23, 0xc, 0x50048, 0x2, 0x4, 0x23, 0x10, 0x50048, 0x2, 0x5, 0x23, 0x14, 0x40047, 0x6, 0x6, 0x4, 0x30047, 0x7, 0x2, 0x50048, 0x7, 0x0, 0x23, 0x0, 0x40048, 0x7, 0x0, 0x18, 0x40047, 0x8, 0x22,
+0x0, 0x40047, 0x8, 0x21, 0x0, 0x40047, 0xc, 0x6, 0x4, 0x30047, 0xd, 0x2, 0x50048, 0xd, 0x0, 0x23, 0x0, 0x40048, 0xd, 0x0, 0x18, 0x40047, 0xe, 0x22, 0x0, 0x40047, 0xe, 0x21, 0x1, 0x40047, 0x11, 0x6, 0x4, 0x30047, 0x12, 0x2, 0x50048, 0x12, 0x0, 0x23,
+0x0, 0x40048, 0x12, 0x0, 0x18, 0x40047, 0x13, 0x22, 0x0, 0x40047, 0x13, 0x21, 0x2, 0x40047, 0x16, 0x6, 0x4, 0x30047, 0x17, 0x2, 0x50048, 0x17, 0x0, 0x23, 0x0, 0x40047, 0x18, 0x22, 0x0, 0x40047, 0x18, 0x21, 0x3, 0x40047, 0x1b, 0x6, 0x4, 0x30047, 0x1c, 0x2,
+0x50048, 0x1c, 0x0, 0x23, 0x0, 0x40048, 0x1c, 0x0, 0x18, 0x40047, 0x1d, 0x22, 0x0, 0x40047, 0x1d, 0x21, 0x4, 0x40047, 0x21, 0x1, 0x2, 0x40047, 0x26, 0xb, 0x1c, 0x40047, 0x100, 0x1, 0x0, 0x40047, 0x101, 0x1, 0x1, 0x40047, 0x102, 0xb, 0x19, 0x40015, 0x1, 0x20,
+0x0, 0x8001e, 0x2, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x40020, 0x4, 0x9, 0x2, 0x4003b, 0x4, 0x3, 0x9, 0x30016, 0x5, 0x20, 0x3001d, 0x6, 0x5, 0x3001e, 0x7, 0x6, 0x40020, 0x9, 0xc, 0x7, 0x4003b, 0x9, 0x8, 0xc, 0x40015, 0xa, 0x20, 0x1, 0x4002b, 0xa,
+0xb, 0x0, 0x3001d, 0xc, 0x5, 0x3001e, 0xd, 0xc, 0x40020, 0xf, 0xc, 0xd, 0x4003b, 0xf, 0xe, 0xc, 0x4002b, 0xa, 0x10, 0x1, 0x3001d, 0x11, 0x5, 0x3001e, 0x12, 0x11, 0x40020, 0x14, 0xc, 0x12, 0x4003b, 0x14, 0x13, 0xc, 0x4002b, 0xa, 0x15, 0x2, 0x3001d, 0x16,
+0x5, 0x3001e, 0x17, 0x16, 0x40020, 0x19, 0xc, 0x17, 0x4003b, 0x19, 0x18, 0xc, 0x4002b, 0xa, 0x1a, 0x3, 0x3001d, 0x1b, 0x5, 0x3001e, 0x1c, 0x1b, 0x40020, 0x1e, 0xc, 0x1c, 0x4003b, 0x1e, 0x1d, 0xc, 0x4002b, 0xa, 0x1f, 0x4, 0x4002b, 0x1, 0x20, 0xffffffff, 0x40032, 0x1,
+0x21, 0xffffffff, 0x20013, 0x23, 0x30021, 0x24, 0x23, 0x40017, 0x27, 0x1, 0x3, 0x40020, 0x28, 0x1, 0x27, 0x4003b, 0x28, 0x26, 0x1, 0x40020, 0x2e, 0x9, 0x1, 0x20014, 0x31, 0x40021, 0x41, 0x1, 0x1, 0x40021, 0x44, 0x31, 0x1, 0x40020, 0x4b, 0xc, 0x5, 0x4002b, 0x5, 0x4d,
+0x0, 0x40020, 0x53, 0x7, 0x5, 0x4002b, 0xa, 0x54, 0x5, 0x4002b, 0x1, 0x57, 0x0, 0x4002b, 0xa, 0x62, 0x8, 0x4002b, 0x1, 0x63, 0x8, 0x40020, 0x6e, 0x7, 0x1, 0x4002b, 0x1, 0x89, 0x1, 0x80021, 0x95, 0x5, 0x1, 0x1, 0x5, 0x5, 0x5, 0x60021, 0xb8, 0x5,
+0x1, 0x5, 0x5, 0x4002b, 0xa, 0xc4, 0x6, 0x4002b, 0x1, 0xc5, 0x6, 0x4002b, 0xa, 0xc7, 0x7, 0x4002b, 0x1, 0xc8, 0x7, 0x4002b, 0xa, 0xda, 0x10, 0x4002b, 0x1, 0xdb, 0x10, 0x4002b, 0x5, 0xee, 0x3f800000, 0x4002b, 0x5, 0xf6, 0x3c23d70a, 0x40032, 0x1, 0x100, 0x1, 0x40032,
+0x1, 0x101, 0x1, 0x60033, 0x27, 0x102, 0x100, 0x101, 0x89, 0x50036, 0x23, 0x22, 0x0, 0x24, 0x200f8, 0x25, 0x4003b, 0x53, 0x52, 0x7, 0x4003b, 0x53, 0x6c, 0x7, 0x4003b, 0x6e, 0x6d, 0x7, 0x4003b, 0x6e, 0x9b, 0x7, 0x4003d, 0x27, 0x29, 0x26, 0x50051, 0x1, 0x2a, 0x29,
+0x0, 0x4003d, 0x27, 0x2b, 0x26, 0x50051, 0x1, 0x2c, 0x2b, 0x1, 0x50041, 0x2e, 0x2d, 0x3, 0x15, 0x4003d, 0x1, 0x2f, 0x2d, 0x500ae, 0x31, 0x30, 0x2c, 0x2f, 0x50041, 0x2e, 0x32, 0x3, 0xb, 0x4003d, 0x1, 0x33, 0x32, 0x500ae, 0x31, 0x34, 0x2a, 0x33, 0x500a6, 0x31,
+0x35, 0x30, 0x34, 0x300f7, 0x36, 0x0, 0x400fa, 0x35, 0x37, 0x36, 0x200f8, 0x37, 0x100fd, 0x200f8, 0x36, 0x50041, 0x2e, 0x38, 0x3, 0xb, 0x4003d, 0x1, 0x39, 0x38, 0x50084, 0x1, 0x3a, 0x39, 0x2c, 0x50041, 0x2e, 0x3b, 0x3, 0x1f, 0x4003d, 0x1, 0x3c, 0x3b, 0x50084, 0x1,
+0x3d, 0x3c, 0x2c, 0x50041, 0x2e, 0x3e, 0x3, 0x10, 0x4003d, 0x1, 0x3f, 0x3e, 0x50039, 0x1, 0x42, 0x40, 0x3f, 0x50039, 0x31, 0x45, 0x43, 0x42, 0x300f7, 0x48, 0x0, 0x400fa, 0x45, 0x46, 0x47, 0x200f8, 0x46, 0x50080, 0x1, 0x49, 0x3a, 0x2a, 0x60041, 0x4b, 0x4a, 0x13,
+0xb, 0x49, 0x4003d, 0x5, 0x4c, 0x4a, 0x200f9, 0x48, 0x200f8, 0x47, 0x200f9, 0x48, 0x200f8, 0x48, 0x700f5, 0x5, 0x4e, 0x4c, 0x46, 0x4d, 0x47, 0x50080, 0x1, 0x4f, 0x3a, 0x2a, 0x60041, 0x4b, 0x50, 0xe, 0xb, 0x4f, 0x4003d, 0x5, 0x51, 0x50, 0x50041, 0x2e, 0x55, 0x3,
+0x54, 0x4003d, 0x1, 0x56, 0x55, 0x500ab, 0x31, 0x58, 0x56, 0x57, 0x300f7, 0x59, 0x0, 0x400fa, 0x58, 0x5a, 0x5b, 0x200f8, 0x5a, 0x50080, 0x1, 0x5c, 0x3a, 0x2a, 0x60041, 0x4b, 0x5d, 0x8, 0xb, 0x5c, 0x4003d, 0x5, 0x5e, 0x5d, 0x50041, 0x2e, 0x5f, 0x3, 0x10, 0x4003d,
+0x1, 0x60, 0x5f, 0x50039, 0x1, 0x61, 0x40, 0x60, 0x500aa, 0x31, 0x64, 0x61, 0x63, 0x50041, 0x2e, 0x65, 0x3, 0x1a, 0x4003d, 0x1, 0x66, 0x65, 0x500aa, 0x31, 0x67, 0x66, 0x57, 0x500a7, 0x31, 0x68, 0x64, 0x67, 0x300f7, 0x69, 0x0, 0x400fa, 0x68, 0x6a, 0x6b, 0x200f8,
+0x6a, 0x3003e, 0x6c, 0x4d, 0x3003e, 0x6d, 0x57, 0x200f9, 0x6f, 0x200f8, 0x6f, 0x400f6, 0x73, 0x72, 0x0, 0x200f9, 0x70, 0x200f8, 0x70, 0x4003d, 0x1, 0x74, 0x6d, 0x50041, 0x2e, 0x75, 0x3, 0xb, 0x4003d, 0x1, 0x76, 0x75, 0x500b0, 0x31, 0x77, 0x74, 0x76, 0x400fa, 0x77, 0x71,
+0x73, 0x200f8, 0x71, 0x4003d, 0x5, 0x78, 0x6c, 0x4003d, 0x1, 0x79, 0x6d, 0x50080, 0x1, 0x7a, 0x3a, 0x79, 0x60041, 0x4b, 0x7b, 0xe, 0xb, 0x7a, 0x4003d, 0x5, 0x7c, 0x7b, 0x4003d, 0x1, 0x7d, 0x6d, 0x50080, 0x1, 0x7e, 0x3a, 0x7d, 0x60041, 0x4b, 0x7f, 0x8, 0xb,
+0x7e, 0x4003d, 0x5, 0x80, 0x7f, 0x50083, 0x5, 0x81, 0x7c, 0x80, 0x4003d, 0x1, 0x82, 0x6d, 0x50080, 0x1, 0x83, 0x3a, 0x82, 0x60041, 0x4b, 0x84, 0xe, 0xb, 0x83, 0x4003d, 0x5, 0x85, 0x84, 0x50085, 0x5, 0x86, 0x81, 0x85, 0x50081, 0x5, 0x87, 0x78, 0x86, 0x3003e,
+0x6c, 0x87, 0x200f9, 0x72, 0x200f8, 0x72, 0x4003d, 0x1, 0x88, 0x6d, 0x50080, 0x1, 0x8a, 0x88, 0x89, 0x3003e, 0x6d, 0x8a, 0x200f9, 0x6f, 0x200f8, 0x73, 0x50083, 0x5, 0x8b, 0x51, 0x5e, 0x4003d, 0x5, 0x8c, 0x6c, 0x50083, 0x5, 0x8d, 0x8b, 0x8c, 0x50085, 0x5, 0x8e, 0x51,
+0x8d, 0x3003e, 0x52, 0x8e, 0x200f9, 0x69, 0x200f8, 0x6b, 0x50041, 0x2e, 0x8f, 0x3, 0x1a, 0x4003d, 0x1, 0x90, 0x8f, 0x50041, 0x2e, 0x91, 0x3, 0x10, 0x4003d, 0x1, 0x92, 0x91, 0x50039, 0x1, 0x93, 0x40, 0x92, 0x90039, 0x5, 0x96, 0x94, 0x90, 0x93, 0x4e, 0x51, 0x5e,
+0x3003e, 0x52, 0x96, 0x200f9, 0x69, 0x200f8, 0x69, 0x200f9, 0x59, 0x200f8, 0x5b, 0x3003e, 0x52, 0x4d, 0x50041, 0x2e, 0x97, 0x3, 0xb, 0x4003d, 0x1, 0x98, 0x97, 0x50039, 0x1, 0x9a, 0x99, 0x98, 0x3003e, 0x9b, 0x57, 0x200f9, 0x9c, 0x200f8, 0x9c, 0x400f6, 0xa0, 0x9f, 0x0, 0x200f9,
+0x9d, 0x200f8, 0x9d, 0x4003d, 0x1, 0xa1, 0x9b, 0x50041, 0x2e, 0xa2, 0x3, 0x1f, 0x4003d, 0x1, 0xa3, 0xa2, 0x500b0, 0x31, 0xa4, 0xa1, 0xa3, 0x400fa, 0xa4, 0x9e, 0xa0, 0x200f8, 0x9e, 0x4003d, 0x5, 0xa5, 0x52, 0x4003d, 0x1, 0xa6, 0x9b, 0x50080, 0x1, 0xa7, 0x3d, 0xa6,
+0x60041, 0x4b, 0xa8, 0x1d, 0xb, 0xa7, 0x4003d, 0x5, 0xa9, 0xa8, 0x4003d, 0x1, 0xaa, 0x9b, 0x50084, 0x1, 0xab, 0xaa, 0x9a, 0x50080, 0x1, 0xac, 0x2a, 0xab, 0x60041, 0x4b, 0xad, 0x8, 0xb, 0xac, 0x4003d, 0x5, 0xae, 0xad, 0x50085, 0x5, 0xaf, 0xa9, 0xae, 0x50081,
+0x5, 0xb0, 0xa5, 0xaf, 0x3003e, 0x52, 0xb0, 0x200f9, 0x9f, 0x200f8, 0x9f, 0x4003d, 0x1, 0xb1, 0x9b, 0x50080, 0x1, 0xb2, 0xb1, 0x89, 0x3003e, 0x9b, 0xb2, 0x200f9, 0x9c, 0x200f8, 0xa0, 0x4003d, 0x5, 0xb3, 0x52, 0x50041, 0x2e, 0xb4, 0x3, 0x10, 0x4003d, 0x1, 0xb5, 0xb4,
+0x50039, 0x1, 0xb6, 0x40, 0xb5, 0x70039, 0x5, 0xb9, 0xb7, 0xb6, 0x4e, 0x51, 0x50085, 0x5, 0xba, 0xb3, 0xb9, 0x3003e, 0x52, 0xba, 0x200f9, 0x59, 0x200f8, 0x59, 0x50080, 0x1, 0xbb, 0x3a, 0x2a, 0x4003d, 0x5, 0xbc, 0x52, 0x60041, 0x4b, 0xbd, 0x18, 0xb, 0xbb, 0x3003e,
+0xbd, 0xbc, 0x100fd, 0x10038, 0x50036, 0x1, 0x40, 0x0, 0x41, 0x30037, 0x1, 0xbe, 0x200f8, 0xbf, 0x500ab, 0x31, 0xc0, 0x21, 0x20, 0x600a9, 0x1, 0xc1, 0xc0, 0x21, 0xbe, 0x200fe, 0xc1, 0x10038, 0x50036, 0x31, 0x43, 0x0, 0x44, 0x30037, 0x1, 0xc2, 0x200f8, 0xc3, 0x500aa, 0x31,
+0xc6, 0xc2, 0xc5, 0x500aa, 0x31, 0xc9, 0xc2, 0xc8, 0x500a6, 0x31, 0xca, 0xc6, 0xc9, 0x200fe, 0xca, 0x10038, 0x50036, 0x5, 0x94, 0x0, 0x95, 0x30037, 0x1, 0xcb, 0x30037, 0x1, 0xcc, 0x30037, 0x5, 0xcd, 0x30037, 0x5, 0xce, 0x30037, 0x5, 0xcf, 0x200f8, 0xd0, 0x300f7, 0xd1,
+0x0, 0x900fb, 0xcb, 0xd3, 0x0, 0xd2, 0x1, 0xd3, 0x2, 0xd3, 0x200f8, 0xd2, 0x50083, 0x5, 0xd4, 0xce, 0xcf, 0x70039, 0x5, 0xd5, 0xb7, 0xcc, 0xcd, 0xce, 0x50085, 0x5, 0xd6, 0xd4, 0xd5, 0x200fe, 0xd6, 0x200f8, 0xd3, 0x50083, 0x5, 0xd7, 0xce, 0xcf, 0x200fe, 0xd7,
+0x200f8, 0xd1, 0x100ff, 0x10038, 0x50036, 0x1, 0x99, 0x0, 0x41, 0x30037, 0x1, 0xd8, 0x200f8, 0xd9, 0x50080, 0x1, 0xdc, 0xd8, 0xdb, 0x50082, 0x1, 0xdd, 0xdc, 0x89, 0x50086, 0x1, 0xde, 0xdd, 0xdb, 0x50084, 0x1, 0xdf, 0xde, 0xdb, 0x200fe, 0xdf, 0x10038, 0x50036, 0x5, 0xb7,
+0x0, 0xb8, 0x30037, 0x1, 0xe0, 0x30037, 0x5, 0xe1, 0x30037, 0x5, 0xe2, 0x200f8, 0xe3, 0x300f7, 0xe4, 0x0, 0x1300fb, 0xe0, 0xed, 0x0, 0xe5, 0x1, 0xe6, 0x2, 0xe7, 0x4, 0xe8, 0x5, 0xe9, 0x3, 0xea, 0x6, 0xeb, 0x7, 0xec, 0x200f8, 0xe5, 0x50083, 0x5, 0xef,
+0xee, 0xe2, 0x50085, 0x5, 0xf0, 0xe2, 0xef, 0x200fe, 0xf0, 0x200f8, 0xe6, 0x500ba, 0x31, 0xf1, 0xe2, 0x4d, 0x600a9, 0x5, 0xf2, 0xf1, 0xee, 0x4d, 0x200fe, 0xf2, 0x200f8, 0xe7, 0x50085, 0x5, 0xf3, 0xe2, 0xe2, 0x50083, 0x5, 0xf4, 0xee, 0xf3, 0x200fe, 0xf4, 0x200f8, 0xe8,
+0x200fe, 0xee, 0x200f8, 0xe9, 0x200fe, 0x4d, 0x200f8, 0xea, 0x500b8, 0x31, 0xf5, 0xe2, 0x4d, 0x600a9, 0x5, 0xf7, 0xf5, 0xf6, 0xee, 0x200fe, 0xf7, 0x200f8, 0xeb, 0x4007f, 0x5, 0xf8, 0xe1, 0x6000c, 0x5, 0xfa, 0xf9, 0x1b, 0xf8, 0x50081, 0x5, 0xfb, 0xee, 0xfa, 0x50088, 0x5,
+0xfc, 0xee, 0xfb, 0x200fe, 0xfc, 0x200f8, 0xec, 0x50085, 0x5, 0xfd, 0xe1, 0xe1, 0x50081, 0x5, 0xfe, 0xfd, 0xee, 0x50088, 0x5, 0xff, 0xee, 0xfe, 0x200fe, 0xff, 0x200f8, 0xed, 0x200fe, 0x4d, 0x200f8, 0xe4, 0x100ff, 0x10038,
 };
\ No newline at end of file
@@ -1,5 +1,4 @@
 
-
 #ifdef VK_CONSTANTS_HOST
 struct TrainingBackwardPassPushConstantData
 {
@@ -10,7 +9,6 @@ layout(push_constant) uniform constants_
 #endif
 
     uint layer_neuron_count;
-    uint weights_per_neuron;
     uint activation_function;
     uint num_training_samples;
     uint cost_function;
@@ -23,4 +21,4 @@ layout(push_constant) uniform constants_
 #elif defined VK_CONSTANTS_GLSL
 }
 pc;
-#endif
\ No newline at end of file
+#endif
@@ -1,3 +0,0 @@
-#version 460
-#define USE_SOFTWARE_ATOMIC_ADD
-#include "kernel_training_backward_pass_base.glsl"
@@ -1,38 +0,0 @@
-std::array<uint32_t, 1470> vulkan_kernel_source_kernel_training_backward_pass_swadd_glsl = {0x7230203, 0x10300, 0xd000b, 0x354, 0x0, 0x20011, 0x1, 0x6000b, 0x1, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x4, 0x6e69616d, 0x0, 0xaf, 0x60010, 0x4, 0x11, 0x1, 0x1, 0x1, 0x40047, 0xaf, 0xb, 0x1c, 0x50048, 0xb8, 0x0, 0x23, 0x0, 0x50048, 0xb8, 0x1,
-0x23, 0x4, 0x50048, 0xb8, 0x2, 0x23, 0x8, 0x50048, 0xb8, 0x3, 0x23, 0xc, 0x50048, 0xb8, 0x4, 0x23, 0x10, 0x50048, 0xb8, 0x5, 0x23, 0x14, 0x50048, 0xb8, 0x6, 0x23, 0x18, 0x30047, 0xb8, 0x2, 0x40047, 0xe4, 0x6, 0x4, 0x40048, 0xe5, 0x0, 0x18, 0x50048, 0xe5,
-0x0, 0x23, 0x0, 0x30047, 0xe5, 0x2, 0x40047, 0xe7, 0x22, 0x0, 0x40047, 0xe7, 0x21, 0x3, 0x40047, 0xf5, 0x6, 0x4, 0x40048, 0xf6, 0x0, 0x18, 0x50048, 0xf6, 0x0, 0x23, 0x0, 0x30047, 0xf6, 0x2, 0x40047, 0xf8, 0x22, 0x0, 0x40047, 0xf8, 0x21, 0x2, 0x40047, 0xff,
-0x6, 0x4, 0x40048, 0x100, 0x0, 0x18, 0x50048, 0x100, 0x0, 0x23, 0x0, 0x30047, 0x100, 0x2, 0x40047, 0x102, 0x22, 0x0, 0x40047, 0x102, 0x21, 0x0, 0x40047, 0x127, 0x6, 0x4, 0x40048, 0x128, 0x0, 0x18, 0x50048, 0x128, 0x0, 0x23, 0x0, 0x30047, 0x128, 0x2, 0x40047, 0x12a,
-0x22, 0x0, 0x40047, 0x12a, 0x21, 0x5, 0x40047, 0x155, 0x6, 0x4, 0x50048, 0x156, 0x0, 0x23, 0x0, 0x30047, 0x156, 0x2, 0x40047, 0x158, 0x22, 0x0, 0x40047, 0x158, 0x21, 0x6, 0x40047, 0x169, 0x6, 0x4, 0x40048, 0x16a, 0x0, 0x18, 0x50048, 0x16a, 0x0, 0x23, 0x0, 0x30047,
-0x16a, 0x2, 0x40047, 0x16c, 0x22, 0x0, 0x40047, 0x16c, 0x21, 0x1, 0x40047, 0x19f, 0x6, 0x4, 0x50048, 0x1a0, 0x0, 0x23, 0x0, 0x30047, 0x1a0, 0x2, 0x40047, 0x1a2, 0x22, 0x0, 0x40047, 0x1a2, 0x21, 0x4, 0x40047, 0x1a8, 0x1, 0x0, 0x40047, 0x1a9, 0x1, 0x1, 0x40047, 0x1aa,
-0xb, 0x19, 0x20013, 0x2, 0x30021, 0x3, 0x2, 0x40015, 0x6, 0x20, 0x0, 0x30016, 0x8, 0x20, 0x4002b, 0x8, 0x26, 0x3f800000, 0x4002b, 0x8, 0x2e, 0x0, 0x20014, 0x2f, 0x4002b, 0x8, 0x34, 0x40000000, 0x4002b, 0x8, 0x35, 0xc0000000, 0x40015, 0x41, 0x20, 0x1, 0x4002b, 0x41, 0x42, 0x0,
-0x4002b, 0x41, 0x43, 0x1, 0x4002b, 0x8, 0x4c, 0x3c23d70a, 0x4002b, 0x6, 0x6a, 0x0, 0x40017, 0xad, 0x6, 0x3, 0x40020, 0xae, 0x1, 0xad, 0x4003b, 0xae, 0xaf, 0x1, 0x40020, 0xb0, 0x1, 0x6, 0x4002b, 0x6, 0xb4, 0x1, 0x9001e, 0xb8, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
-0x6, 0x40020, 0xb9, 0x9, 0xb8, 0x4003b, 0xb9, 0xba, 0x9, 0x4002b, 0x41, 0xbb, 0x3, 0x40020, 0xbc, 0x9, 0x6, 0x4002b, 0x41, 0xd8, 0x5, 0x3001d, 0xe4, 0x8, 0x3001e, 0xe5, 0xe4, 0x40020, 0xe6, 0xc, 0xe5, 0x4003b, 0xe6, 0xe7, 0xc, 0x40020, 0xeb, 0xc, 0x8, 0x4002b,
-0x41, 0xee, 0x6, 0x3001d, 0xf5, 0x8, 0x3001e, 0xf6, 0xf5, 0x40020, 0xf7, 0xc, 0xf6, 0x4003b, 0xf7, 0xf8, 0xc, 0x3001d, 0xff, 0x8, 0x3001e, 0x100, 0xff, 0x40020, 0x101, 0xc, 0x100, 0x4003b, 0x101, 0x102, 0xc, 0x4002b, 0x41, 0x109, 0x4, 0x4002b, 0x41, 0x10a, 0x2, 0x3001d,
-0x127, 0x8, 0x3001e, 0x128, 0x127, 0x40020, 0x129, 0xc, 0x128, 0x4003b, 0x129, 0x12a, 0xc, 0x3001d, 0x155, 0x6, 0x3001e, 0x156, 0x155, 0x40020, 0x157, 0xc, 0x156, 0x4003b, 0x157, 0x158, 0xc, 0x40020, 0x15c, 0xc, 0x6, 0x3001d, 0x169, 0x8, 0x3001e, 0x16a, 0x169, 0x40020, 0x16b, 0xc,
-0x16a, 0x4003b, 0x16b, 0x16c, 0xc, 0x3001d, 0x19f, 0x8, 0x3001e, 0x1a0, 0x19f, 0x40020, 0x1a1, 0xc, 0x1a0, 0x4003b, 0x1a1, 0x1a2, 0xc, 0x40032, 0x6, 0x1a8, 0x1, 0x40032, 0x6, 0x1a9, 0x1, 0x60033, 0xad, 0x1aa, 0x1a8, 0x1a9, 0xb4, 0x50036, 0x2, 0x4, 0x0, 0x3, 0x200f8, 0x5,
-0x300f7, 0x1ab, 0x0, 0x300fb, 0x6a, 0x1ac, 0x200f8, 0x1ac, 0x50041, 0xb0, 0xb1, 0xaf, 0x6a, 0x4003d, 0x6, 0xb2, 0xb1, 0x50041, 0xb0, 0xb5, 0xaf, 0xb4, 0x4003d, 0x6, 0xb6, 0xb5, 0x50041, 0xbc, 0xbd, 0xba, 0xbb, 0x4003d, 0x6, 0xbe, 0xbd, 0x500ae, 0x2f, 0xbf, 0xb6, 0xbe,
-0x400a8, 0x2f, 0xc0, 0xbf, 0x300f7, 0xc2, 0x0, 0x400fa, 0xc0, 0xc1, 0xc2, 0x200f8, 0xc1, 0x50041, 0xbc, 0xc4, 0xba, 0x42, 0x4003d, 0x6, 0xc5, 0xc4, 0x500ae, 0x2f, 0xc6, 0xb2, 0xc5, 0x200f9, 0xc2, 0x200f8, 0xc2, 0x700f5, 0x2f, 0xc7, 0xbf, 0x1ac, 0xc6, 0xc1, 0x300f7, 0xc9,
-0x0, 0x400fa, 0xc7, 0xc8, 0xc9, 0x200f8, 0xc8, 0x200f9, 0x1ab, 0x200f8, 0xc9, 0x50041, 0xbc, 0xcc, 0xba, 0x43, 0x4003d, 0x6, 0xcd, 0xcc, 0x50084, 0x6, 0xd1, 0xcd, 0xb6, 0x50041, 0xbc, 0xd3, 0xba, 0x42, 0x4003d, 0x6, 0xd4, 0xd3, 0x50084, 0x6, 0xd6, 0xd4, 0xb6, 0x50041,
-0xbc, 0xd9, 0xba, 0xd8, 0x4003d, 0x6, 0xda, 0xd9, 0x50084, 0x6, 0xdc, 0xda, 0xb6, 0x50080, 0x6, 0xea, 0xd6, 0xb2, 0x60041, 0xeb, 0xec, 0xe7, 0x42, 0xea, 0x4003d, 0x8, 0xed, 0xec, 0x50041, 0xbc, 0xef, 0xba, 0xee, 0x4003d, 0x6, 0xf0, 0xef, 0x500ab, 0x2f, 0xf1,
-0xf0, 0x6a, 0x300f7, 0xf3, 0x0, 0x400fa, 0xf1, 0xf2, 0x118, 0x200f8, 0x118, 0x50080, 0x6, 0x11c, 0xd4, 0xb4, 0x200f9, 0x11e, 0x200f8, 0x11e, 0x700f5, 0x8, 0x339, 0x2e, 0x118, 0x139, 0x11f, 0x700f5, 0x6, 0x32b, 0x6a, 0x118, 0x13b, 0x11f, 0x500b0, 0x2f, 0x126, 0x32b, 0xda, 0x400f6,
-0x120, 0x11f, 0x0, 0x400fa, 0x126, 0x11f, 0x120, 0x200f8, 0x11f, 0x50080, 0x6, 0x12d, 0xdc, 0x32b, 0x60041, 0xeb, 0x12e, 0x12a, 0x42, 0x12d, 0x4003d, 0x8, 0x12f, 0x12e, 0x50084, 0x6, 0x133, 0x32b, 0x11c, 0x50080, 0x6, 0x134, 0xb2, 0x133, 0x60041, 0xeb, 0x135, 0x102, 0x42, 0x134,
-0x4003d, 0x8, 0x136, 0x135, 0x50085, 0x8, 0x137, 0x12f, 0x136, 0x50081, 0x8, 0x139, 0x339, 0x137, 0x50080, 0x6, 0x13b, 0x32b, 0x43, 0x200f9, 0x11e, 0x200f8, 0x120, 0x50041, 0xbc, 0x13d, 0xba, 0x10a, 0x4003d, 0x6, 0x13e, 0x13d, 0x300f7, 0x2b6, 0x0, 0x1300fb, 0x13e, 0x291, 0x0, 0x292,
-0x1, 0x299, 0x2, 0x29d, 0x4, 0x2a4, 0x5, 0x2a5, 0x3, 0x2a6, 0x6, 0x2aa, 0x7, 0x2b0, 0x200f8, 0x2b0, 0x50085, 0x8, 0x2b3, 0xed, 0xed, 0x50081, 0x8, 0x2b4, 0x2b3, 0x26, 0x50088, 0x8, 0x2b5, 0x26, 0x2b4, 0x200f9, 0x2b6, 0x200f8, 0x2aa, 0x4007f, 0x8, 0x2ac, 0xed, 0x6000c,
-0x8, 0x2ad, 0x1, 0x1b, 0x2ac, 0x50081, 0x8, 0x2ae, 0x26, 0x2ad, 0x50088, 0x8, 0x2af, 0x26, 0x2ae, 0x200f9, 0x2b6, 0x200f8, 0x2a6, 0x500b8, 0x2f, 0x2a8, 0xed, 0x2e, 0x600a9, 0x8, 0x2a9, 0x2a8, 0x4c, 0x26, 0x200f9, 0x2b6, 0x200f8, 0x2a5, 0x200f9, 0x2b6, 0x200f8, 0x2a4, 0x200f9, 0x2b6,
-0x200f8, 0x29d, 0x50085, 0x8, 0x308, 0x35, 0xed, 0x6000c, 0x8, 0x309, 0x1, 0x1b, 0x308, 0x50081, 0x8, 0x30a, 0x26, 0x309, 0x50088, 0x8, 0x30b, 0x34, 0x30a, 0x50083, 0x8, 0x30c, 0x30b, 0x26, 0x50085, 0x8, 0x2a2, 0x30c, 0x30c, 0x50083, 0x8, 0x2a3, 0x26, 0x2a2, 0x200f9, 0x2b6,
-0x200f8, 0x299, 0x500b8, 0x2f, 0x29b, 0xed, 0x2e, 0x600a9, 0x8, 0x29c, 0x29b, 0x2e, 0x26, 0x200f9, 0x2b6, 0x200f8, 0x292, 0x4007f, 0x8, 0x2c5, 0xed, 0x6000c, 0x8, 0x2c6, 0x1, 0x1b, 0x2c5, 0x50081, 0x8, 0x2c7, 0x26, 0x2c6, 0x50088, 0x8, 0x2c8, 0x26, 0x2c7, 0x50083, 0x8, 0x297,
-0x26, 0x2c8, 0x50085, 0x8, 0x298, 0x2c8, 0x297, 0x200f9, 0x2b6, 0x200f8, 0x291, 0x200f9, 0x2b6, 0x200f8, 0x2b6, 0x1500f5, 0x8, 0x336, 0x2e, 0x291, 0x298, 0x292, 0x29c, 0x299, 0x2a3, 0x29d, 0x26, 0x2a4, 0x2e, 0x2a5, 0x2a9, 0x2a6, 0x2af, 0x2aa, 0x2b5, 0x2b0, 0x50085, 0x8, 0x143, 0x339,
-0x336, 0x200f9, 0xf3, 0x200f8, 0xf2, 0x60041, 0xeb, 0xfc, 0xf8, 0x42, 0xea, 0x4003d, 0x8, 0xfd, 0xfc, 0x60041, 0xeb, 0x106, 0x102, 0x42, 0xea, 0x4003d, 0x8, 0x107, 0x106, 0x50041, 0xbc, 0x10c, 0xba, 0x109, 0x4003d, 0x6, 0x10d, 0x10c, 0x50041, 0xbc, 0x10f, 0xba, 0x10a, 0x4003d,
-0x6, 0x110, 0x10f, 0x300f7, 0x1da, 0x0, 0x700fb, 0x10d, 0x1ce, 0x0, 0x1d2, 0x1, 0x1ce, 0x200f8, 0x1d2, 0x50083, 0x8, 0x1d5, 0xfd, 0x107, 0x300f7, 0x210, 0x0, 0x1300fb, 0x110, 0x1eb, 0x0, 0x1ec, 0x1, 0x1f3, 0x2, 0x1f7, 0x4, 0x1fe, 0x5, 0x1ff, 0x3, 0x200, 0x6, 0x204,
-0x7, 0x20a, 0x200f8, 0x20a, 0x50085, 0x8, 0x20d, 0xed, 0xed, 0x50081, 0x8, 0x20e, 0x20d, 0x26, 0x50088, 0x8, 0x20f, 0x26, 0x20e, 0x200f9, 0x210, 0x200f8, 0x204, 0x4007f, 0x8, 0x206, 0xed, 0x6000c, 0x8, 0x207, 0x1, 0x1b, 0x206, 0x50081, 0x8, 0x208, 0x26, 0x207, 0x50088, 0x8,
-0x209, 0x26, 0x208, 0x200f9, 0x210, 0x200f8, 0x200, 0x500b8, 0x2f, 0x202, 0xed, 0x2e, 0x600a9, 0x8, 0x203, 0x202, 0x4c, 0x26, 0x200f9, 0x210, 0x200f8, 0x1ff, 0x200f9, 0x210, 0x200f8, 0x1fe, 0x200f9, 0x210, 0x200f8, 0x1f7, 0x50085, 0x8, 0x262, 0x35, 0xed, 0x6000c, 0x8, 0x263, 0x1, 0x1b,
-0x262, 0x50081, 0x8, 0x264, 0x26, 0x263, 0x50088, 0x8, 0x265, 0x34, 0x264, 0x50083, 0x8, 0x266, 0x265, 0x26, 0x50085, 0x8, 0x1fc, 0x266, 0x266, 0x50083, 0x8, 0x1fd, 0x26, 0x1fc, 0x200f9, 0x210, 0x200f8, 0x1f3, 0x500b8, 0x2f, 0x1f5, 0xed, 0x2e, 0x600a9, 0x8, 0x1f6, 0x1f5, 0x2e,
-0x26, 0x200f9, 0x210, 0x200f8, 0x1ec, 0x4007f, 0x8, 0x21f, 0xed, 0x6000c, 0x8, 0x220, 0x1, 0x1b, 0x21f, 0x50081, 0x8, 0x221, 0x26, 0x220, 0x50088, 0x8, 0x222, 0x26, 0x221, 0x50083, 0x8, 0x1f1, 0x26, 0x222, 0x50085, 0x8, 0x1f2, 0x222, 0x1f1, 0x200f9, 0x210, 0x200f8, 0x1eb, 0x200f9,
-0x210, 0x200f8, 0x210, 0x1500f5, 0x8, 0x34a, 0x2e, 0x1eb, 0x1f2, 0x1ec, 0x1f6, 0x1f3, 0x1fd, 0x1f7, 0x26, 0x1fe, 0x2e, 0x1ff, 0x203, 0x200, 0x209, 0x204, 0x20f, 0x20a, 0x50085, 0x8, 0x1d9, 0x1d5, 0x34a, 0x200f9, 0x1da, 0x200f8, 0x1ce, 0x50083, 0x8, 0x1d1, 0xfd, 0x107, 0x200f9, 0x1da,
-0x200f8, 0x1da, 0x700f5, 0x8, 0x34d, 0x1d1, 0x1ce, 0x1d9, 0x210, 0x200f9, 0xf3, 0x200f8, 0xf3, 0x700f5, 0x8, 0x352, 0x34d, 0x1da, 0x143, 0x2b6, 0x50080, 0x6, 0x148, 0xcd, 0xb4, 0x50084, 0x6, 0x149, 0xb2, 0x148, 0x200f9, 0x14b, 0x200f8, 0x14b, 0x700f5, 0x6, 0x34e, 0x6a, 0xf3, 0x180,
-0x14e, 0x500b0, 0x2f, 0x153, 0x34e, 0xcd, 0x400f6, 0x14d, 0x14e, 0x0, 0x400fa, 0x153, 0x14c, 0x14d, 0x200f8, 0x14c, 0x50080, 0x6, 0x15b, 0x149, 0x34e, 0x60041, 0x15c, 0x15d, 0x158, 0x42, 0x15b, 0x4003d, 0x6, 0x15e, 0x15d, 0x200f9, 0x15f, 0x200f8, 0x15f, 0x700f5, 0x6, 0x353, 0x15e, 0x14c,
-0x17b, 0x15f, 0x4007c, 0x8, 0x167, 0x353, 0x50080, 0x6, 0x16f, 0xd1, 0x34e, 0x60041, 0xeb, 0x170, 0x16c, 0x42, 0x16f, 0x4003d, 0x8, 0x171, 0x170, 0x50085, 0x8, 0x172, 0x352, 0x171, 0x50081, 0x8, 0x173, 0x167, 0x172, 0x4007c, 0x6, 0x174, 0x173, 0x900e6, 0x6, 0x17b, 0x15d, 0xb4,
-0x6a, 0x6a, 0x174, 0x353, 0x500ab, 0x2f, 0x17e, 0x17b, 0x353, 0x400f6, 0x161, 0x15f, 0x0, 0x400fa, 0x17e, 0x15f, 0x161, 0x200f8, 0x161, 0x200f9, 0x14e, 0x200f8, 0x14e, 0x50080, 0x6, 0x180, 0x34e, 0x43, 0x200f9, 0x14b, 0x200f8, 0x14d, 0x50080, 0x6, 0x185, 0x149, 0xcd, 0x60041, 0x15c, 0x186,
-0x158, 0x42, 0x185, 0x4003d, 0x6, 0x187, 0x186, 0x200f9, 0x188, 0x200f8, 0x188, 0x700f5, 0x6, 0x34f, 0x187, 0x14d, 0x19b, 0x188, 0x4007c, 0x8, 0x190, 0x34f, 0x50081, 0x8, 0x192, 0x190, 0x352, 0x4007c, 0x6, 0x193, 0x192, 0x900e6, 0x6, 0x19b, 0x186, 0xb4, 0x6a, 0x6a, 0x193, 0x34f,
-0x500ab, 0x2f, 0x19e, 0x19b, 0x34f, 0x400f6, 0x18a, 0x188, 0x0, 0x400fa, 0x19e, 0x188, 0x18a, 0x200f8, 0x18a, 0x60041, 0xeb, 0x1a7, 0x1a2, 0x42, 0xea, 0x3003e, 0x1a7, 0x352, 0x200f9, 0x1ab, 0x200f8, 0x1ab, 0x100fd, 0x10038,
-};
\ No newline at end of file
@@ -0,0 +1,73 @@
+#version 460
+///
+/// Vulkan kernels implementing network calculations, and backpropagation
+///
+
+#define VK_CONSTANTS_GLSL
+#include "kernel_training_calc_gradient_constants.h"
+
+layout(std430, binding = 0) readonly buffer delta_k_vector_buf {
+   float delta_k_vector[];
+};
+
+layout(std430, binding = 1) readonly buffer prev_activations_buf {
+   float prev_activations[];
+};
+
+layout(std430, binding = 2) buffer current_layer_gradient_buf {
+   float current_layer_gradient[];
+};
+
+#include "common.glsl"
+
+layout(local_size_x = TRAINING_CALC_GRADIENT_TILE_SIZE, local_size_y = TRAINING_CALC_GRADIENT_TILE_SIZE, local_size_z = 1) in;
+
+shared float delta_k_tile[TRAINING_CALC_GRADIENT_TILE_SIZE][TRAINING_CALC_GRADIENT_TILE_SIZE];           // [neuron][sample]
+shared float prev_activations_tile[TRAINING_CALC_GRADIENT_TILE_SIZE][TRAINING_CALC_GRADIENT_TILE_SIZE]; // [sample][weight]
+
+// Accumulates the gradient of a layer: gradient += transpose(delta_k) * [prev_activations, 1]
+// Every invocation owns one gradient element and sums the training samples in a fixed order, so the result is deterministic.
+void main()
+{
+    const uint weight_id = gl_GlobalInvocationID.x; // weight_id == weights_per_neuron is the bias
+    const uint layer_neuron_id = gl_GlobalInvocationID.y;
+    const uint local_x = gl_LocalInvocationID.x;
+    const uint local_y = gl_LocalInvocationID.y;
+    const uint tile_neuron_base = gl_WorkGroupID.y * TRAINING_CALC_GRADIENT_TILE_SIZE;
+
+    float acc = 0.0;
+    for (uint sample_base = 0; sample_base < pc.num_training_samples; sample_base += TRAINING_CALC_GRADIENT_TILE_SIZE) {
+        const uint delta_k_sample = sample_base + local_x;
+        const uint delta_k_neuron = tile_neuron_base + local_y;
+        delta_k_tile[local_y][local_x] = (delta_k_sample < pc.num_training_samples && delta_k_neuron < pc.layer_neuron_count) ? delta_k_vector[delta_k_sample * pc.layer_neuron_count + delta_k_neuron] : 0.0;
+
+        const uint activation_sample = sample_base + local_y;
+        float activation = 0.0;
+        if (activation_sample < pc.num_training_samples) {
+            if (weight_id < pc.weights_per_neuron) {
+                activation = prev_activations[activation_sample * pc.weights_per_neuron + weight_id];
+            } else if (weight_id == pc.weights_per_neuron) {
+                activation = 1.0; // bias
+            }
+        }
+        prev_activations_tile[local_y][local_x] = activation;
+
+        memoryBarrierShared();
+        barrier();
+
+        for (uint k = 0; k < TRAINING_CALC_GRADIENT_TILE_SIZE; ++k) {
+            acc += delta_k_tile[local_y][k] * prev_activations_tile[k][local_x];
+        }
+
+        memoryBarrierShared();
+        barrier();
+    }
+
+    if (layer_neuron_id < pc.layer_neuron_count) {
+        if (weight_id < pc.weights_per_neuron) {
+            current_layer_gradient[layer_neuron_id * GetRowStride(pc.weights_per_neuron) + weight_id] += acc;
+        } else if (weight_id == pc.weights_per_neuron) {
+            current_layer_gradient[GetBiasOffset(pc.layer_neuron_count, pc.weights_per_neuron) + layer_neuron_id] += acc;
+        }
+    }
+}
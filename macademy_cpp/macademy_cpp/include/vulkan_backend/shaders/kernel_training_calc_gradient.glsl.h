@@ -0,0 +1,28 @@
+std::array<uint32_t, 1079> vulkan_kernel_source_kernel_training_calc_gradient_glsl = {0x7230203, 0x10300, 0x0, 0xc4, 0x0, 0x20011, 0x1, 0x6000b, 0xc3, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x8000f, 0x5, 0x1f, 0x6e69616d, 0x0, 0x23, 0x2a, 0x2f, 0x60010, 0x1f, 0x11, 0x10, 0x10, 0x1, 0x30047, 0x2, 0x2, 0x50048, 0x2, 0x0, 0x23, 0x0, 0x50048, 0x2,
+0x1, 0x23, 0x4, 0x50048, 0x2, 0x2, 0x23, 0x8, 0x40047, 0x6, 0x6, 0x4, 0x30047, 0x7, 0x2, 0x50048, 0x7, 0x0, 0x23, 0x0, 0x40048, 0x7, 0x0, 0x18, 0x40047, 0x8, 0x22, 0x0, 0x40047, 0x8, 0x21, 0x0, 0x40047, 0xc, 0x6, 0x4, 0x30047, 0xd, 0x2, 0x50048,
+0xd, 0x0, 0x23, 0x0, 0x40048, 0xd, 0x0, 0x18, 0x40047, 0xe, 0x22, 0x0, 0x40047, 0xe, 0x21, 0x1, 0x40047, 0x11, 0x6, 0x4, 0x30047, 0x12, 0x2, 0x50048, 0x12, 0x0, 0x23, 0x0, 0x40047, 0x13, 0x22, 0x0, 0x40047, 0x13, 0x21, 0x2, 0x40047, 0x17, 0x1, 0x2,
+0x40047, 0x23, 0xb, 0x1c, 0x40047, 0x2a, 0xb, 0x1b, 0x40047, 0x2f, 0xb, 0x1a, 0x40015, 0x1, 0x20, 0x0, 0x5001e, 0x2, 0x1, 0x1, 0x1, 0x40020, 0x4, 0x9, 0x2, 0x4003b, 0x4, 0x3, 0x9, 0x30016, 0x5, 0x20, 0x3001d, 0x6, 0x5, 0x3001e, 0x7, 0x6, 0x40020, 0x9,
+0xc, 0x7, 0x4003b, 0x9, 0x8, 0xc, 0x40015, 0xa, 0x20, 0x1, 0x4002b, 0xa, 0xb, 0x0, 0x3001d, 0xc, 0x5, 0x3001e, 0xd, 0xc, 0x40020, 0xf, 0xc, 0xd, 0x4003b, 0xf, 0xe, 0xc, 0x4002b, 0xa, 0x10, 0x1, 0x3001d, 0x11, 0x5, 0x3001e, 0x12, 0x11, 0x40020, 0x14,
+0xc, 0x12, 0x4003b, 0x14, 0x13, 0xc, 0x4002b, 0xa, 0x15, 0x2, 0x4002b, 0x1, 0x16, 0xffffffff, 0x40032, 0x1, 0x17, 0xffffffff, 0x4002b, 0xa, 0x18, 0x10, 0x4002b, 0x1, 0x1a, 0x10, 0x4001c, 0x1b, 0x5, 0x1a, 0x4001c, 0x1c, 0x1b, 0x1a, 0x40020, 0x1d, 0x4, 0x1c, 0x4003b, 0x1d,
+0x19, 0x4, 0x4003b, 0x1d, 0x1e, 0x4, 0x20013, 0x20, 0x30021, 0x21, 0x20, 0x40017, 0x24, 0x1, 0x3, 0x40020, 0x25, 0x1, 0x24, 0x4003b, 0x25, 0x23, 0x1, 0x4003b, 0x25, 0x2a, 0x1, 0x4003b, 0x25, 0x2f, 0x1, 0x4002b, 0x5, 0x33, 0x0, 0x40020, 0x35, 0x7, 0x5, 0x4002b,
+0x1, 0x36, 0x0, 0x40020, 0x38, 0x7, 0x1, 0x40020, 0x40, 0x9, 0x1, 0x20014, 0x43, 0x40020, 0x56, 0xc, 0x5, 0x40020, 0x5a, 0x4, 0x5, 0x4002b, 0x5, 0x74, 0x3f800000, 0x4002b, 0x1, 0x77, 0x1, 0x4002b, 0x1, 0x78, 0x108, 0x4002b, 0x1, 0x79, 0x2, 0x40021, 0x9d, 0x1,
+0x1, 0x50021, 0xb0, 0x1, 0x1, 0x1, 0x50036, 0x20, 0x1f, 0x0, 0x21, 0x200f8, 0x22, 0x4003b, 0x35, 0x34, 0x7, 0x4003b, 0x38, 0x37, 0x7, 0x4003b, 0x35, 0x5d, 0x7, 0x4003b, 0x38, 0x7a, 0x7, 0x4003d, 0x24, 0x26, 0x23, 0x50051, 0x1, 0x27, 0x26, 0x0, 0x4003d, 0x24,
+0x28, 0x23, 0x50051, 0x1, 0x29, 0x28, 0x1, 0x4003d, 0x24, 0x2b, 0x2a, 0x50051, 0x1, 0x2c, 0x2b, 0x0, 0x4003d, 0x24, 0x2d, 0x2a, 0x50051, 0x1, 0x2e, 0x2d, 0x1, 0x4003d, 0x24, 0x30, 0x2f, 0x50051, 0x1, 0x31, 0x30, 0x1, 0x50084, 0x1, 0x32, 0x31, 0x1a, 0x3003e,
+0x34, 0x33, 0x3003e, 0x37, 0x36, 0x200f9, 0x39, 0x200f8, 0x39, 0x400f6, 0x3d, 0x3c, 0x0, 0x200f9, 0x3a, 0x200f8, 0x3a, 0x4003d, 0x1, 0x3e, 0x37, 0x50041, 0x40, 0x3f, 0x3, 0x15, 0x4003d, 0x1, 0x41, 0x3f, 0x500b0, 0x43, 0x42, 0x3e, 0x41, 0x400fa, 0x42, 0x3b, 0x3d, 0x200f8,
+0x3b, 0x4003d, 0x1, 0x44, 0x37, 0x50080, 0x1, 0x45, 0x44, 0x2c, 0x50080, 0x1, 0x46, 0x32, 0x2e, 0x50041, 0x40, 0x47, 0x3, 0x15, 0x4003d, 0x1, 0x48, 0x47, 0x500b0, 0x43, 0x49, 0x45, 0x48, 0x50041, 0x40, 0x4a, 0x3, 0xb, 0x4003d, 0x1, 0x4b, 0x4a, 0x500b0, 0x43,
+0x4c, 0x46, 0x4b, 0x500a7, 0x43, 0x4d, 0x49, 0x4c, 0x300f7, 0x50, 0x0, 0x400fa, 0x4d, 0x4e, 0x4f, 0x200f8, 0x4e, 0x50041, 0x40, 0x51, 0x3, 0xb, 0x4003d, 0x1, 0x52, 0x51, 0x50084, 0x1, 0x53, 0x45, 0x52, 0x50080, 0x1, 0x54, 0x53, 0x46, 0x60041, 0x56, 0x55, 0x8,
+0xb, 0x54, 0x4003d, 0x5, 0x57, 0x55, 0x200f9, 0x50, 0x200f8, 0x4f, 0x200f9, 0x50, 0x200f8, 0x50, 0x700f5, 0x5, 0x58, 0x57, 0x4e, 0x33, 0x4f, 0x60041, 0x5a, 0x59, 0x19, 0x2e, 0x2c, 0x3003e, 0x59, 0x58, 0x4003d, 0x1, 0x5b, 0x37, 0x50080, 0x1, 0x5c, 0x5b, 0x2e, 0x3003e,
+0x5d, 0x33, 0x50041, 0x40, 0x5e, 0x3, 0x15, 0x4003d, 0x1, 0x5f, 0x5e, 0x500b0, 0x43, 0x60, 0x5c, 0x5f, 0x300f7, 0x61, 0x0, 0x400fa, 0x60, 0x62, 0x61, 0x200f8, 0x62, 0x50041, 0x40, 0x63, 0x3, 0x10, 0x4003d, 0x1, 0x64, 0x63, 0x500b0, 0x43, 0x65, 0x27, 0x64, 0x300f7,
+0x66, 0x0, 0x400fa, 0x65, 0x67, 0x68, 0x200f8, 0x67, 0x50041, 0x40, 0x69, 0x3, 0x10, 0x4003d, 0x1, 0x6a, 0x69, 0x50084, 0x1, 0x6b, 0x5c, 0x6a, 0x50080, 0x1, 0x6c, 0x6b, 0x27, 0x60041, 0x56, 0x6d, 0xe, 0xb, 0x6c, 0x4003d, 0x5, 0x6e, 0x6d, 0x3003e, 0x5d, 0x6e,
+0x200f9, 0x66, 0x200f8, 0x68, 0x50041, 0x40, 0x6f, 0x3, 0x10, 0x4003d, 0x1, 0x70, 0x6f, 0x500aa, 0x43, 0x71, 0x27, 0x70, 0x300f7, 0x72, 0x0, 0x400fa, 0x71, 0x73, 0x72, 0x200f8, 0x73, 0x3003e, 0x5d, 0x74, 0x200f9, 0x72, 0x200f8, 0x72, 0x200f9, 0x66, 0x200f8, 0x66, 0x200f9, 0x61,
+0x200f8, 0x61, 0x4003d, 0x5, 0x75, 0x5d, 0x60041, 0x5a, 0x76, 0x1e, 0x2e, 0x2c, 0x3003e, 0x76, 0x75, 0x300e1, 0x77, 0x78, 0x400e0, 0x79, 0x79, 0x78, 0x3003e, 0x7a, 0x36, 0x200f9, 0x7b, 0x200f8, 0x7b, 0x400f6, 0x7f, 0x7e, 0x0, 0x200f9, 0x7c, 0x200f8, 0x7c, 0x4003d, 0x1, 0x80,
+0x7a, 0x500b0, 0x43, 0x81, 0x80, 0x1a, 0x400fa, 0x81, 0x7d, 0x7f, 0x200f8, 0x7d, 0x4003d, 0x5, 0x82, 0x34, 0x4003d, 0x1, 0x83, 0x7a, 0x60041, 0x5a, 0x84, 0x19, 0x2e, 0x83, 0x4003d, 0x5, 0x85, 0x84, 0x4003d, 0x1, 0x86, 0x7a, 0x60041, 0x5a, 0x87, 0x1e, 0x86, 0x2c,
+0x4003d, 0x5, 0x88, 0x87, 0x50085, 0x5, 0x89, 0x85, 0x88, 0x50081, 0x5, 0x8a, 0x82, 0x89, 0x3003e, 0x34, 0x8a, 0x200f9, 0x7e, 0x200f8, 0x7e, 0x4003d, 0x1, 0x8b, 0x7a, 0x50080, 0x1, 0x8c, 0x8b, 0x77, 0x3003e, 0x7a, 0x8c, 0x200f9, 0x7b, 0x200f8, 0x7f, 0x300e1, 0x77, 0x78,
+0x400e0, 0x79, 0x79, 0x78, 0x200f9, 0x3c, 0x200f8, 0x3c, 0x4003d, 0x1, 0x8d, 0x37, 0x50080, 0x1, 0x8e, 0x8d, 0x1a, 0x3003e, 0x37, 0x8e, 0x200f9, 0x39, 0x200f8, 0x3d, 0x50041, 0x40, 0x8f, 0x3, 0xb, 0x4003d, 0x1, 0x90, 0x8f, 0x500b0, 0x43, 0x91, 0x29, 0x90, 0x300f7, 0x92,
+0x0, 0x400fa, 0x91, 0x93, 0x92, 0x200f8, 0x93, 0x50041, 0x40, 0x94, 0x3, 0x10, 0x4003d, 0x1, 0x95, 0x94, 0x500b0, 0x43, 0x96, 0x27, 0x95, 0x300f7, 0x97, 0x0, 0x400fa, 0x96, 0x98, 0x99, 0x200f8, 0x98, 0x50041, 0x40, 0x9a, 0x3, 0x10, 0x4003d, 0x1, 0x9b, 0x9a, 0x50039,
+0x1, 0x9e, 0x9c, 0x9b, 0x50084, 0x1, 0x9f, 0x29, 0x9e, 0x50080, 0x1, 0xa0, 0x9f, 0x27, 0x60041, 0x56, 0xa1, 0x13, 0xb, 0xa0, 0x4003d, 0x5, 0xa2, 0xa1, 0x4003d, 0x5, 0xa3, 0x34, 0x50081, 0x5, 0xa4, 0xa2, 0xa3, 0x60041, 0x56, 0xa5, 0x13, 0xb, 0xa0, 0x3003e,
+0xa5, 0xa4, 0x200f9, 0x97, 0x200f8, 0x99, 0x50041, 0x40, 0xa6, 0x3, 0x10, 0x4003d, 0x1, 0xa7, 0xa6, 0x500aa, 0x43, 0xa8, 0x27, 0xa7, 0x300f7, 0xa9, 0x0, 0x400fa, 0xa8, 0xaa, 0xa9, 0x200f8, 0xaa, 0x50041, 0x40, 0xab, 0x3, 0xb, 0x4003d, 0x1, 0xac, 0xab, 0x50041, 0x40,
+0xad, 0x3, 0x10, 0x4003d, 0x1, 0xae, 0xad, 0x60039, 0x1, 0xb1, 0xaf, 0xac, 0xae, 0x50080, 0x1, 0xb2, 0xb1, 0x29, 0x60041, 0x56, 0xb3, 0x13, 0xb, 0xb2, 0x4003d, 0x5, 0xb4, 0xb3, 0x4003d, 0x5, 0xb5, 0x34, 0x50081, 0x5, 0xb6, 0xb4, 0xb5, 0x60041, 0x56, 0xb7,
+0x13, 0xb, 0xb2, 0x3003e, 0xb7, 0xb6, 0x200f9, 0xa9, 0x200f8, 0xa9, 0x200f9, 0x97, 0x200f8, 0x97, 0x200f9, 0x92, 0x200f8, 0x92, 0x100fd, 0x10038, 0x50036, 0x1, 0x9c, 0x0, 0x9d, 0x30037, 0x1, 0xb8, 0x200f8, 0xb9, 0x50080, 0x1, 0xba, 0xb8, 0x1a, 0x50082, 0x1, 0xbb, 0xba, 0x77,
+0x50086, 0x1, 0xbc, 0xbb, 0x1a, 0x50084, 0x1, 0xbd, 0xbc, 0x1a, 0x200fe, 0xbd, 0x10038, 0x50036, 0x1, 0xaf, 0x0, 0xb0, 0x30037, 0x1, 0xbe, 0x30037, 0x1, 0xbf, 0x200f8, 0xc0, 0x50039, 0x1, 0xc1, 0x9c, 0xbf, 0x50084, 0x1, 0xc2, 0xbe, 0xc1, 0x200fe, 0xc2, 0x10038,
+};
\ No newline at end of file
@@ -0,0 +1,24 @@
+
+// Side length of the square work groups of the gradient kernel. Each work group reduces this many training samples per iteration.
+#define TRAINING_CALC_GRADIENT_TILE_SIZE 16
+
+#ifdef VK_CONSTANTS_HOST
+struct TrainingCalcGradientPushConstantData
+{
+#define uint uint32_t
+#elif defined VK_CONSTANTS_GLSL
+layout(push_constant) uniform constants_
+{
+#endif
+
+    uint layer_neuron_count;
+    uint weights_per_neuron;
+    uint num_training_samples;
+
+#ifdef VK_CONSTANTS_HOST
+};
+#undef uint
+#elif defined VK_CONSTANTS_GLSL
+}
+pc;
+#endif
@@ -37,19 +37,20 @@ void main()
     }
 
    const uint prev_layer_neuron_count = pc.weights_per_neuron;
-   const uint neuron_data_size = pc.weights_per_neuron + 1;
    const uint prev_layer_offset = prev_layer_neuron_count * trainingSampleId;
    const uint layer_offset = pc.layer_neuron_count * trainingSampleId;
-   const uint neuron_weights_biases_base_offset = layer_neuron_id * neuron_data_size;
+   const uint neuron_weights_base_offset = layer_neuron_id * GetRowStride(pc.weights_per_neuron);
 
    // Calculate ZValues for layer
    float acc = 0;
    for (uint i = 0; i < pc.weights_per_neuron; ++i) {
-      acc += weights_biases[neuron_weights_biases_base_offset + i] * prev_activations[prev_layer_offset + i];
+      acc += weights_biases[neuron_weights_base_offset + i] * prev_activations[prev_layer_offset + i];
    }
-   acc += weights_biases[neuron_weights_biases_base_offset + pc.weights_per_neuron]; // bias
+   acc += weights_biases[GetBiasOffset(pc.layer_neuron_count, pc.weights_per_neuron) + layer_neuron_id]; // bias
 
-   // Store ZValues and the result of the activation function
-   zvalues[layer_offset + layer_neuron_id] = acc;
-   activations[layer_offset + layer_neuron_id] = ActivationFunction(pc.activation_function, acc);
+   // Store the result of the activation function, and the ZValues if the backward pass needs them
+   if (ActivationFunctionUsesZValues(SelectActivationFunction(pc.activation_function))) {
+      zvalues[layer_offset + layer_neuron_id] = acc;
+   }
+   activations[layer_offset + layer_neuron_id] = ActivationFunction(SelectActivationFunction(pc.activation_function), acc);
 }
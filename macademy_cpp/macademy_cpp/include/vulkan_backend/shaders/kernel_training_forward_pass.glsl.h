@@ -1,22 +1,29 @@
-std::array<uint32_t, 811> vulkan_kernel_source_kernel_training_forward_pass_glsl = {0x7230203, 0x10300, 0xd000b, 0x117, 0x0, 0x20011, 0x1, 0x6000b, 0x1, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x4, 0x6e69616d, 0x0, 0x55, 0x60010, 0x4, 0x11, 0x1, 0x1, 0x1, 0x40047, 0x55, 0xb, 0x1c, 0x50048, 0x5f, 0x0, 0x23, 0x0, 0x50048, 0x5f, 0x1,
-0x23, 0x4, 0x50048, 0x5f, 0x2, 0x23, 0x8, 0x50048, 0x5f, 0x3, 0x23, 0xc, 0x30047, 0x5f, 0x2, 0x40047, 0x92, 0x6, 0x4, 0x40048, 0x93, 0x0, 0x18, 0x50048, 0x93, 0x0, 0x23, 0x0, 0x30047, 0x93, 0x2, 0x40047, 0x95, 0x22, 0x0, 0x40047, 0x95, 0x21, 0x0, 0x40047,
-0x9c, 0x6, 0x4, 0x40048, 0x9d, 0x0, 0x18, 0x50048, 0x9d, 0x0, 0x23, 0x0, 0x30047, 0x9d, 0x2, 0x40047, 0x9f, 0x22, 0x0, 0x40047, 0x9f, 0x21, 0x1, 0x40047, 0xb2, 0x6, 0x4, 0x50048, 0xb3, 0x0, 0x23, 0x0, 0x30047, 0xb3, 0x2, 0x40047, 0xb5, 0x22, 0x0, 0x40047,
-0xb5, 0x21, 0x3, 0x40047, 0xbb, 0x6, 0x4, 0x50048, 0xbc, 0x0, 0x23, 0x0, 0x30047, 0xbc, 0x2, 0x40047, 0xbe, 0x22, 0x0, 0x40047, 0xbe, 0x21, 0x2, 0x40047, 0xc9, 0x1, 0x0, 0x40047, 0xca, 0x1, 0x1, 0x40047, 0xcb, 0xb, 0x19, 0x20013, 0x2, 0x30021, 0x3, 0x2,
-0x40015, 0x6, 0x20, 0x0, 0x30016, 0x8, 0x20, 0x4002b, 0x8, 0x1a, 0x3f800000, 0x4002b, 0x8, 0x22, 0x0, 0x20014, 0x23, 0x4002b, 0x8, 0x28, 0x40000000, 0x4002b, 0x8, 0x29, 0xc0000000, 0x40015, 0x35, 0x20, 0x1, 0x4002b, 0x35, 0x36, 0x0, 0x4002b, 0x35, 0x37, 0x1, 0x4002b, 0x8, 0x40,
-0x3c23d70a, 0x40017, 0x53, 0x6, 0x3, 0x40020, 0x54, 0x1, 0x53, 0x4003b, 0x54, 0x55, 0x1, 0x4002b, 0x6, 0x56, 0x0, 0x40020, 0x57, 0x1, 0x6, 0x4002b, 0x6, 0x5b, 0x1, 0x6001e, 0x5f, 0x6, 0x6, 0x6, 0x6, 0x40020, 0x60, 0x9, 0x5f, 0x4003b, 0x60, 0x61, 0x9, 0x4002b,
-0x35, 0x62, 0x3, 0x40020, 0x63, 0x9, 0x6, 0x4002b, 0x35, 0x73, 0x2, 0x3001d, 0x92, 0x8, 0x3001e, 0x93, 0x92, 0x40020, 0x94, 0xc, 0x93, 0x4003b, 0x94, 0x95, 0xc, 0x40020, 0x99, 0xc, 0x8, 0x3001d, 0x9c, 0x8, 0x3001e, 0x9d, 0x9c, 0x40020, 0x9e, 0xc, 0x9d, 0x4003b,
-0x9e, 0x9f, 0xc, 0x3001d, 0xb2, 0x8, 0x3001e, 0xb3, 0xb2, 0x40020, 0xb4, 0xc, 0xb3, 0x4003b, 0xb4, 0xb5, 0xc, 0x3001d, 0xbb, 0x8, 0x3001e, 0xbc, 0xbb, 0x40020, 0xbd, 0xc, 0xbc, 0x4003b, 0xbd, 0xbe, 0xc, 0x40032, 0x6, 0xc9, 0x1, 0x40032, 0x6, 0xca, 0x1, 0x60033,
-0x53, 0xcb, 0xc9, 0xca, 0x5b, 0x50036, 0x2, 0x4, 0x0, 0x3, 0x200f8, 0x5, 0x300f7, 0xcc, 0x0, 0x300fb, 0x56, 0xcd, 0x200f8, 0xcd, 0x50041, 0x57, 0x58, 0x55, 0x56, 0x4003d, 0x6, 0x59, 0x58, 0x50041, 0x57, 0x5c, 0x55, 0x5b, 0x4003d, 0x6, 0x5d, 0x5c, 0x50041, 0x63,
-0x64, 0x61, 0x62, 0x4003d, 0x6, 0x65, 0x64, 0x500ae, 0x23, 0x66, 0x5d, 0x65, 0x400a8, 0x23, 0x67, 0x66, 0x300f7, 0x69, 0x0, 0x400fa, 0x67, 0x68, 0x69, 0x200f8, 0x68, 0x50041, 0x63, 0x6b, 0x61, 0x37, 0x4003d, 0x6, 0x6c, 0x6b, 0x500ae, 0x23, 0x6d, 0x59, 0x6c, 0x200f9,
-0x69, 0x200f8, 0x69, 0x700f5, 0x23, 0x6e, 0x66, 0xcd, 0x6d, 0x68, 0x300f7, 0x70, 0x0, 0x400fa, 0x6e, 0x6f, 0x70, 0x200f8, 0x6f, 0x200f9, 0xcc, 0x200f8, 0x70, 0x50041, 0x63, 0x74, 0x61, 0x73, 0x4003d, 0x6, 0x75, 0x74, 0x50080, 0x6, 0x79, 0x75, 0x5b, 0x50084, 0x6, 0x7d,
-0x75, 0x5d, 0x50041, 0x63, 0x7f, 0x61, 0x37, 0x4003d, 0x6, 0x80, 0x7f, 0x50084, 0x6, 0x82, 0x80, 0x5d, 0x50084, 0x6, 0x86, 0x59, 0x79, 0x200f9, 0x89, 0x200f8, 0x89, 0x700f5, 0x8, 0x112, 0x22, 0x70, 0xa7, 0x8a, 0x700f5, 0x6, 0x111, 0x56, 0x70, 0xa9, 0x8a, 0x500b0,
-0x23, 0x91, 0x111, 0x75, 0x400f6, 0x8b, 0x8a, 0x0, 0x400fa, 0x91, 0x8a, 0x8b, 0x200f8, 0x8a, 0x50080, 0x6, 0x98, 0x86, 0x111, 0x60041, 0x99, 0x9a, 0x95, 0x36, 0x98, 0x4003d, 0x8, 0x9b, 0x9a, 0x50080, 0x6, 0xa2, 0x7d, 0x111, 0x60041, 0x99, 0xa3, 0x9f, 0x36, 0xa2,
-0x4003d, 0x8, 0xa4, 0xa3, 0x50085, 0x8, 0xa5, 0x9b, 0xa4, 0x50081, 0x8, 0xa7, 0x112, 0xa5, 0x50080, 0x6, 0xa9, 0x111, 0x37, 0x200f9, 0x89, 0x200f8, 0x8b, 0x50080, 0x6, 0xad, 0x86, 0x75, 0x60041, 0x99, 0xae, 0x95, 0x36, 0xad, 0x4003d, 0x8, 0xaf, 0xae, 0x50081, 0x8,
-0xb1, 0x112, 0xaf, 0x50080, 0x6, 0xb8, 0x82, 0x59, 0x60041, 0x99, 0xba, 0xb5, 0x36, 0xb8, 0x3003e, 0xba, 0xb1, 0x50041, 0x63, 0xc3, 0x61, 0x36, 0x4003d, 0x6, 0xc4, 0xc3, 0x300f7, 0x10c, 0x0, 0x1300fb, 0xc4, 0xe0, 0x0, 0xe1, 0x1, 0xe7, 0x2, 0xec, 0x4, 0xf3,
-0x5, 0xf5, 0x3, 0xfa, 0x6, 0x104, 0x7, 0x109, 0x200f8, 0x109, 0x6000c, 0x8, 0x10b, 0x1, 0x12, 0xb1, 0x200f9, 0x10c, 0x200f8, 0x104, 0x6000c, 0x8, 0x106, 0x1, 0x1b, 0xb1, 0x50081, 0x8, 0x107, 0x1a, 0x106, 0x6000c, 0x8, 0x108, 0x1, 0x1c, 0x107, 0x200f9, 0x10c, 0x200f8,
-0xfa, 0x500b8, 0x23, 0xfc, 0xb1, 0x22, 0x300f7, 0x102, 0x0, 0x400fa, 0xfc, 0xfd, 0x100, 0x200f8, 0x100, 0x200f9, 0x102, 0x200f8, 0xfd, 0x50085, 0x8, 0xff, 0x40, 0xb1, 0x200f9, 0x102, 0x200f8, 0x102, 0x700f5, 0x8, 0x113, 0xff, 0xfd, 0xb1, 0x100, 0x200f9, 0x10c, 0x200f8, 0xf5, 0x500b8,
-0x23, 0xf7, 0xb1, 0x22, 0x600a9, 0x35, 0xf8, 0xf7, 0x36, 0x37, 0x4006f, 0x8, 0xf9, 0xf8, 0x200f9, 0x10c, 0x200f8, 0xf3, 0x200f9, 0x10c, 0x200f8, 0xec, 0x50085, 0x8, 0xee, 0x29, 0xb1, 0x6000c, 0x8, 0xef, 0x1, 0x1b, 0xee, 0x50081, 0x8, 0xf0, 0x1a, 0xef, 0x50088, 0x8,
-0xf1, 0x28, 0xf0, 0x50083, 0x8, 0xf2, 0xf1, 0x1a, 0x200f9, 0x10c, 0x200f8, 0xe7, 0x500b8, 0x23, 0xe9, 0xb1, 0x22, 0x600a9, 0x8, 0xeb, 0xe9, 0x22, 0xb1, 0x200f9, 0x10c, 0x200f8, 0xe1, 0x4007f, 0x8, 0xe3, 0xb1, 0x6000c, 0x8, 0xe4, 0x1, 0x1b, 0xe3, 0x50081, 0x8, 0xe5,
-0x1a, 0xe4, 0x50088, 0x8, 0xe6, 0x1a, 0xe5, 0x200f9, 0x10c, 0x200f8, 0xe0, 0x200f9, 0x10c, 0x200f8, 0x10c, 0x1500f5, 0x8, 0x116, 0x22, 0xe0, 0xe6, 0xe1, 0xeb, 0xe7, 0xf2, 0xec, 0xb1, 0xf3, 0xf9, 0xf5, 0x113, 0x102, 0x108, 0x104, 0x10b, 0x109, 0x60041, 0x99, 0xc8, 0xbe,
-0x36, 0xb8, 0x3003e, 0xc8, 0x116, 0x200f9, 0xcc, 0x200f8, 0xcc, 0x100fd, 0x10038,
+std::array<uint32_t, 1081> vulkan_kernel_source_kernel_training_forward_pass_glsl = {0x7230203, 0x10300, 0x0, 0xc6, 0x0, 0x20011, 0x1, 0x6000b, 0xab, 0x4c534c47, 0x6474732e, 0x3035342e, 0x0, 0x3000e, 0x0, 0x1, 0x6000f, 0x5, 0x1d, 0x6e69616d, 0x0, 0x21, 0x60010, 0x1d, 0x11, 0x1, 0x1, 0x1, 0x30047, 0x2, 0x2, 0x50048, 0x2, 0x0, 0x23, 0x0, 0x50048, 0x2, 0x1, 0x23,
+0x4, 0x50048, 0x2, 0x2, 0x23, 0x8, 0x50048, 0x2, 0x3, 0x23, 0xc, 0x40047, 0x6, 0x6, 0x4, 0x30047, 0x7, 0x2, 0x50048, 0x7, 0x0, 0x23, 0x0, 0x40048, 0x7, 0x0, 0x18, 0x40047, 0x8, 0x22, 0x0, 0x40047, 0x8, 0x21, 0x0, 0x40047, 0xc, 0x6, 0x4, 0x30047,
+0xd, 0x2, 0x50048, 0xd, 0x0, 0x23, 0x0, 0x40048, 0xd, 0x0, 0x18, 0x40047, 0xe, 0x22, 0x0, 0x40047, 0xe, 0x21, 0x1, 0x40047, 0x11, 0x6, 0x4, 0x30047, 0x12, 0x2, 0x50048, 0x12, 0x0, 0x23, 0x0, 0x40047, 0x13, 0x22, 0x0, 0x40047, 0x13, 0x21, 0x2, 0x40047,
+0x16, 0x6, 0x4, 0x30047, 0x17, 0x2, 0x50048, 0x17, 0x0, 0x23, 0x0, 0x40047, 0x18, 0x22, 0x0, 0x40047, 0x18, 0x21, 0x3, 0x40047, 0x1c, 0x1, 0x2, 0x40047, 0x21, 0xb, 0x1c, 0x40047, 0xc3, 0x1, 0x0, 0x40047, 0xc4, 0x1, 0x1, 0x40047, 0xc5, 0xb, 0x19, 0x40015,
+0x1, 0x20, 0x0, 0x6001e, 0x2, 0x1, 0x1, 0x1, 0x1, 0x40020, 0x4, 0x9, 0x2, 0x4003b, 0x4, 0x3, 0x9, 0x30016, 0x5, 0x20, 0x3001d, 0x6, 0x5, 0x3001e, 0x7, 0x6, 0x40020, 0x9, 0xc, 0x7, 0x4003b, 0x9, 0x8, 0xc, 0x40015, 0xa, 0x20, 0x1, 0x4002b, 0xa,
+0xb, 0x0, 0x3001d, 0xc, 0x5, 0x3001e, 0xd, 0xc, 0x40020, 0xf, 0xc, 0xd, 0x4003b, 0xf, 0xe, 0xc, 0x4002b, 0xa, 0x10, 0x1, 0x3001d, 0x11, 0x5, 0x3001e, 0x12, 0x11, 0x40020, 0x14, 0xc, 0x12, 0x4003b, 0x14, 0x13, 0xc, 0x4002b, 0xa, 0x15, 0x2, 0x3001d, 0x16,
+0x5, 0x3001e, 0x17, 0x16, 0x40020, 0x19, 0xc, 0x17, 0x4003b, 0x19, 0x18, 0xc, 0x4002b, 0xa, 0x1a, 0x3, 0x4002b, 0x1, 0x1b, 0xffffffff, 0x40032, 0x1, 0x1c, 0xffffffff, 0x20013, 0x1e, 0x30021, 0x1f, 0x1e, 0x40017, 0x22, 0x1, 0x3, 0x40020, 0x23, 0x1, 0x22, 0x4003b, 0x23, 0x21,
+0x1, 0x40020, 0x29, 0x9, 0x1, 0x20014, 0x2c, 0x40021, 0x3c, 0x1, 0x1, 0x4002b, 0x5, 0x3f, 0x0, 0x40020, 0x41, 0x7, 0x5, 0x4002b, 0x1, 0x42, 0x0, 0x40020, 0x44, 0x7, 0x1, 0x40020, 0x52, 0xc, 0x5, 0x4002b, 0x1, 0x5b, 0x1, 0x50021, 0x63, 0x1, 0x1, 0x1,
+0x40021, 0x6e, 0x2c, 0x1, 0x50021, 0x7b, 0x5, 0x1, 0x5, 0x4002b, 0xa, 0x80, 0x10, 0x4002b, 0x1, 0x81, 0x10, 0x4002b, 0xa, 0x91, 0x6, 0x4002b, 0x1, 0x92, 0x6, 0x4002b, 0xa, 0x94, 0x7, 0x4002b, 0x1, 0x95, 0x7, 0x4002b, 0xa, 0xa6, 0x4, 0x4002b, 0xa, 0xa7,
+0x5, 0x4002b, 0xa, 0xa8, 0x8, 0x4002b, 0x5, 0xa9, 0x3f800000, 0x4002b, 0x5, 0xb1, 0x40000000, 0x4002b, 0x5, 0xb2, 0xc0000000, 0x4002b, 0x5, 0xbc, 0x3c23d70a, 0x40032, 0x1, 0xc3, 0x1, 0x40032, 0x1, 0xc4, 0x1, 0x60033, 0x22, 0xc5, 0xc3, 0xc4, 0x5b, 0x50036, 0x1e, 0x1d, 0x0, 0x1f,
+0x200f8, 0x20, 0x4003b, 0x41, 0x40, 0x7, 0x4003b, 0x44, 0x43, 0x7, 0x4003d, 0x22, 0x24, 0x21, 0x50051, 0x1, 0x25, 0x24, 0x0, 0x4003d, 0x22, 0x26, 0x21, 0x50051, 0x1, 0x27, 0x26, 0x1, 0x50041, 0x29, 0x28, 0x3, 0x1a, 0x4003d, 0x1, 0x2a, 0x28, 0x500ae, 0x2c, 0x2b,
+0x27, 0x2a, 0x50041, 0x29, 0x2d, 0x3, 0x10, 0x4003d, 0x1, 0x2e, 0x2d, 0x500ae, 0x2c, 0x2f, 0x25, 0x2e, 0x500a6, 0x2c, 0x30, 0x2b, 0x2f, 0x300f7, 0x31, 0x0, 0x400fa, 0x30, 0x32, 0x31, 0x200f8, 0x32, 0x100fd, 0x200f8, 0x31, 0x50041, 0x29, 0x33, 0x3, 0x15, 0x4003d, 0x1,
+0x34, 0x33, 0x50084, 0x1, 0x35, 0x34, 0x27, 0x50041, 0x29, 0x36, 0x3, 0x10, 0x4003d, 0x1, 0x37, 0x36, 0x50084, 0x1, 0x38, 0x37, 0x27, 0x50041, 0x29, 0x39, 0x3, 0x15, 0x4003d, 0x1, 0x3a, 0x39, 0x50039, 0x1, 0x3d, 0x3b, 0x3a, 0x50084, 0x1, 0x3e, 0x25, 0x3d,
+0x3003e, 0x40, 0x3f, 0x3003e, 0x43, 0x42, 0x200f9, 0x45, 0x200f8, 0x45, 0x400f6, 0x49, 0x48, 0x0, 0x200f9, 0x46, 0x200f8, 0x46, 0x4003d, 0x1, 0x4a, 0x43, 0x50041, 0x29, 0x4b, 0x3, 0x15, 0x4003d, 0x1, 0x4c, 0x4b, 0x500b0, 0x2c, 0x4d, 0x4a, 0x4c, 0x400fa, 0x4d, 0x47, 0x49,
+0x200f8, 0x47, 0x4003d, 0x5, 0x4e, 0x40, 0x4003d, 0x1, 0x4f, 0x43, 0x50080, 0x1, 0x50, 0x3e, 0x4f, 0x60041, 0x52, 0x51, 0x8, 0xb, 0x50, 0x4003d, 0x5, 0x53, 0x51, 0x4003d, 0x1, 0x54, 0x43, 0x50080, 0x1, 0x55, 0x35, 0x54, 0x60041, 0x52, 0x56, 0xe, 0xb, 0x55,
+0x4003d, 0x5, 0x57, 0x56, 0x50085, 0x5, 0x58, 0x53, 0x57, 0x50081, 0x5, 0x59, 0x4e, 0x58, 0x3003e, 0x40, 0x59, 0x200f9, 0x48, 0x200f8, 0x48, 0x4003d, 0x1, 0x5a, 0x43, 0x50080, 0x1, 0x5c, 0x5a, 0x5b, 0x3003e, 0x43, 0x5c, 0x200f9, 0x45, 0x200f8, 0x49, 0x4003d, 0x5, 0x5d,
+0x40, 0x50041, 0x29, 0x5e, 0x3, 0x10, 0x4003d, 0x1, 0x5f, 0x5e, 0x50041, 0x29, 0x60, 0x3, 0x15, 0x4003d, 0x1, 0x61, 0x60, 0x60039, 0x1, 0x64, 0x62, 0x5f, 0x61, 0x50080, 0x1, 0x65, 0x64, 0x25, 0x60041, 0x52, 0x66, 0x8, 0xb, 0x65, 0x4003d, 0x5, 0x67, 0x66,
+0x50081, 0x5, 0x68, 0x5d, 0x67, 0x3003e, 0x40, 0x68, 0x50041, 0x29, 0x69, 0x3, 0xb, 0x4003d, 0x1, 0x6a, 0x69, 0x50039, 0x1, 0x6c, 0x6b, 0x6a, 0x50039, 0x2c, 0x6f, 0x6d, 0x6c, 0x300f7, 0x70, 0x0, 0x400fa, 0x6f, 0x71, 0x70, 0x200f8, 0x71, 0x50080, 0x1, 0x72, 0x38,
+0x25, 0x4003d, 0x5, 0x73, 0x40, 0x60041, 0x52, 0x74, 0x18, 0xb, 0x72, 0x3003e, 0x74, 0x73, 0x200f9, 0x70, 0x200f8, 0x70, 0x50080, 0x1, 0x75, 0x38, 0x25, 0x50041, 0x29, 0x76, 0x3, 0xb, 0x4003d, 0x1, 0x77, 0x76, 0x50039, 0x1, 0x78, 0x6b, 0x77, 0x4003d, 0x5, 0x79,
+0x40, 0x60039, 0x5, 0x7c, 0x7a, 0x78, 0x79, 0x60041, 0x52, 0x7d, 0x13, 0xb, 0x75, 0x3003e, 0x7d, 0x7c, 0x100fd, 0x10038, 0x50036, 0x1, 0x3b, 0x0, 0x3c, 0x30037, 0x1, 0x7e, 0x200f8, 0x7f, 0x50080, 0x1, 0x82, 0x7e, 0x81, 0x50082, 0x1, 0x83, 0x82, 0x5b, 0x50086, 0x1,
+0x84, 0x83, 0x81, 0x50084, 0x1, 0x85, 0x84, 0x81, 0x200fe, 0x85, 0x10038, 0x50036, 0x1, 0x62, 0x0, 0x63, 0x30037, 0x1, 0x86, 0x30037, 0x1, 0x87, 0x200f8, 0x88, 0x50039, 0x1, 0x89, 0x3b, 0x87, 0x50084, 0x1, 0x8a, 0x86, 0x89, 0x200fe, 0x8a, 0x10038, 0x50036, 0x1, 0x6b,
+0x0, 0x3c, 0x30037, 0x1, 0x8b, 0x200f8, 0x8c, 0x500ab, 0x2c, 0x8d, 0x1c, 0x1b, 0x600a9, 0x1, 0x8e, 0x8d, 0x1c, 0x8b, 0x200fe, 0x8e, 0x10038, 0x50036, 0x2c, 0x6d, 0x0, 0x6e, 0x30037, 0x1, 0x8f, 0x200f8, 0x90, 0x500aa, 0x2c, 0x93, 0x8f, 0x92, 0x500aa, 0x2c, 0x96, 0x8f,
+0x95, 0x500a6, 0x2c, 0x97, 0x93, 0x96, 0x200fe, 0x97, 0x10038, 0x50036, 0x5, 0x7a, 0x0, 0x7b, 0x30037, 0x1, 0x98, 0x30037, 0x5, 0x99, 0x200f8, 0x9a, 0x300f7, 0x9b, 0x0, 0x1500fb, 0x98, 0xa5, 0x0, 0x9c, 0x1, 0x9d, 0x2, 0x9e, 0x4, 0x9f, 0x5, 0xa0, 0x3, 0xa1,
+0x6, 0xa2, 0x7, 0xa3, 0x8, 0xa4, 0x200f8, 0x9c, 0x4007f, 0x5, 0xaa, 0x99, 0x6000c, 0x5, 0xac, 0xab, 0x1b, 0xaa, 0x50081, 0x5, 0xad, 0xa9, 0xac, 0x50088, 0x5, 0xae, 0xa9, 0xad, 0x200fe, 0xae, 0x200f8, 0x9d, 0x500b8, 0x2c, 0xaf, 0x99, 0x3f, 0x600a9, 0x5, 0xb0,
+0xaf, 0x3f, 0x99, 0x200fe, 0xb0, 0x200f8, 0x9e, 0x50085, 0x5, 0xb3, 0xb2, 0x99, 0x6000c, 0x5, 0xb4, 0xab, 0x1b, 0xb3, 0x50081, 0x5, 0xb5, 0xa9, 0xb4, 0x50088, 0x5, 0xb6, 0xb1, 0xb5, 0x50083, 0x5, 0xb7, 0xb6, 0xa9, 0x200fe, 0xb7, 0x200f8, 0x9f, 0x200fe, 0x99, 0x200f8,
+0xa0, 0x500b8, 0x2c, 0xb8, 0x99, 0x3f, 0x600a9, 0xa, 0xb9, 0xb8, 0xb, 0x10, 0x4006f, 0x5, 0xba, 0xb9, 0x200fe, 0xba, 0x200f8, 0xa1, 0x500b8, 0x2c, 0xbb, 0x99, 0x3f, 0x50085, 0x5, 0xbd, 0xbc, 0x99, 0x600a9, 0x5, 0xbe, 0xbb, 0xbd, 0x99, 0x200fe, 0xbe, 0x200f8, 0xa2,
+0x6000c, 0x5, 0xbf, 0xab, 0x1b, 0x99, 0x50081, 0x5, 0xc0, 0xa9, 0xbf, 0x6000c, 0x5, 0xc1, 0xab, 0x1c, 0xc0, 0x200fe, 0xc1, 0x200f8, 0xa3, 0x6000c, 0x5, 0xc2, 0xab, 0x12, 0x99, 0x200fe, 0xc2, 0x200f8, 0xa4, 0x200fe, 0x99, 0x200f8, 0xa5, 0x200fe, 0x3f, 0x200f8, 0x9b, 0x100ff,
+0x10038,
 };
\ No newline at end of file
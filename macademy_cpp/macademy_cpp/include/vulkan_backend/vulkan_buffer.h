@@ -16,7 +16,9 @@ class VulkanBuffer : public IBuffer
     Device* m_device = nullptr;
     VmaAllocator& m_allocator;
     VkBuffer m_buffer;
-    VmaAllocation m_allocation;
+    VmaAllocation m_allocation = nullptr;
+    VulkanBuffer* m_root_buffer = nullptr; // the buffer owning the VkBuffer if this is a view, nullptr otherwise
+    size_t m_offset = 0;                   // offset of the view in the VkBuffer
     size_t m_size;
     void* m_persistently_mapped_data = nullptr;
     std::string m_name;
@@ -24,14 +26,30 @@ class VulkanBuffer : public IBuffer
   public:
     VulkanBuffer(Device* device, const std::string& name, size_t size, VkBufferUsageFlags usage_flags, VmaMemoryUsage vma_memory_usage, VmaAllocationCreateFlags alloc_create_flags);
 
+    // A view of a range of another buffer sharing its VkBuffer, the buffer must outlive the view
+    VulkanBuffer(VulkanBuffer& buffer, const std::string& name, size_t offset, size_t size);
+
     const std::string& GetName() const { return m_name; }
 
     VkBuffer GetHandle() const { return m_buffer; }
 
+    size_t GetOffset() const { return m_offset; }
+
     size_t GetSize() const override { return m_size; }
 
+    // Buffers in host visible memory are persistently mapped, so the host can access them without a staging buffer
+    bool IsHostVisible() const { return (m_root_buffer ? m_root_buffer : this)->m_persistently_mapped_data != nullptr; }
+
+    // For memory types that are not host coherent, the host writes of a mapped range have to be flushed, and the device writes invalidated
+    void FlushMappedRange(size_t offset, size_t size);
+    void InvalidateMappedRange(size_t offset, size_t size);
+
     void* MapMemory()
     {
+        if (m_root_buffer) {
+            return static_cast<uint8_t*>(m_root_buffer->MapMemory()) + m_offset;
+        }
+
         if (m_persistently_mapped_data) {
             return m_persistently_mapped_data;
         }
@@ -43,7 +61,9 @@ class VulkanBuffer : public IBuffer
 
     void UnmapMemory()
     {
-        if (!m_persistently_mapped_data) {
+        if (m_root_buffer) {
+            m_root_buffer->UnmapMemory();
+        } else if (!m_persistently_mapped_data) {
             vmaUnmapMemory(m_allocator, m_allocation);
         }
     }
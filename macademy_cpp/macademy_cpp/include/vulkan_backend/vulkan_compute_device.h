@@ -6,7 +6,12 @@
 #include "vulkan_backend/vulkan_instance.h"
 
 #include <optional>
+#include <filesystem>
 #include <map>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <exception>
 #include <nlohmann/json.hpp>
 
 namespace macademy {
@@ -33,20 +38,44 @@ class VulkanComputeDevice : public IComputeDevice
     enum class SynchronizationAction
     {
         ComputeShaderRead = 1 << 0,
-        TransferRead = 1 << 1
+        TransferRead = 1 << 1,
+        HostRead = 1 << 2
     };
 
     std::unique_ptr<vk::Instance> m_instance = nullptr;
     std::unique_ptr<vk::Device> m_device = nullptr;
 
-    std::unique_ptr<vk::ComputeKernel> m_kernel_calc_single_layer;
-    std::unique_ptr<vk::ComputeKernel> m_kernel_train_forward_pass;
-    std::unique_ptr<vk::ComputeKernel> m_kernel_train_backward_pass;
+    // Kernels specialized for a single activation function with a specialization constant
+    struct ActivationKernels
+    {
+        std::unique_ptr<vk::ComputeKernel> m_kernel_calc_single_layer;
+        std::unique_ptr<vk::ComputeKernel> m_kernel_train_forward_pass;
+        std::unique_ptr<vk::ComputeKernel> m_kernel_train_backward_pass;
+    };
+
+    std::map<ActivationFunction, ActivationKernels> m_activation_kernels;
+    std::unique_ptr<vk::ComputeKernel> m_kernel_train_calc_gradient;
     std::unique_ptr<vk::ComputeKernel> m_kernel_train_apply_gradient;
+    std::unique_ptr<vk::ComputeKernel> m_kernel_apply_mutation;
+    std::unique_ptr<vk::ComputeKernel> m_kernel_crossover;
+    std::unique_ptr<vk::ComputeKernel> m_kernel_softmax;
+
+    struct MappedBuffer
+    {
+        BufferUsage m_access = BufferUsage::ReadWrite;
+        size_t m_offset = 0;
+        size_t m_size = 0;
+        std::unique_ptr<vk::Device::LoaderStagingBuffer> m_staging_buffer; // nullptr if the memory of the buffer is mapped directly
+    };
 
     std::vector<MemoryReadback> m_memory_reads;
 
-    std::map<const vk::VulkanBuffer*, BufferSynchronizationEvent> m_dirty_buffers;
+    std::mutex m_mapped_buffers_mutex;
+    std::map<const IBuffer*, MappedBuffer> m_mapped_buffers;
+
+    // Keyed by the VkBuffer, so writes to a view are also tracked for the other views of the same buffer.
+    // Entries are kept after the queue is waited for, the writes still need a barrier before the host reads the mapped memory.
+    std::map<VkBuffer, BufferSynchronizationEvent> m_dirty_buffers;
     std::vector<std::unique_ptr<vk::Device::LoaderStagingBuffer>> m_staging_buffers;
 
     uint32_t m_kernel_calc_single_layer_ideal_workgroup_size = 64;
@@ -54,12 +83,42 @@ class VulkanComputeDevice : public IComputeDevice
     uint32_t m_kernel_training_ideal_workgroup_size_y = 8;
     uint32_t m_kernel_training_apply_gradient_ideal_workgroup_size = 64;
     bool m_is_float16_supported = false;
-    bool m_hw_atomic_add_support = false;
+
+    std::optional<std::filesystem::path> m_pipeline_cache_path;
+    size_t m_saved_pipeline_cache_size = 0;
 
     VkCommandBuffer m_current_command_buffer = VK_NULL_HANDLE;
+    std::mutex m_recording_mutex;
+    std::atomic<std::thread::id> m_recording_thread;
+
+    // Created at the start of every function that records commands. If an exception leaves the function, the commands recorded so far are submitted
+    // and waited for, which releases the recording mutex, otherwise every other thread would block on it forever
+    class RecordingGuard
+    {
+        VulkanComputeDevice& m_device;
+        int m_uncaught_exceptions;
+
+      public:
+        explicit RecordingGuard(VulkanComputeDevice& device) : m_device(device), m_uncaught_exceptions(std::uncaught_exceptions()) {}
+        ~RecordingGuard();
+
+        RecordingGuard(const RecordingGuard&) = delete;
+        RecordingGuard& operator=(const RecordingGuard&) = delete;
+    };
 
     VkCommandBuffer& GetCommandBuffer();
+    bool IsRecordingThread() const;
+
+    void CreateKernels();
+
+    // The kernels of an activation function are created on its first use, this must be called from the recording thread
+    ActivationKernels& GetActivationKernels(ActivationFunction activation_function);
+    void SavePipelineCache();
+
+    // Normalizes the rows of the buffer after a Softmax layer was evaluated with its z values
+    void QueueSoftmax(vk::VulkanBuffer* buffer, uint32_t row_length, uint32_t row_count);
 
+    void MarkBufferDirty(const vk::VulkanBuffer* buffer, BufferSynchronizationEvent buffer_event);
     void SynchronizeBuffers(VkCommandBuffer command_buffer, SynchronizationAction action, std::span<const vk::VulkanBuffer*> buffers);
 
   public:
@@ -67,23 +126,34 @@ class VulkanComputeDevice : public IComputeDevice
     ~VulkanComputeDevice();
 
     std::unique_ptr<IBuffer> CreateBuffer(size_t size, BufferUsage buffer_usage, const std::string& name);
+    std::unique_ptr<IBuffer> CreateBufferView(IBuffer* buffer, size_t offset, size_t size, const std::string& name) override;
+    size_t GetBufferViewAlignment() const override;
 
     void QueueWriteToBuffer(IBuffer* dst_buffer, std::span<const uint8_t> src, size_t buffer_offset) override;
     void QueueReadFromBuffer(IBuffer* src_buffer, std::span<uint8_t> dst, size_t buffer_offset) override;
     void QueueFillBuffer(IBuffer* buffer, uint32_t data, size_t offset, size_t size) override;
+    std::span<uint8_t> MapBuffer(IBuffer* buffer, BufferUsage access, size_t offset_bytes, size_t size_bytes) override;
+    void UnmapBuffer(IBuffer* buffer) override;
     void SubmitQueue() override;
     void WaitQueueIdle() override;
 
     void QueueEvaluateLayer(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function, uint32_t layer_input_count,
                             uint32_t layer_neuron_count) override;
+    void QueueEvaluateLayerBatched(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
+                                   uint32_t layer_input_count, uint32_t layer_neuron_count, uint32_t batch_size, uint32_t weights_batch_stride) override;
     void QueueTrainForwardPass(const IBuffer* tensor_buffer, const IBuffer* prev_activations, IBuffer* activations, IBuffer* zvalues, ActivationFunction activation_function,
                                uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t num_training_samples) override;
-    void QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* prev_activations_buffer, const IBuffer* layer_activations_buffer,
-                                const IBuffer* layer_zvalues_buffer, IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, IBuffer* current_layer_gradient_buffer,
-                                uint32_t layer_neuron_count, uint32_t weights_per_neuron, ActivationFunction activation_function, uint32_t num_training_samples, CostFunction costFunction,
-                                uint32_t next_layer_neuron_count) override;
-    void QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, float regularization_term_1, float regularization_term_2,
-                             float normalized_learning_rate) override;
+    void QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* layer_activations_buffer, const IBuffer* layer_zvalues_buffer,
+                                IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, uint32_t layer_neuron_count, ActivationFunction activation_function,
+                                uint32_t num_training_samples, CostFunction costFunction, uint32_t next_layer_neuron_count) override;
+    void QueueTrainCalculateGradient(const IBuffer* delta_k_vector_buffer, const IBuffer* prev_activations_buffer, IBuffer* current_layer_gradient_buffer, uint32_t layer_neuron_count,
+                                     uint32_t weights_per_neuron, uint32_t num_training_samples) override;
+    void QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, IBuffer* moment1_buffer, IBuffer* moment2_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron,
+                             const OptimizerParameters& optimizer_parameters) override;
+    bool PrepareTensorForInference(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron) override;
+    void QueueApplyMutation(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t tensor_count, const MutationParameters& mutation_parameters) override;
+    void QueueCrossover(const IBuffer* parents_tensor_buffer, IBuffer* children_tensor_buffer, const IBuffer* parent_ids_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron,
+                        uint32_t children_count, uint64_t seed, uint32_t stream) override;
 
     std::string GetDeviceName() const override;
 
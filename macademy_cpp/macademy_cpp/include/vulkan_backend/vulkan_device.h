@@ -9,6 +9,7 @@
 #include <span>
 #include <memory>
 #include <functional>
+#include <vector>
 
 namespace macademy::vk {
 class Instance;
@@ -55,6 +56,13 @@ class Device
 
     std::unique_ptr<Device::LoaderStagingBuffer> GetLoaderStagingBuffer(size_t size);
 
+    VkPipelineCache GetPipelineCache() { return m_pipeline_cache; }
+
+    // Replaces the pipeline cache with one initialized from serialized data. The data is ignored if it was created by a different device or driver.
+    void LoadPipelineCache(std::span<const uint8_t> data);
+
+    std::vector<uint8_t> GetPipelineCacheData();
+
     ~Device();
 
     std::string GetName() { return m_device_props.properties.deviceName; }
@@ -62,6 +70,8 @@ class Device
   private:
     void RecycleLoaderBuffer(LoaderStagingBuffer& loader_buffer);
 
+    bool IsPipelineCacheCompatible(std::span<const uint8_t> data) const;
+
     Instance* m_instance;
     VmaAllocator m_vma;
 
@@ -75,6 +85,8 @@ class Device
 
     VkQueue m_compute_queue;
 
+    VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
+
     std::unique_ptr<CommandPool> m_command_pool;
 
     std::vector<std::pair<std::unique_ptr<VulkanBuffer>, bool>> m_loader_staging_buffers;
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <nlohmann/json.hpp>
+
+namespace macademy {
+
+class IComputeDevice;
+
+struct WorkgroupSizes
+{
+    uint32_t m_eval = 64;
+    uint32_t m_training_x = 8;
+    uint32_t m_training_y = 8;
+    uint32_t m_apply_gradient = 64;
+};
+
+struct WorkgroupSizeLimits
+{
+    uint32_t m_max_invocations = 256;
+    uint32_t m_max_size_x = 256;
+    uint32_t m_max_size_y = 256;
+};
+
+// Benchmarks candidate work group sizes for each kernel group on representative layer shapes, and returns the fastest ones.
+// apply_workgroup_sizes is called to make the device use a candidate before it is measured, and it is called with the result at the end.
+WorkgroupSizes TuneWorkgroupSizes(IComputeDevice& device, const WorkgroupSizes& initial_sizes, const WorkgroupSizeLimits& limits,
+                                  const std::function<void(const WorkgroupSizes&)>& apply_workgroup_sizes);
+
+// Returns the tuned work group sizes of the device from the tuning cache. If the device has no entry in the cache yet, and autotuning is enabled by the
+// "autotune_workgroup_sizes" device config flag, the device is tuned and the results are stored in the cache. The sizes set in the device config are applied on top.
+WorkgroupSizes LoadOrTuneWorkgroupSizes(IComputeDevice& device, const nlohmann::json& device_config, const std::string& device_key, const WorkgroupSizes& default_sizes,
+                                        const WorkgroupSizeLimits& limits, const std::function<void(const WorkgroupSizes&)>& apply_workgroup_sizes);
+
+} // namespace macademy
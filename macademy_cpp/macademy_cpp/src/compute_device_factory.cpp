@@ -38,7 +38,7 @@ std::vector<ComputeDeviceInfo> EnumerateComputeDevices()
 std::unique_ptr<IComputeDevice> CreateComputeDevice(const ComputeDeviceInfo& compute_device_info, const nlohmann::json& device_config)
 {
     if (compute_device_info.m_backend == "cpu") {
-        return std::make_unique<CPUComputeDevice>();
+        return std::make_unique<CPUComputeDevice>(device_config);
     }
 
 #ifdef MACADEMY_OPENCL_BACKEND
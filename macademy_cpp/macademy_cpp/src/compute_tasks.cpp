@@ -5,25 +5,116 @@
 #include "utils.h"
 #include "training_suite.h"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
+#include <tuple>
 
 namespace {
 size_t ExtendGlobalWorkSize(size_t desiredGlobalSize, size_t localSize)
 {
     return ((desiredGlobalSize % localSize) == 0) ? desiredGlobalSize : (desiredGlobalSize + (localSize - (desiredGlobalSize % localSize)));
 }
+
+macademy::OptimizerParameters CreateOptimizerParameters(const macademy::TrainingSuite& training_suite, uint32_t num_training_samples, uint64_t optimizer_step)
+{
+    using namespace macademy;
+
+    OptimizerParameters ret{};
+    ret.m_optimizer = training_suite.m_optimizer;
+
+    const float regularization_rate = training_suite.m_regularization_rate / (float)training_suite.m_training_data.size();
+
+    switch (training_suite.m_optimizer) {
+    case Optimizer::SGD:
+    case Optimizer::Momentum:
+    case Optimizer::Nesterov:
+        // The summed gradient of the minibatch is applied with a learning rate normalized to the size of the training data
+        ret.m_learning_rate = training_suite.m_learning_rate * (float(num_training_samples) / (float)training_suite.m_training_data.size());
+        ret.m_beta1 = training_suite.m_optimizer == Optimizer::SGD ? 0.0f : training_suite.m_momentum;
+        if (training_suite.m_regularization == Regularization::L2) {
+            ret.m_regularization_term_1 = 1.0f - training_suite.m_learning_rate * regularization_rate;
+        } else if (training_suite.m_regularization == Regularization::L1) {
+            ret.m_regularization_term_2 = -training_suite.m_learning_rate * regularization_rate;
+        }
+        break;
+    case Optimizer::Adam:
+    case Optimizer::AdamW:
+        // Adam works on the mean gradient of the minibatch, regularization is added to the gradient before the moments are updated
+        ret.m_learning_rate = training_suite.m_learning_rate;
+        ret.m_gradient_scale = 1.0f / float(num_training_samples);
+        ret.m_beta1 = training_suite.m_adam_beta1;
+        ret.m_beta2 = training_suite.m_adam_beta2;
+        ret.m_epsilon = training_suite.m_adam_epsilon;
+        ret.m_bias_correction_1 = float(1.0 / (1.0 - std::pow(double(training_suite.m_adam_beta1), double(optimizer_step))));
+        ret.m_bias_correction_2 = float(1.0 / (1.0 - std::pow(double(training_suite.m_adam_beta2), double(optimizer_step))));
+        if (training_suite.m_regularization == Regularization::L1) {
+            ret.m_l1_gradient_term = regularization_rate;
+        } else if (training_suite.m_regularization == Regularization::L2 && training_suite.m_optimizer == Optimizer::Adam) {
+            ret.m_l2_gradient_term = regularization_rate;
+        }
+        if (training_suite.m_optimizer == Optimizer::AdamW) {
+            ret.m_regularization_term_1 = 1.0f - training_suite.m_learning_rate * training_suite.m_weight_decay;
+        }
+        break;
+    }
+
+    return ret;
+}
+
+std::pair<macademy::RandomDistribution, float> GetRandomDistribution(const macademy::MutationDistribution& mutation_distribution)
+{
+    using namespace macademy;
+
+    if (std::holds_alternative<UniformDistribution>(mutation_distribution)) {
+        return {RandomDistribution::Uniform, std::get<UniformDistribution>(mutation_distribution).range};
+    } else if (std::holds_alternative<GaussianDistribution>(mutation_distribution)) {
+        return {RandomDistribution::Gaussian, std::get<GaussianDistribution>(mutation_distribution).sigma};
+    }
+    throw std::runtime_error("Invalid mutation distribution!");
+}
+
+// The members of a population are stored after each other, each one starting at an aligned offset
+size_t GetPopulationMemberByteStride(const macademy::Layer& layer) { return size_t(layer.m_tensor->GetLayout().GetTensorStride()) * sizeof(float); }
+
+macademy::MutationParameters CreateMutationParameters(const macademy::MutationDistribution& weight_mutation_distribution, const macademy::MutationDistribution& bias_mutation_distribution,
+                                                      std::optional<uint64_t> seed)
+{
+    macademy::MutationParameters ret{};
+    ret.m_seed = seed ? *seed : ((uint64_t(std::random_device{}()) << 32) | std::random_device{}());
+    std::tie(ret.m_weight_distribution, ret.m_weight_scale) = GetRandomDistribution(weight_mutation_distribution);
+    std::tie(ret.m_bias_distribution, ret.m_bias_scale) = GetRandomDistribution(bias_mutation_distribution);
+    return ret;
+}
 } // namespace
 
 namespace macademy {
 
-NetworkResourceHandle::NetworkResourceHandle(Network& network, IComputeDevice& compute_device) : m_network(&network), m_compute_device(&compute_device)
+NetworkResourceHandle::NetworkResourceHandle(Network& network, IComputeDevice& compute_device, bool use_arena)
+    : m_network(&network), m_compute_device(&compute_device), m_use_arena(use_arena)
 {
-    int tensor_id = 0;
-    for (const auto& layer : network.GetLayers()) {
-        m_tensor_buffers.emplace_back(m_compute_device->CreateBuffer(layer.m_tensor->GetByteSize(), BufferUsage::ReadWrite, "tensor_" + std::to_string(tensor_id)));
-        m_compute_device->QueueWriteToBuffer(m_tensor_buffers.back().get(), ToReadOnlyUi8Span(layer.m_tensor->GetRawData()), 0);
-        ++tensor_id;
+    const auto layers = network.GetLayers();
+
+    if (m_use_arena) {
+        const size_t alignment = m_compute_device->GetBufferViewAlignment();
+        for (const auto& layer : layers) {
+            m_arena_offsets.emplace_back(m_arena_size);
+            m_arena_size += (layer.m_tensor->GetByteSize() + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    CreateLayerBuffers(m_tensor_arena, m_tensor_buffers, "tensor_");
+
+    if (m_tensor_arena) {
+        auto arena_data = m_compute_device->MapBuffer(m_tensor_arena.get(), BufferUsage::WriteOnly, 0, m_arena_size);
+        for (size_t i = 0; i < layers.size(); ++i) {
+            std::copy(layers[i].m_tensor->GetRawData().begin(), layers[i].m_tensor->GetRawData().end(), arena_data.begin() + m_arena_offsets[i]);
+        }
+        m_compute_device->UnmapBuffer(m_tensor_arena.get());
+    } else {
+        for (size_t i = 0; i < layers.size(); ++i) {
+            m_compute_device->QueueWriteToBuffer(m_tensor_buffers[i].get(), ToReadOnlyUi8Span(layers[i].m_tensor->GetRawData()), 0);
+        }
     }
 
     m_compute_device->SubmitQueue();
@@ -37,265 +128,646 @@ NetworkResourceHandle::NetworkResourceHandle(Network& network, IComputeDevice& c
 
 void NetworkResourceHandle::SynchronizeNetworkData()
 {
-    for (uint32_t i = 0; i < m_network->GetLayerCount(); ++i) {
-        m_compute_device->QueueReadFromBuffer(m_tensor_buffers[i].get(), m_network->GetLayers()[i].m_tensor->GetRawData(), 0);
+    if (m_is_prepared_for_inference) {
+        return; // the weights can't be changed on the device anymore
+    }
+
+    auto layers = m_network->GetLayers();
+
+    if (m_tensor_arena) {
+        const auto arena_data = m_compute_device->MapBuffer(m_tensor_arena.get(), BufferUsage::ReadOnly, 0, m_arena_size);
+        for (size_t i = 0; i < layers.size(); ++i) {
+            auto tensor_data = layers[i].m_tensor->GetRawData();
+            std::copy_n(arena_data.begin() + m_arena_offsets[i], tensor_data.size(), tensor_data.begin());
+        }
+        m_compute_device->UnmapBuffer(m_tensor_arena.get());
+        return;
+    }
+
+    for (size_t i = 0; i < layers.size(); ++i) {
+        m_compute_device->QueueReadFromBuffer(m_tensor_buffers[i].get(), layers[i].m_tensor->GetRawData(), 0);
     }
     m_compute_device->SubmitQueue();
     m_compute_device->WaitQueueIdle();
 }
 
-void NetworkResourceHandle::AllocateBatchEvalResources() const
+bool NetworkResourceHandle::PrepareForInference()
 {
-    const size_t largest_tensor_element_size = sizeof(float);
+    const auto layers = m_network->GetLayers();
+    for (uint32_t i = 0; i < uint32_t(layers.size()); ++i) {
+        const uint32_t input_num = i == 0 ? m_network->GetInputCount() : layers[i - 1].m_num_neurons;
+        if (m_compute_device->PrepareTensorForInference(m_tensor_buffers[i].get(), layers[i].m_num_neurons, input_num)) {
+            m_is_prepared_for_inference = true;
+        }
+    }
 
-    const size_t largest_layer_size_bytes = std::max(m_network->GetInputCount(), CalculateLargestLayerNeuronCount(m_network->GetLayers())) * largest_tensor_element_size;
-    const size_t largest_layer_buffer_required_size = largest_layer_size_bytes;
+    return m_is_prepared_for_inference;
+}
 
-    if (!m_layer_result_buffer_a || m_layer_result_buffer_a->GetSize() < largest_layer_buffer_required_size) {
-        m_layer_result_buffer_a.reset();
-        m_layer_result_buffer_a = m_compute_device->CreateBuffer(largest_layer_buffer_required_size, BufferUsage::ReadWrite, "layer_result_buffer_a");
+void NetworkResourceHandle::CreateLayerBuffers(std::unique_ptr<IBuffer>& arena, std::vector<std::unique_ptr<IBuffer>>& layer_buffers, const std::string& name)
+{
+    if (m_use_arena) {
+        arena = m_compute_device->CreateBuffer(m_arena_size, BufferUsage::ReadWrite, name + "arena");
     }
 
-    if (!m_layer_result_buffer_b || m_layer_result_buffer_b->GetSize() < largest_layer_buffer_required_size) {
-        m_layer_result_buffer_b.reset();
-        m_layer_result_buffer_b = m_compute_device->CreateBuffer(largest_layer_buffer_required_size, BufferUsage::ReadWrite, "layer_result_buffer_b");
+    const auto layers = m_network->GetLayers();
+    for (size_t i = 0; i < layers.size(); ++i) {
+        const size_t size = layers[i].m_tensor->GetByteSize();
+        if (arena) {
+            layer_buffers.emplace_back(m_compute_device->CreateBufferView(arena.get(), m_arena_offsets[i], size, name + std::to_string(i)));
+        } else {
+            layer_buffers.emplace_back(m_compute_device->CreateBuffer(size, BufferUsage::ReadWrite, name + std::to_string(i)));
+        }
     }
 }
 
-void NetworkResourceHandle::AllocateMutationBuffer()
+void NetworkResourceHandle::FreeLayerBuffers(std::unique_ptr<IBuffer>& arena, std::vector<std::unique_ptr<IBuffer>>& layer_buffers)
 {
-    if (!m_mutation_buffers.empty()) {
-        for (uint32_t i = 0; i < m_network->GetLayerCount(); ++i) {
-            m_mutation_buffers.emplace_back(m_compute_device->CreateBuffer(m_network->GetLayers()[i].m_tensor->GetByteSize(), BufferUsage::ReadOnly, "mutation_buffer_" + std::to_string(i)));
+    layer_buffers.clear();
+    arena.reset();
+}
+
+void NetworkResourceHandle::QueueClearLayerBuffers(std::unique_ptr<IBuffer>& arena, std::vector<std::unique_ptr<IBuffer>>& layer_buffers)
+{
+    if (arena) {
+        m_compute_device->QueueFillBuffer(arena.get(), 0, 0, arena->GetSize());
+        return;
+    }
+
+    for (auto& layer_buffer : layer_buffers) {
+        m_compute_device->QueueFillBuffer(layer_buffer.get(), 0, 0, layer_buffer->GetSize());
+    }
+}
+
+NetworkResourceHandle::EvaluationBuffers NetworkResourceHandle::AcquireEvaluationBuffers(uint32_t batch_size) const
+{
+    const size_t largest_layer_buffer_required_size =
+        size_t(batch_size) * std::max(m_network->GetInputCount(), CalculateLargestLayerNeuronCount(m_network->GetLayers())) * sizeof(float);
+
+    EvaluationBuffers ret;
+
+    {
+        std::scoped_lock lock(m_evaluation_buffers_mutex);
+        if (!m_evaluation_buffers_pool.empty()) {
+            ret = std::move(m_evaluation_buffers_pool.back());
+            m_evaluation_buffers_pool.pop_back();
         }
     }
+
+    // Every concurrent evaluation needs its own pair of buffers, the pool grows to the number of threads evaluating at the same time
+    if (!ret.m_layer_result_buffer_a || ret.m_layer_result_buffer_a->GetSize() < largest_layer_buffer_required_size) {
+        ret.m_layer_result_buffer_a.reset();
+        ret.m_layer_result_buffer_a = m_compute_device->CreateBuffer(largest_layer_buffer_required_size, BufferUsage::ReadWrite, "layer_result_buffer_a");
+    }
+
+    if (!ret.m_layer_result_buffer_b || ret.m_layer_result_buffer_b->GetSize() < largest_layer_buffer_required_size) {
+        ret.m_layer_result_buffer_b.reset();
+        ret.m_layer_result_buffer_b = m_compute_device->CreateBuffer(largest_layer_buffer_required_size, BufferUsage::ReadWrite, "layer_result_buffer_b");
+    }
+
+    return ret;
+}
+
+void NetworkResourceHandle::ReleaseEvaluationBuffers(EvaluationBuffers&& evaluation_buffers) const
+{
+    std::scoped_lock lock(m_evaluation_buffers_mutex);
+    m_evaluation_buffers_pool.emplace_back(std::move(evaluation_buffers));
+}
+
+void NetworkResourceHandle::AllocateTrainingResources(uint32_t training_sample_count, Optimizer optimizer, uint32_t checkpoint_interval)
+{
+    if (m_is_prepared_for_inference) {
+        throw std::runtime_error("Network is prepared for inference only!");
+    }
+
+    m_training_buffers.clear();
+    FreeLayerBuffers(m_gradient_arena, m_gradient_buffers);
+
+    m_training_memory_plan = CreateTrainingMemoryPlan(*m_network, training_sample_count, optimizer, checkpoint_interval);
+
+    const size_t total_memory = m_compute_device->GetTotalMemory();
+    if (total_memory != 0 && m_training_memory_plan.GetTotalSize() > total_memory) {
+        const uint32_t max_sample_count = CalculateMaxTrainingSampleCount(*m_network, optimizer, total_memory, checkpoint_interval);
+        throw std::runtime_error("Training resources of " + std::to_string(m_training_memory_plan.GetTotalSize()) + " bytes don't fit into the memory of the device, at most " +
+                                 std::to_string(max_sample_count) + " samples per training step are supported!");
+    }
+
+    for (uint32_t i = 0; i < uint32_t(m_training_memory_plan.m_physical_buffer_sizes.size()); ++i) {
+        m_training_buffers.emplace_back(m_compute_device->CreateBuffer(m_training_memory_plan.m_physical_buffer_sizes[i], BufferUsage::ReadWrite, "training_buffer_" + std::to_string(i)));
+    }
+
+    CreateLayerBuffers(m_gradient_arena, m_gradient_buffers, "gradient_buffer_");
+}
+
+void NetworkResourceHandle::AllocateTrainingResources(const TrainingSuite& training_suite)
+{
+    if (training_suite.m_mini_batch_size && *training_suite.m_mini_batch_size == 0) {
+        throw std::runtime_error("Mini-batch size must be greater than zero!");
+    }
+    if (training_suite.m_micro_batch_size && *training_suite.m_micro_batch_size == 0) {
+        throw std::runtime_error("Micro-batch size must be greater than zero!");
+    }
+    if (training_suite.m_training_data.empty()) {
+        throw std::runtime_error("Training suite has no training data!");
+    }
+
+    const uint64_t mini_batch_size = training_suite.m_mini_batch_size ? std::min(*training_suite.m_mini_batch_size, uint64_t(training_suite.m_training_data.size()))
+                                                                      : uint64_t(training_suite.m_training_data.size());
+    const uint64_t sample_count = training_suite.m_micro_batch_size ? std::min(*training_suite.m_micro_batch_size, mini_batch_size) : mini_batch_size;
+
+    AllocateTrainingResources(uint32_t(sample_count), training_suite.m_optimizer, training_suite.m_checkpoint_interval ? *training_suite.m_checkpoint_interval : 0);
 }
 
-void NetworkResourceHandle::AllocateTrainingResources(uint32_t training_sample_count)
+IBuffer* NetworkResourceHandle::GetTrainingBuffer(TrainingBufferRole role, uint32_t layer_id) const
 {
-    const auto largest_layer_neuron_count = CalculateLargestLayerNeuronCount(m_network->GetLayers());
+    return m_training_buffers[m_training_memory_plan.GetBuffer(role, layer_id).m_physical_buffer_id].get();
+}
+
+void NetworkResourceHandle::AllocateOptimizerResources(const TrainingSuite& training_suite)
+{
+    const bool needs_moment1 = training_suite.m_optimizer != Optimizer::SGD;
+    const bool needs_moment2 = training_suite.m_optimizer == Optimizer::Adam || training_suite.m_optimizer == Optimizer::AdamW;
+
+    // The moments of a different optimizer have a different meaning, they are restarted from zero when the optimizer changes.
+    // The moments the new optimizer doesn't use are released.
+    if (training_suite.m_optimizer != m_moment_optimizer) {
+        if (needs_moment1) {
+            QueueClearLayerBuffers(m_moment1_arena, m_moment1_buffers);
+        } else {
+            FreeLayerBuffers(m_moment1_arena, m_moment1_buffers);
+        }
+
+        if (needs_moment2) {
+            QueueClearLayerBuffers(m_moment2_arena, m_moment2_buffers);
+        } else {
+            FreeLayerBuffers(m_moment2_arena, m_moment2_buffers);
+        }
+
+        m_moment_optimizer = training_suite.m_optimizer;
+        m_optimizer_step = 0;
+    }
+
+    auto allocate_moment_buffers = [this](std::unique_ptr<IBuffer>& moment_arena, std::vector<std::unique_ptr<IBuffer>>& moment_buffers, const std::string& name) {
+        if (!moment_buffers.empty()) {
+            return;
+        }
+
+        CreateLayerBuffers(moment_arena, moment_buffers, name);
+        QueueClearLayerBuffers(moment_arena, moment_buffers);
+        m_optimizer_step = 0;
+    };
 
-    m_input_buffer = m_compute_device->CreateBuffer(training_sample_count * m_network->GetInputCount() * sizeof(float), BufferUsage::ReadOnly, "input_buffer");
-    m_desired_output_buffer = m_compute_device->CreateBuffer(training_sample_count * m_network->GetOutputCount() * sizeof(float), BufferUsage::ReadOnly, "desired_output_buffer");
-    m_delta_k_buffer_a = m_compute_device->CreateBuffer(training_sample_count * largest_layer_neuron_count * sizeof(float), BufferUsage::ReadWrite, "delta_k_buffer_a");
-    m_delta_k_buffer_b = m_compute_device->CreateBuffer(training_sample_count * largest_layer_neuron_count * sizeof(float), BufferUsage::ReadWrite, "delta_k_buffer_b");
-    for (uint32_t i = 0; i < m_network->GetLayerCount(); ++i) {
-        m_gradient_buffers.emplace_back(m_compute_device->CreateBuffer(m_network->GetLayers()[i].m_tensor->GetByteSize(), BufferUsage::ReadWrite, "gradient_buffer_" + std::to_string(i)));
-        m_activation_buffers.emplace_back(m_compute_device->CreateBuffer(training_sample_count * m_network->GetLayers()[i].m_tensor->GetElementSize() * sizeof(float), BufferUsage::ReadWrite,
-                                                                         "activations_buffer_" + std::to_string(i)));
-        m_zvalue_buffers.emplace_back(m_compute_device->CreateBuffer(training_sample_count * m_network->GetLayers()[i].m_tensor->GetElementSize() * sizeof(float), BufferUsage::ReadWrite,
-                                                                     "zvalues_buffer_" + std::to_string(i)));
+    if (needs_moment1) {
+        allocate_moment_buffers(m_moment1_arena, m_moment1_buffers, "moment1_buffer_");
+    }
+
+    if (needs_moment2) {
+        allocate_moment_buffers(m_moment2_arena, m_moment2_buffers, "moment2_buffer_");
     }
 }
 
 void NetworkResourceHandle::FreeCachedResources()
 {
-    m_input_buffer.reset();
-    m_desired_output_buffer.reset();
-    m_activation_buffers.clear();
-    m_zvalue_buffers.clear();
-    m_delta_k_buffer_a.reset();
-    m_delta_k_buffer_b.reset();
-    m_gradient_buffers.clear();
+    m_training_memory_plan = {};
+    m_training_buffers.clear();
+    FreeLayerBuffers(m_gradient_arena, m_gradient_buffers);
+    {
+        std::scoped_lock lock(m_evaluation_buffers_mutex);
+        m_evaluation_buffers_pool.clear();
+    }
+    FreeLayerBuffers(m_moment1_arena, m_moment1_buffers);
+    FreeLayerBuffers(m_moment2_arena, m_moment2_buffers);
+    m_moment_optimizer = Optimizer::SGD;
+    m_optimizer_step = 0;
+}
+
+PopulationResourceHandle::PopulationResourceHandle(const Network& network, uint32_t population_size, IComputeDevice& compute_device)
+    : m_compute_device(&compute_device), m_network(&network), m_population_size(population_size)
+{
+    if (population_size == 0) {
+        throw std::runtime_error("Population size must be at least 1!");
+    }
+
+    int tensor_id = 0;
+    for (const auto& layer : network.GetLayers()) {
+        const size_t member_stride = GetPopulationMemberByteStride(layer);
+        m_tensor_buffers.emplace_back(m_compute_device->CreateBuffer(member_stride * population_size, BufferUsage::ReadWrite, "population_tensor_" + std::to_string(tensor_id)));
+        m_next_generation_tensor_buffers.emplace_back(
+            m_compute_device->CreateBuffer(member_stride * population_size, BufferUsage::ReadWrite, "population_next_generation_tensor_" + std::to_string(tensor_id)));
+        for (uint32_t member_id = 0; member_id < population_size; ++member_id) {
+            m_compute_device->QueueWriteToBuffer(m_tensor_buffers.back().get(), layer.m_tensor->GetRawData(), member_stride * member_id);
+        }
+        ++tensor_id;
+    }
+
+    m_parent_ids_buffer = m_compute_device->CreateBuffer(population_size * 2 * sizeof(uint32_t), BufferUsage::ReadOnly, "population_parent_ids");
+
+    m_compute_device->SubmitQueue();
+    m_compute_device->WaitQueueIdle();
+}
+
+void PopulationResourceHandle::ReadMember(uint32_t member_id, Network& network)
+{
+    if (member_id >= m_population_size || network.GetLayerCount() != m_network->GetLayerCount()) {
+        throw std::runtime_error("Invalid population member!");
+    }
+
+    for (uint32_t i = 0; i < network.GetLayerCount(); ++i) {
+        auto tensor_data = network.GetLayers()[i].m_tensor->GetRawData();
+        m_compute_device->QueueReadFromBuffer(m_tensor_buffers[i].get(), tensor_data, GetPopulationMemberByteStride(m_network->GetLayers()[i]) * member_id);
+    }
+    m_compute_device->SubmitQueue();
+    m_compute_device->WaitQueueIdle();
+}
+
+void PopulationResourceHandle::WriteMember(uint32_t member_id, const Network& network)
+{
+    if (member_id >= m_population_size || network.GetLayerCount() != m_network->GetLayerCount()) {
+        throw std::runtime_error("Invalid population member!");
+    }
+
+    for (uint32_t i = 0; i < network.GetLayerCount(); ++i) {
+        const auto tensor_data = network.GetLayers()[i].m_tensor->GetRawData();
+        m_compute_device->QueueWriteToBuffer(m_tensor_buffers[i].get(), tensor_data, GetPopulationMemberByteStride(m_network->GetLayers()[i]) * member_id);
+    }
+    m_compute_device->SubmitQueue();
+    m_compute_device->WaitQueueIdle();
+}
+
+void PopulationResourceHandle::AllocateBatchEvalResources() const
+{
+    const size_t largest_layer_buffer_required_size = size_t(m_population_size) * std::max(m_network->GetInputCount(), CalculateLargestLayerNeuronCount(m_network->GetLayers())) * sizeof(float);
+
+    if (!m_layer_result_buffer_a || m_layer_result_buffer_a->GetSize() < largest_layer_buffer_required_size) {
+        m_layer_result_buffer_a.reset();
+        m_layer_result_buffer_a = m_compute_device->CreateBuffer(largest_layer_buffer_required_size, BufferUsage::ReadWrite, "population_layer_result_buffer_a");
+    }
+
+    if (!m_layer_result_buffer_b || m_layer_result_buffer_b->GetSize() < largest_layer_buffer_required_size) {
+        m_layer_result_buffer_b.reset();
+        m_layer_result_buffer_b = m_compute_device->CreateBuffer(largest_layer_buffer_required_size, BufferUsage::ReadWrite, "population_layer_result_buffer_b");
+    }
+}
+
+void PopulationResourceHandle::FreeCachedResources()
+{
     m_layer_result_buffer_a.reset();
     m_layer_result_buffer_b.reset();
-    m_mutation_buffers.clear();
 }
 
 std::vector<float> ComputeTasks::Evaluate(const NetworkResourceHandle& network_resources, std::span<const float> input) const
+{
+    return EvaluateBatch(network_resources, input, 1);
+}
+
+std::vector<float> ComputeTasks::EvaluateBatch(const NetworkResourceHandle& network_resources, std::span<const float> inputs, uint32_t batch_size) const
+{
+    std::vector<float> result;
+    result.resize(size_t(network_resources.m_network->GetOutputCount()) * batch_size);
+
+    EvaluateBatch(network_resources, inputs, result, batch_size);
+
+    return result;
+}
+
+void ComputeTasks::Evaluate(const NetworkResourceHandle& network_resources, std::span<const float> input, std::span<float> output) const
+{
+    EvaluateBatch(network_resources, input, output, 1);
+}
+
+void ComputeTasks::EvaluateBatch(const NetworkResourceHandle& network_resources, std::span<const float> inputs, std::span<float> outputs, uint32_t batch_size) const
 {
     Network& network = *network_resources.m_network;
     IComputeDevice& compute_device = *network_resources.m_compute_device;
 
-    if (input.size() != size_t(network.GetInputCount())) {
+    if (batch_size == 0 || inputs.size() != size_t(network.GetInputCount()) * batch_size) {
         throw std::runtime_error("Invalid input length!");
     }
 
-    network_resources.AllocateBatchEvalResources();
+    if (outputs.size() != size_t(network.GetOutputCount()) * batch_size) {
+        throw std::runtime_error("Invalid output length!");
+    }
+
+    auto evaluation_buffers = network_resources.AcquireEvaluationBuffers(batch_size);
 
     auto layers = network.GetLayers();
 
-    auto layer_results_input = network_resources.m_layer_result_buffer_a.get();
-    auto layer_results_output = network_resources.m_layer_result_buffer_b.get();
+    auto layer_results_input = evaluation_buffers.m_layer_result_buffer_a.get();
+    auto layer_results_output = evaluation_buffers.m_layer_result_buffer_b.get();
 
     // Write input into buffer for all batches
-    compute_device.QueueWriteToBuffer(network_resources.m_layer_result_buffer_a.get(), ToReadOnlyUi8Span(input), 0);
-
-    uint64_t weights_layer_offset = 0;
+    compute_device.QueueWriteToBuffer(layer_results_input, ToReadOnlyUi8Span(inputs), 0);
 
     for (uint32_t i = 0; i < layers.size(); ++i) {
         const uint32_t input_num = i == 0 ? network.GetInputCount() : layers[i - 1].m_num_neurons;
         const uint32_t output_num = layers[i].m_num_neurons;
         const ActivationFunction activation = layers[i].m_activation;
 
-        compute_device.QueueEvaluateLayer(network_resources.m_tensor_buffers[i].get(), layer_results_input, layer_results_output, activation, input_num, output_num);
-
-        const uint64_t layer_weight_size_bytes = uint64_t(input_num) * output_num + output_num;
-        ASSERTM(weights_layer_offset + layer_weight_size_bytes > weights_layer_offset, "Layer weights offset overflow!");
-        weights_layer_offset += layer_weight_size_bytes; // advance the offset in the weights buffer for the next layer
+        // Every input of the batch is evaluated with the same weights
+        compute_device.QueueEvaluateLayerBatched(network_resources.m_tensor_buffers[i].get(), layer_results_input, layer_results_output, activation, input_num, output_num, batch_size, 0);
 
         std::swap(layer_results_input, layer_results_output); // output of this layer is input of the next
     }
 
-    std::vector<float> result;
-    result.resize(size_t(network.GetOutputCount()));
-
     auto final_layer_results = layer_results_input;
-    compute_device.QueueReadFromBuffer(final_layer_results, ToWriteableUi8Span(result), 0);
+    compute_device.QueueReadFromBuffer(final_layer_results, ToWriteableUi8Span(outputs), 0);
     compute_device.SubmitQueue();
     compute_device.WaitQueueIdle();
 
-    return result;
+    network_resources.ReleaseEvaluationBuffers(std::move(evaluation_buffers));
+}
+
+void ComputeTasks::TrainMinibatch(NetworkResourceHandle& network_handle, const TrainingSuite& training_suite, uint64_t trainingDataBegin, uint64_t trainingDataEnd,
+                                  std::span<const uint64_t> training_data_order) const
+{
+    CalculateGradients(network_handle, training_suite, trainingDataBegin, trainingDataEnd, training_data_order);
+    ApplyGradients(network_handle, training_suite, uint32_t(trainingDataEnd - trainingDataBegin));
 }
 
-void ComputeTasks::TrainMinibatch(NetworkResourceHandle& network_handle, const TrainingSuite& training_suite, uint64_t trainingDataBegin, uint64_t trainingDataEnd) const
+void ComputeTasks::CalculateGradients(NetworkResourceHandle& network_handle, const TrainingSuite& training_suite, uint64_t trainingDataBegin, uint64_t trainingDataEnd,
+                                      std::span<const uint64_t> training_data_order) const
 {
     Network& network = *network_handle.m_network;
     IComputeDevice& compute_device = *network_handle.m_compute_device;
 
-    const uint32_t num_training_samples = trainingDataEnd - trainingDataBegin;
+    if (network_handle.IsPreparedForInference()) {
+        throw std::runtime_error("Network is prepared for inference only!");
+    }
+
     auto layers = network.GetLayers();
-    const uint32_t total_neuron_count = network.GetNeuronCount();
-    const auto largest_layer_neuron_count = CalculateLargestLayerNeuronCount(layers);
 
-    for (auto& gradient_buffer : network_handle.m_gradient_buffers) {
-        compute_device.QueueFillBuffer(gradient_buffer.get(), 0, 0, gradient_buffer->GetSize());
+    // The backward pass of softmax needs the whole row of the layer, this is only implemented for the output layer
+    for (uint32_t i = 0; i + 1 < layers.size(); ++i) {
+        if (layers[i].m_activation == ActivationFunction::Softmax) {
+            throw std::runtime_error("Softmax activation is only supported on the output layer for training!");
+        }
     }
 
-    std::vector<float> training_input_buffer_data;
-    {
-        training_input_buffer_data.resize(num_training_samples * network.GetInputCount());
-        auto data_ptr = training_input_buffer_data.data();
-        for (auto i = trainingDataBegin; i < trainingDataEnd; ++i) {
-            std::memcpy(data_ptr, training_suite.m_training_data[i].m_input.data(), training_suite.m_training_data[i].m_input.size() * sizeof(float));
-            data_ptr += training_suite.m_training_data[i].m_input.size();
-        }
+    if (training_suite.m_cost_function == CostFunction::CrossEntropy_Softmax && layers.back().m_activation != ActivationFunction::Softmax) {
+        throw std::runtime_error("CrossEntropy_Softmax cost function requires a Softmax output layer!");
+    }
 
-        compute_device.QueueWriteToBuffer(network_handle.m_input_buffer.get(), ToReadOnlyUi8Span(training_input_buffer_data), 0);
+    const TrainingMemoryPlan& plan = network_handle.GetTrainingMemoryPlan();
+    const uint64_t micro_batch_size = plan.m_training_sample_count;
+
+    if (micro_batch_size == 0) {
+        throw std::runtime_error("Training resources are not allocated!");
     }
 
-    std::vector<float> training_desired_output_buffer_data;
-    {
-        training_desired_output_buffer_data.resize(num_training_samples * network.GetOutputCount());
-        auto data_ptr = training_desired_output_buffer_data.data();
-        for (auto i = trainingDataBegin; i < trainingDataEnd; ++i) {
-            std::memcpy(data_ptr, training_suite.m_training_data[i].m_desired_output.data(), training_suite.m_training_data[i].m_desired_output.size() * sizeof(float));
-            data_ptr += training_suite.m_training_data[i].m_desired_output.size();
+    // Layers whose activation function doesn't use z values have no z value buffer
+    const auto get_zvalues_buffer = [&](TrainingBufferRole role, uint32_t layer_id) { return plan.HasBuffer(role, layer_id) ? network_handle.GetTrainingBuffer(role, layer_id) : nullptr; };
+
+    network_handle.QueueClearLayerBuffers(network_handle.m_gradient_arena, network_handle.m_gradient_buffers);
+
+    // The gradient calculation of every micro-batch adds to the gradient buffers, so the result is the gradient of the whole range
+    for (uint64_t micro_batch_begin = trainingDataBegin; micro_batch_begin < trainingDataEnd; micro_batch_begin += micro_batch_size) {
+        const uint64_t micro_batch_end = std::min(micro_batch_begin + micro_batch_size, trainingDataEnd);
+        const uint32_t num_training_samples = uint32_t(micro_batch_end - micro_batch_begin);
+
+        // The samples of the micro-batch are assembled in the mapped buffers, without an intermediate copy
+        {
+            IBuffer* input_buffer = network_handle.GetTrainingBuffer(TrainingBufferRole::Input);
+            auto input_data = compute_device.MapBuffer(input_buffer, BufferUsage::WriteOnly, 0, size_t(num_training_samples) * network.GetInputCount() * sizeof(float));
+            auto data_ptr = input_data.data();
+            for (auto i = micro_batch_begin; i < micro_batch_end; ++i) {
+                const auto& training_data = training_suite.m_training_data[training_data_order.empty() ? i : training_data_order[i]];
+                std::memcpy(data_ptr, training_data.m_input.data(), training_data.m_input.size() * sizeof(float));
+                data_ptr += training_data.m_input.size() * sizeof(float);
+            }
+            compute_device.UnmapBuffer(input_buffer);
+        }
+
+        {
+            IBuffer* desired_output_buffer = network_handle.GetTrainingBuffer(TrainingBufferRole::DesiredOutput);
+            auto desired_output_data =
+                compute_device.MapBuffer(desired_output_buffer, BufferUsage::WriteOnly, 0, size_t(num_training_samples) * network.GetOutputCount() * sizeof(float));
+            auto data_ptr = desired_output_data.data();
+            for (auto i = micro_batch_begin; i < micro_batch_end; ++i) {
+                const auto& training_data = training_suite.m_training_data[training_data_order.empty() ? i : training_data_order[i]];
+                std::memcpy(data_ptr, training_data.m_desired_output.data(), training_data.m_desired_output.size() * sizeof(float));
+                data_ptr += training_data.m_desired_output.size() * sizeof(float);
+            }
+            compute_device.UnmapBuffer(desired_output_buffer);
         }
 
-        compute_device.QueueWriteToBuffer(network_handle.m_desired_output_buffer.get(), ToReadOnlyUi8Span(training_desired_output_buffer_data), 0);
+        // Forward pass (calculating z values and activations for each neuron times for each training data in the network)
+        for (uint32_t i = 0; i < layers.size(); ++i) {
+            const uint32_t input_num = i == 0 ? network.GetInputCount() : layers[i - 1].m_num_neurons;
+            const uint32_t output_num = layers[i].m_num_neurons;
+            const bool is_first_layer = i == 0;
+
+            // The results of recomputed layers are only kept until the next layer is evaluated
+            IBuffer* input_buffer = is_first_layer                        ? network_handle.GetTrainingBuffer(TrainingBufferRole::Input)
+                                    : plan.IsRecomputedLayer(i - 1) ? network_handle.GetTrainingBuffer(TrainingBufferRole::ForwardActivations, i - 1)
+                                                                    : network_handle.GetTrainingBuffer(TrainingBufferRole::Activations, i - 1);
+            const bool is_recomputed = plan.IsRecomputedLayer(i);
+
+            compute_device.QueueTrainForwardPass(
+                network_handle.m_tensor_buffers[i].get(), input_buffer, network_handle.GetTrainingBuffer(is_recomputed ? TrainingBufferRole::ForwardActivations : TrainingBufferRole::Activations, i),
+                get_zvalues_buffer(is_recomputed ? TrainingBufferRole::ForwardZValues : TrainingBufferRole::ZValues, i), layers[i].m_activation, output_num, input_num,
+                num_training_samples);
+        }
+
+        // Backwards pass: calculate the delta_k vectors of the layer, then reduce them into the accumulated gradient in a separate pass
+        for (int i = layers.size() - 1; i >= 0; --i) {
+            const uint32_t input_num = i == 0 ? network.GetInputCount() : layers[i - 1].m_num_neurons;
+            const uint32_t output_num = layers[i].m_num_neurons;
+            const bool is_output_layer = i == layers.size() - 1;
+            const uint32_t next_layer_neuron_count = is_output_layer ? 0 : layers[i + 1].m_num_neurons;
+            const bool is_input_layer = i == 0;
+
+            // Reaching a checkpoint, the recomputed layers before it are evaluated again from the previous checkpoint
+            if (i > 0 && !plan.IsRecomputedLayer(i) && plan.IsRecomputedLayer(i - 1)) {
+                uint32_t segment_begin = i - 1;
+                while (segment_begin > 0 && plan.IsRecomputedLayer(segment_begin - 1)) {
+                    --segment_begin;
+                }
+
+                for (uint32_t j = segment_begin; j < uint32_t(i); ++j) {
+                    compute_device.QueueTrainForwardPass(network_handle.m_tensor_buffers[j].get(),
+                                                         j == 0 ? network_handle.GetTrainingBuffer(TrainingBufferRole::Input) : network_handle.GetTrainingBuffer(TrainingBufferRole::Activations, j - 1),
+                                                         network_handle.GetTrainingBuffer(TrainingBufferRole::Activations, j), get_zvalues_buffer(TrainingBufferRole::ZValues, j),
+                                                         layers[j].m_activation, layers[j].m_num_neurons, j == 0 ? network.GetInputCount() : layers[j - 1].m_num_neurons, num_training_samples);
+                }
+            }
+
+            // The output layer doesn't read the delta_k of a next layer, its own buffer is bound in its place
+            IBuffer* delta_k_buffer_write = network_handle.GetTrainingBuffer(TrainingBufferRole::DeltaK, i);
+            IBuffer* delta_k_buffer_read = is_output_layer ? delta_k_buffer_write : network_handle.GetTrainingBuffer(TrainingBufferRole::DeltaK, i + 1);
+
+            compute_device.QueueTrainBackwardPass(is_output_layer, is_output_layer ? network_handle.GetTrainingBuffer(TrainingBufferRole::DesiredOutput) : network_handle.m_tensor_buffers[i + 1].get(),
+                                                  network_handle.GetTrainingBuffer(TrainingBufferRole::Activations, i), get_zvalues_buffer(TrainingBufferRole::ZValues, i),
+                                                  delta_k_buffer_write, delta_k_buffer_read, output_num, layers[i].m_activation, num_training_samples, training_suite.m_cost_function,
+                                                  next_layer_neuron_count);
+
+            compute_device.QueueTrainCalculateGradient(delta_k_buffer_write,
+                                                       is_input_layer ? network_handle.GetTrainingBuffer(TrainingBufferRole::Input) : network_handle.GetTrainingBuffer(TrainingBufferRole::Activations, i - 1),
+                                                       network_handle.m_gradient_buffers[i].get(), output_num, input_num, num_training_samples);
+        }
+
+        // The next micro-batch overwrites the uploaded samples, so the queue is drained before continuing
+        compute_device.SubmitQueue();
+        compute_device.WaitQueueIdle();
     }
+}
 
-    // Forward pass (calculating z values and activations for each neuron times for each training data in the network)
+void ComputeTasks::ApplyGradients(NetworkResourceHandle& network_handle, const TrainingSuite& training_suite, uint32_t num_training_samples) const
+{
+    Network& network = *network_handle.m_network;
+    IComputeDevice& compute_device = *network_handle.m_compute_device;
+    auto layers = network.GetLayers();
+
+    if (network_handle.IsPreparedForInference()) {
+        throw std::runtime_error("Network is prepared for inference only!");
+    }
+
+    network_handle.AllocateOptimizerResources(training_suite);
+    ++network_handle.m_optimizer_step;
+
+    const auto optimizer_parameters = CreateOptimizerParameters(training_suite, num_training_samples, network_handle.m_optimizer_step);
+
+    // Gradient apply pass
     for (uint32_t i = 0; i < layers.size(); ++i) {
         const uint32_t input_num = i == 0 ? network.GetInputCount() : layers[i - 1].m_num_neurons;
         const uint32_t output_num = layers[i].m_num_neurons;
-        const bool is_first_layer = i == 0;
 
-        compute_device.QueueTrainForwardPass(network_handle.m_tensor_buffers[i].get(), is_first_layer ? network_handle.m_input_buffer.get() : network_handle.m_activation_buffers[i - 1].get(),
-                                             network_handle.m_activation_buffers[i].get(), network_handle.m_zvalue_buffers[i].get(), layers[i].m_activation, output_num, input_num,
-                                             num_training_samples);
+        compute_device.QueueApplyGradients(network_handle.m_tensor_buffers[i].get(), network_handle.m_gradient_buffers[i].get(),
+                                           network_handle.m_moment1_buffers.empty() ? nullptr : network_handle.m_moment1_buffers[i].get(),
+                                           network_handle.m_moment2_buffers.empty() ? nullptr : network_handle.m_moment2_buffers[i].get(), output_num, input_num, optimizer_parameters);
     }
 
-    auto delta_k_buffer_read = network_handle.m_delta_k_buffer_a.get();
-    auto delta_k_buffer_write = network_handle.m_delta_k_buffer_b.get();
+    compute_device.SubmitQueue();
+    compute_device.WaitQueueIdle();
+}
+
+void ComputeTasks::ApplyRandomMutation(NetworkResourceHandle& network_handle, MutationDistribution weight_mutation_distribution, MutationDistribution bias_mutation_distribution,
+                                       std::optional<uint64_t> seed)
+{
+    Network& network = *network_handle.m_network;
+    IComputeDevice& compute_device = *network_handle.m_compute_device;
 
-    // Backwards pass (accumulated gradient calculation)
-    for (int i = layers.size() - 1; i >= 0; --i) {
+    if (network_handle.IsPreparedForInference()) {
+        throw std::runtime_error("Network is prepared for inference only!");
+    }
+
+    auto mutation_parameters = CreateMutationParameters(weight_mutation_distribution, bias_mutation_distribution, seed);
+
+    const auto& layers = network.GetLayers();
+
+    // The random values are generated on the device, every layer uses its own random stream
+    for (uint32_t i = 0; i < layers.size(); ++i) {
         const uint32_t input_num = i == 0 ? network.GetInputCount() : layers[i - 1].m_num_neurons;
         const uint32_t output_num = layers[i].m_num_neurons;
-        const bool is_output_layer = i == layers.size() - 1;
-        const uint32_t next_layer_neuron_count = is_output_layer ? 0 : layers[i + 1].m_num_neurons;
-        const bool is_input_layer = i == 0;
-
-        compute_device.QueueTrainBackwardPass(is_output_layer, is_output_layer ? network_handle.m_desired_output_buffer.get() : network_handle.m_tensor_buffers[i + 1].get(),
-                                              is_input_layer ? network_handle.m_input_buffer.get() : network_handle.m_activation_buffers[i - 1].get(), network_handle.m_activation_buffers[i].get(),
-                                              network_handle.m_zvalue_buffers[i].get(), delta_k_buffer_write, delta_k_buffer_read, network_handle.m_gradient_buffers[i].get(), output_num, input_num,
-                                              layers[i].m_activation, num_training_samples, training_suite.m_cost_function, next_layer_neuron_count);
 
-        std::swap(delta_k_buffer_write, delta_k_buffer_read);
+        mutation_parameters.m_stream = i;
+        compute_device.QueueApplyMutation(network_handle.m_tensor_buffers[i].get(), output_num, input_num, 1, mutation_parameters);
     }
 
-    // Calculate regularization terms based on the training configuration
-    float regularizationTerm1 = 1.0f;
-    float regularizationTerm2Base = 0.0f;
-    if (training_suite.m_regularization == Regularization::L2) {
-        regularizationTerm1 = 1.0f - training_suite.m_learning_rate * (training_suite.m_regularization_rate / (float)training_suite.m_training_data.size());
-    } else if (training_suite.m_regularization == Regularization::L1) {
-        regularizationTerm2Base = -((training_suite.m_learning_rate * (training_suite.m_regularization_rate / (float)training_suite.m_training_data.size())));
+    compute_device.SubmitQueue();
+    compute_device.WaitQueueIdle();
+}
+
+std::vector<float> ComputeTasks::EvaluatePopulation(const PopulationResourceHandle& population, std::span<const float> inputs) const
+{
+    const Network& network = *population.m_network;
+    IComputeDevice& compute_device = *population.m_compute_device;
+
+    if (inputs.size() != size_t(network.GetInputCount()) * population.m_population_size) {
+        throw std::runtime_error("Invalid input length!");
     }
-    const bool applyRegularizationTerm2 = regularizationTerm2Base != 0.0f;
 
-    const float normalized_learning_rate = training_suite.m_learning_rate * (float(trainingDataEnd - trainingDataBegin) / (float)training_suite.m_training_data.size());
+    population.AllocateBatchEvalResources();
 
-    // Gradient apply pass
+    auto layers = network.GetLayers();
+
+    auto layer_results_input = population.m_layer_result_buffer_a.get();
+    auto layer_results_output = population.m_layer_result_buffer_b.get();
+
+    compute_device.QueueWriteToBuffer(layer_results_input, ToReadOnlyUi8Span(inputs), 0);
+
+    // Every member of the population evaluates its own input with its own weights, so each layer is a single dispatch
     for (uint32_t i = 0; i < layers.size(); ++i) {
         const uint32_t input_num = i == 0 ? network.GetInputCount() : layers[i - 1].m_num_neurons;
         const uint32_t output_num = layers[i].m_num_neurons;
+        const uint32_t weights_batch_stride = layers[i].m_tensor->GetLayout().GetTensorStride();
+
+        compute_device.QueueEvaluateLayerBatched(population.m_tensor_buffers[i].get(), layer_results_input, layer_results_output, layers[i].m_activation, input_num, output_num,
+                                                 population.m_population_size, weights_batch_stride);
 
-        compute_device.QueueApplyGradients(network_handle.m_tensor_buffers[i].get(), network_handle.m_gradient_buffers[i].get(), output_num, input_num, regularizationTerm1, regularizationTerm2Base,
-                                           normalized_learning_rate);
+        std::swap(layer_results_input, layer_results_output);
     }
 
+    std::vector<float> result;
+    result.resize(size_t(network.GetOutputCount()) * population.m_population_size);
+
+    compute_device.QueueReadFromBuffer(layer_results_input, ToWriteableUi8Span(result), 0);
     compute_device.SubmitQueue();
     compute_device.WaitQueueIdle();
+
+    return result;
 }
 
-void ComputeTasks::ApplyRandomMutation(NetworkResourceHandle& network_handle, MutationDistribution weight_mutation_distribution, MutationDistribution bias_mutation_distribution)
+void ComputeTasks::ApplyRandomMutation(PopulationResourceHandle& population, MutationDistribution weight_mutation_distribution, MutationDistribution bias_mutation_distribution,
+                                       std::optional<uint64_t> seed)
 {
-    Network& network = *network_handle.m_network;
-    IComputeDevice& compute_device = *network_handle.m_compute_device;
+    const Network& network = *population.m_network;
+    IComputeDevice& compute_device = *population.m_compute_device;
 
-    network_handle.AllocateMutationBuffer();
+    auto mutation_parameters = CreateMutationParameters(weight_mutation_distribution, bias_mutation_distribution, seed);
 
-    std::vector<std::vector<float>> mutation_buffers;
-    mutation_buffers.resize(network.GetLayerCount());
-
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    const auto& layers = network.GetLayers();
 
-    auto generate_mutator = [&](const MutationDistribution& mutation_distribution) {
-        if (std::holds_alternative<UniformDistribution>(mutation_distribution)) {
-            UniformDistribution uniform_distribution_desc = std::get<UniformDistribution>(mutation_distribution);
-            std::uniform_real_distribution uniform_distribution(-uniform_distribution_desc.range, uniform_distribution_desc.range);
+    // The members are stored after each other, so the whole population of a layer is mutated with one dispatch
+    for (uint32_t i = 0; i < layers.size(); ++i) {
+        const uint32_t input_num = i == 0 ? network.GetInputCount() : layers[i - 1].m_num_neurons;
+        const uint32_t output_num = layers[i].m_num_neurons;
 
-            return [uniform_distribution, &gen](float x) mutable { return x + uniform_distribution(gen); };
-        }
-        throw std::runtime_error("Invalid mutation distribution!");
-    };
+        mutation_parameters.m_stream = i;
+        compute_device.QueueApplyMutation(population.m_tensor_buffers[i].get(), output_num, input_num, population.m_population_size, mutation_parameters);
+    }
 
-    std::function<float(float)> weight_mutator = generate_mutator(weight_mutation_distribution);
-    std::function<float(float)> bias_mutator = generate_mutator(bias_mutation_distribution);
+    compute_device.SubmitQueue();
+    compute_device.WaitQueueIdle();
+}
 
-    const auto& layers = network.GetLayers();
-    uint32_t weights_per_neuron = network.GetInputCount();
+void ComputeTasks::Crossover(PopulationResourceHandle& population, std::span<const std::pair<uint32_t, uint32_t>> parents, std::optional<uint64_t> seed)
+{
+    const Network& network = *population.m_network;
+    IComputeDevice& compute_device = *population.m_compute_device;
 
-    for (size_t i = 0; i < layers.size(); ++i) {
-        auto& mutation_buffer = mutation_buffers.emplace_back();
-        const auto layer_neuron_count = layers[i].m_num_neurons;
+    if (parents.size() != population.m_population_size) {
+        throw std::runtime_error("Crossover requires a parent pair for every member of the population!");
+    }
 
-        for (uint32_t n = 0; n < layer_neuron_count; ++n) {
-            for (uint32_t w = 0; w < weights_per_neuron; ++w) {
-                mutation_buffer.emplace_back(weight_mutator(0));
-            }
-            mutation_buffer.emplace_back(bias_mutator(0));
+    std::vector<uint32_t> parent_ids;
+    parent_ids.reserve(parents.size() * 2);
+    for (const auto& [parent_a, parent_b] : parents) {
+        if (parent_a >= population.m_population_size || parent_b >= population.m_population_size) {
+            throw std::runtime_error("Invalid parent id!");
         }
+        parent_ids.emplace_back(parent_a);
+        parent_ids.emplace_back(parent_b);
+    }
 
-        weights_per_neuron = layer_neuron_count;
+    compute_device.QueueWriteToBuffer(population.m_parent_ids_buffer.get(), ToReadOnlyUi8Span(parent_ids), 0);
 
-        compute_device.QueueWriteToBuffer(network_handle.m_mutation_buffers[i].get(), ToReadOnlyUi8Span(mutation_buffer), 0);
-    }
+    const uint64_t crossover_seed = seed ? *seed : ((uint64_t(std::random_device{}()) << 32) | std::random_device{}());
 
+    const auto& layers = network.GetLayers();
+
+    // Every neuron of a child is inherited from one of its parents, the children are written into a separate buffer so the parents stay intact during the dispatch
     for (uint32_t i = 0; i < layers.size(); ++i) {
         const uint32_t input_num = i == 0 ? network.GetInputCount() : layers[i - 1].m_num_neurons;
         const uint32_t output_num = layers[i].m_num_neurons;
 
-        compute_device.QueueApplyGradients(network_handle.m_tensor_buffers[i].get(), network_handle.m_mutation_buffers[i].get(), output_num, input_num, 1.0f, 0.0f,
-                                           -1.0f /*note: regularization_term_1 and 2 and learning rate are set to passtrough the modification*/);
+        compute_device.QueueCrossover(population.m_tensor_buffers[i].get(), population.m_next_generation_tensor_buffers[i].get(), population.m_parent_ids_buffer.get(), output_num,
+                                      input_num, population.m_population_size, crossover_seed, i);
     }
 
     compute_device.SubmitQueue();
     compute_device.WaitQueueIdle();
+
+    std::swap(population.m_tensor_buffers, population.m_next_generation_tensor_buffers);
 }
 
-} // namespace macademy
\ No newline at end of file
+} // namespace macademy
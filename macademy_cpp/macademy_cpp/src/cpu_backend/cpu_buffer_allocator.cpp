@@ -0,0 +1,141 @@
+#include "cpu_backend/cpu_buffer_allocator.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace macademy {
+
+CPUBufferAllocator::CPUBufferAllocator(bool use_huge_pages, size_t max_cached_bytes) : m_use_huge_pages(use_huge_pages), m_max_cached_bytes(max_cached_bytes) {}
+
+CPUBufferAllocator::~CPUBufferAllocator() { ReleaseCachedMemory(); }
+
+size_t CPUBufferAllocator::GetSizeClass(size_t size)
+{
+    if (size == 0) {
+        return 0;
+    }
+
+    if (size <= 4096) {
+        return std::max(ALIGNMENT, std::bit_ceil(size));
+    }
+
+    const size_t step = std::bit_floor(size - 1) / 4;
+    return (size + step - 1) / step * step;
+}
+
+uint8_t* CPUBufferAllocator::Allocate(size_t size, size_t& capacity)
+{
+    capacity = GetSizeClass(size);
+    if (capacity == 0) {
+        return nullptr;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        ++m_statistics.m_allocation_count;
+        m_statistics.m_bytes_in_use += capacity;
+        m_statistics.m_peak_bytes_in_use = std::max(m_statistics.m_peak_bytes_in_use, m_statistics.m_bytes_in_use);
+
+        auto it = m_free_blocks.find(capacity);
+        if (it != m_free_blocks.end() && !it->second.empty()) {
+            uint8_t* block = it->second.back();
+            it->second.pop_back();
+            ++m_statistics.m_pool_hit_count;
+            m_statistics.m_bytes_cached -= capacity;
+            return block;
+        }
+
+        ++m_statistics.m_system_allocation_count;
+    }
+
+    uint8_t* block = AllocateFromSystem(capacity);
+    if (!block) {
+        std::lock_guard lock(m_mutex);
+        m_statistics.m_bytes_in_use -= capacity;
+        throw std::bad_alloc();
+    }
+
+    return block;
+}
+
+void CPUBufferAllocator::Free(uint8_t* block, size_t capacity)
+{
+    if (!block) {
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        m_statistics.m_bytes_in_use -= capacity;
+
+        if (m_statistics.m_bytes_cached + capacity <= m_max_cached_bytes) {
+            m_free_blocks[capacity].emplace_back(block);
+            m_statistics.m_bytes_cached += capacity;
+            return;
+        }
+    }
+
+    FreeToSystem(block);
+}
+
+void CPUBufferAllocator::ReleaseCachedMemory()
+{
+    std::map<size_t, std::vector<uint8_t*>> free_blocks;
+    {
+        std::lock_guard lock(m_mutex);
+        std::swap(free_blocks, m_free_blocks);
+        m_statistics.m_bytes_cached = 0;
+    }
+
+    for (const auto& [capacity, blocks] : free_blocks) {
+        for (uint8_t* block : blocks) {
+            FreeToSystem(block);
+        }
+    }
+}
+
+CPUAllocationStatistics CPUBufferAllocator::GetStatistics() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_statistics;
+}
+
+uint8_t* CPUBufferAllocator::AllocateFromSystem(size_t capacity)
+{
+    const bool use_huge_pages = m_use_huge_pages && capacity >= HUGE_PAGE_MIN_SIZE;
+    const size_t alignment = use_huge_pages ? HUGE_PAGE_SIZE : ALIGNMENT;
+
+    // The capacity is always a multiple of the alignment, as aligned_alloc requires
+#ifdef _WIN32
+    void* block = _aligned_malloc(capacity, alignment);
+#else
+    void* block = std::aligned_alloc(alignment, capacity);
+#endif
+
+#ifdef __linux__
+    if (block && use_huge_pages) {
+        madvise(block, capacity, MADV_HUGEPAGE); // only a hint, the block is usable either way
+    }
+#endif
+
+    return static_cast<uint8_t*>(block);
+}
+
+void CPUBufferAllocator::FreeToSystem(uint8_t* block)
+{
+#ifdef _WIN32
+    _aligned_free(block);
+#else
+    std::free(block);
+#endif
+}
+
+} // namespace macademy
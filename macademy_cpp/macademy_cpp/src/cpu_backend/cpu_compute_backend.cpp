@@ -1,4 +1,5 @@
 #include "cpu_backend/cpu_compute_backend.h"
+#include "cpu_backend/cpu_simd_math.h"
 #include "network.h"
 #include "common.h"
 #include "utils.h"
@@ -6,57 +7,121 @@
 #include "hwinfo/hwinfo.h"
 #include <execution>
 #include <algorithm>
+#include <array>
+#include <numeric>
 
 namespace macademy {
 namespace {
 
-inline float CalculateActivationFunction(ActivationFunction func, float x)
+// The transcendental functions use the same approximations as the vectorized ApplyActivationFunction
+template <ActivationFunction Func> inline float CalculateActivationFunction(float x)
 {
-    switch (func) {
-    case ActivationFunction::Sigmoid:
-        return 1.0f / (1.0f + expf(-x));
-    case ActivationFunction::ReLU:
+    if constexpr (Func == ActivationFunction::Sigmoid) {
+        return simd::Sigmoid(simd::ScalarFloat(x)).m_value;
+    } else if constexpr (Func == ActivationFunction::ReLU) {
         return x < 0.0f ? 0.0f : x;
-    case ActivationFunction::Tanh:
-        return 2.0f / (1.0f + expf(-2.0f * x)) - 1.0f;
-    case ActivationFunction::Identity:
+    } else if constexpr (Func == ActivationFunction::Tanh) {
+        return simd::Tanh(simd::ScalarFloat(x)).m_value;
+    } else if constexpr (Func == ActivationFunction::Identity) {
         return x;
-    case ActivationFunction::Threshold:
+    } else if constexpr (Func == ActivationFunction::Threshold) {
         return x < 0 ? 0 : 1;
-    case ActivationFunction::LeakyReLU:
+    } else if constexpr (Func == ActivationFunction::LeakyReLU) {
         return x < 0.0f ? (0.01f * x) : x;
-    case ActivationFunction::SoftPlus:
-        return logf(1 + exp(x));
-    case ActivationFunction::ArcTan:
-        return atanf(x);
+    } else if constexpr (Func == ActivationFunction::SoftPlus) {
+        return simd::SoftPlus(simd::ScalarFloat(x)).m_value;
+    } else if constexpr (Func == ActivationFunction::ArcTan) {
+        return simd::ArcTan(simd::ScalarFloat(x)).m_value;
+    } else if constexpr (Func == ActivationFunction::Softmax) {
+        return x; // the outputs depend on the whole row, see ApplyActivationFunction
+    } else {
+        static_assert(Func == ActivationFunction::Sigmoid, "Unhandled activation function!");
     }
+}
 
-    throw std::runtime_error("Invalid activation function!");
+// Derivative of the activation function at z, where a is the already calculated activation of z.
+// z is only used if ActivationFunctionUsesZValues(Func), the other derivatives are calculated from a.
+template <ActivationFunction Func> inline float CalculateActivationFunctionPrime(float z, float a)
+{
+    if constexpr (Func == ActivationFunction::Sigmoid) {
+        return a * (1.0f - a);
+    } else if constexpr (Func == ActivationFunction::ReLU) {
+        return a > 0.0f ? 1.0f : 0.0f;
+    } else if constexpr (Func == ActivationFunction::Tanh) {
+        return 1.0f - a * a;
+    } else if constexpr (Func == ActivationFunction::Identity) {
+        return 1.0f;
+    } else if constexpr (Func == ActivationFunction::Threshold) {
+        return 0.0f;
+    } else if constexpr (Func == ActivationFunction::LeakyReLU) {
+        return a < 0.0f ? 0.01f : 1.0f;
+    } else if constexpr (Func == ActivationFunction::SoftPlus) {
+        return CalculateActivationFunction<ActivationFunction::Sigmoid>(z);
+    } else if constexpr (Func == ActivationFunction::ArcTan) {
+        return 1.0f / (z * z + 1);
+    } else if constexpr (Func == ActivationFunction::Softmax) {
+        return a * (1.0f - a); // diagonal of the Jacobian, the full Jacobian is used by CalculateSoftmaxDelta
+    } else {
+        static_assert(Func == ActivationFunction::Sigmoid, "Unhandled activation function!");
+    }
 }
 
-inline float CalculateActivationFunctionPrime(ActivationFunction func, float x)
+// Replaces the z values of a layer with their activations, values must be a single row of the layer when Func is Softmax.
+// The transcendental functions are evaluated with the widest available vector instructions.
+template <ActivationFunction Func> inline void ApplyActivationFunction(std::span<float> values)
 {
-    switch (func) {
-    case ActivationFunction::Sigmoid: {
-        const float sigm = CalculateActivationFunction(ActivationFunction::Sigmoid, x);
-        return sigm * (1.0f - sigm);
+    if constexpr (Func == ActivationFunction::Softmax) {
+        // Subtracting the maximum doesn't change the result, but avoids the overflow of exp
+        const simd::FloatVec max_value(*std::max_element(values.begin(), values.end()));
+        simd::Transform(values, [&](simd::FloatVec x) { return simd::Exp(x - max_value); });
+
+        float sum = 0.0f;
+        for (float f : values) {
+            sum += f;
+        }
+
+        const float scale = 1.0f / sum;
+        for (float& f : values) {
+            f *= scale;
+        }
+    } else if constexpr (Func == ActivationFunction::Sigmoid) {
+        simd::Transform(values, [](simd::FloatVec x) { return simd::Sigmoid(x); });
+    } else if constexpr (Func == ActivationFunction::Tanh) {
+        simd::Transform(values, [](simd::FloatVec x) { return simd::Tanh(x); });
+    } else if constexpr (Func == ActivationFunction::SoftPlus) {
+        simd::Transform(values, [](simd::FloatVec x) { return simd::SoftPlus(x); });
+    } else if constexpr (Func == ActivationFunction::ArcTan) {
+        simd::Transform(values, [](simd::FloatVec x) { return simd::ArcTan(x); });
+    } else {
+        for (float& f : values) {
+            f = CalculateActivationFunction<Func>(f);
+        }
     }
+}
+
+// Calls the kernel with the activation function as a std::integral_constant, so the kernel is instantiated for every activation function,
+// and the activation function can be inlined into its inner loops
+template <typename Kernel> void DispatchActivationFunction(ActivationFunction func, Kernel&& kernel)
+{
+    switch (func) {
+    case ActivationFunction::Sigmoid:
+        return kernel(std::integral_constant<ActivationFunction, ActivationFunction::Sigmoid>{});
     case ActivationFunction::ReLU:
-        return x < 0.0f ? 0.0f : 1.0f;
-    case ActivationFunction::Tanh: {
-        const float sigm = CalculateActivationFunction(ActivationFunction::Tanh, x);
-        return 1.0f - sigm * sigm;
-    }
+        return kernel(std::integral_constant<ActivationFunction, ActivationFunction::ReLU>{});
+    case ActivationFunction::Tanh:
+        return kernel(std::integral_constant<ActivationFunction, ActivationFunction::Tanh>{});
     case ActivationFunction::Identity:
-        return 1.0f;
+        return kernel(std::integral_constant<ActivationFunction, ActivationFunction::Identity>{});
     case ActivationFunction::Threshold:
-        return 0.0f;
+        return kernel(std::integral_constant<ActivationFunction, ActivationFunction::Threshold>{});
     case ActivationFunction::LeakyReLU:
-        return x < 0.0f ? 0.01f : 1.0f;
+        return kernel(std::integral_constant<ActivationFunction, ActivationFunction::LeakyReLU>{});
     case ActivationFunction::SoftPlus:
-        return 1.0f / (1.0f + expf(-x));
+        return kernel(std::integral_constant<ActivationFunction, ActivationFunction::SoftPlus>{});
     case ActivationFunction::ArcTan:
-        return 1.0f / (x * x + 1);
+        return kernel(std::integral_constant<ActivationFunction, ActivationFunction::ArcTan>{});
+    case ActivationFunction::Softmax:
+        return kernel(std::integral_constant<ActivationFunction, ActivationFunction::Softmax>{});
     }
 
     throw std::runtime_error("Invalid activation function!");
@@ -72,33 +137,296 @@ inline float CalculateCostFunctionError(CostFunction cost_fnc, float result, flo
     case CostFunction::CrossEntropy_Sigmoid: {
         return -desired_output * logf(result) - (1.0f - desired_output) * logf(1.0f - result);
     }
+    case CostFunction::CrossEntropy_Softmax: {
+        return -desired_output * logf(result);
+    }
     }
     throw std::runtime_error("Invalid cost function!");
 }
 
-inline float CalculateCostFunctionDelta(CostFunction cost_fnc, ActivationFunction activation_function, float z, float a, float desired_output)
+template <ActivationFunction Func> inline float CalculateCostFunctionDelta(CostFunction cost_fnc, float z, float a, float desired_output)
 {
     switch (cost_fnc) {
     case CostFunction::MeanSquared: {
-        return (a - desired_output) * CalculateActivationFunctionPrime(activation_function, z);
+        return (a - desired_output) * CalculateActivationFunctionPrime<Func>(z, a);
     }
-    case CostFunction::CrossEntropy_Sigmoid: {
+    case CostFunction::CrossEntropy_Sigmoid:
+    case CostFunction::CrossEntropy_Softmax: {
         return a - desired_output;
     }
     }
     throw std::runtime_error("Invalid cost function!");
 }
 
+// Delta of an output neuron of a softmax layer: every output of the row depends on every z value of the row.
+// With cross-entropy the Jacobian cancels out (a - y), the mean squared error is multiplied by the full Jacobian.
+inline float CalculateSoftmaxDelta(CostFunction cost_fnc, std::span<const float> activations, std::span<const float> desired_outputs, uint32_t neuron_id)
+{
+    switch (cost_fnc) {
+    case CostFunction::MeanSquared: {
+        float dot = 0.0f;
+        for (size_t i = 0; i < activations.size(); ++i) {
+            dot += (activations[i] - desired_outputs[i]) * activations[i];
+        }
+        const float a = activations[neuron_id];
+        return a * ((a - desired_outputs[neuron_id]) - dot);
+    }
+    case CostFunction::CrossEntropy_Sigmoid:
+    case CostFunction::CrossEntropy_Softmax: {
+        return activations[neuron_id] - desired_outputs[neuron_id];
+    }
+    }
+    throw std::runtime_error("Invalid cost function!");
+}
+
+inline float ApplyOptimizerStep(const OptimizerParameters& params, float weight, float gradient, float* moment1, float* moment2, bool is_bias)
+{
+    float g = gradient * params.m_gradient_scale;
+    if (!is_bias) {
+        g += params.m_l2_gradient_term * weight + params.m_l1_gradient_term * sign(weight);
+    }
+
+    float step = g;
+    switch (params.m_optimizer) {
+    case Optimizer::SGD:
+        break;
+    case Optimizer::Momentum:
+        *moment1 = params.m_beta1 * (*moment1) + g;
+        step = *moment1;
+        break;
+    case Optimizer::Nesterov:
+        *moment1 = params.m_beta1 * (*moment1) + g;
+        step = g + params.m_beta1 * (*moment1);
+        break;
+    case Optimizer::Adam:
+    case Optimizer::AdamW:
+        *moment1 = params.m_beta1 * (*moment1) + (1.0f - params.m_beta1) * g;
+        *moment2 = params.m_beta2 * (*moment2) + (1.0f - params.m_beta2) * g * g;
+        step = ((*moment1) * params.m_bias_correction_1) / (sqrtf((*moment2) * params.m_bias_correction_2) + params.m_epsilon);
+        break;
+    }
+
+    if (is_bias) {
+        return weight - step * params.m_learning_rate;
+    }
+
+    weight = params.m_regularization_term_1 * weight - step * params.m_learning_rate;
+    if (params.m_regularization_term_2 != 0.0f) {
+        weight -= params.m_regularization_term_2 * sign(weight);
+    }
+    return weight;
+}
+
+// Counter based random number generator (Philox4x32-10, Salmon et al.: Parallel Random Numbers: As Easy as 1, 2, 3).
+// Every element of a tensor uses its own counter, so the random values don't depend on the order the elements are processed in,
+// and the GPU backends generate the same values.
+inline std::array<uint32_t, 4> Philox4x32_10(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key)
+{
+    constexpr uint32_t philox_m0 = 0xD2511F53;
+    constexpr uint32_t philox_m1 = 0xCD9E8D57;
+    constexpr uint32_t philox_w0 = 0x9E3779B9;
+    constexpr uint32_t philox_w1 = 0xBB67AE85;
+
+    for (int round = 0; round < 10; ++round) {
+        const uint64_t product0 = uint64_t(philox_m0) * counter[0];
+        const uint64_t product1 = uint64_t(philox_m1) * counter[2];
+        counter = {uint32_t(product1 >> 32) ^ counter[1] ^ key[0], uint32_t(product1), uint32_t(product0 >> 32) ^ counter[3] ^ key[1], uint32_t(product0)};
+        key[0] += philox_w0;
+        key[1] += philox_w1;
+    }
+
+    return counter;
+}
+
+// The counter is keyed on the tensor and the element within it, so a population doesn't run out of 32 bit element ids
+inline float GenerateMutation(RandomDistribution distribution, float scale, uint64_t seed, uint32_t stream, uint32_t tensor_id, uint32_t element_id)
+{
+    const auto random = Philox4x32_10({element_id, stream, tensor_id, 0}, {uint32_t(seed), uint32_t(seed >> 32)});
+
+    switch (distribution) {
+    case RandomDistribution::Uniform: {
+        const float u = float(random[0] >> 8) * (1.0f / 16777216.0f); // [0, 1)
+        return (2.0f * u - 1.0f) * scale;
+    }
+    case RandomDistribution::Gaussian: {
+        // Box-Muller transform
+        const float u1 = float((random[0] >> 8) + 1) * (1.0f / 16777216.0f); // (0, 1]
+        const float u2 = float(random[1] >> 8) * (1.0f / 16777216.0f);       // [0, 1)
+        return sqrtf(-2.0f * logf(u1)) * cosf(6.28318530718f * u2) * scale;
+    }
+    }
+
+    throw std::runtime_error("Invalid random distribution!");
+}
+
+// Layers with less multiply-adds than this are evaluated on the calling thread, as handing out the work to the thread pool would take longer than the work itself
+constexpr size_t PARALLEL_EVALUATION_MIN_WORK = 1 << 16;
+
+// Calls func for every id in [0, count), in parallel if the estimated work (multiply-adds) is large enough to amortize the fan-out
+template <typename Func> void ParallelFor(uint32_t count, size_t work, Func&& func)
+{
+    if (count == 1 || work < PARALLEL_EVALUATION_MIN_WORK) {
+        for (uint32_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    thread_local std::vector<uint32_t> work_items;
+    work_items.resize(count);
+    std::iota(work_items.begin(), work_items.end(), 0u);
+    std::for_each(std::execution::par_unseq, work_items.begin(), work_items.end(), func);
+}
+
+constexpr uint32_t DENSE_NEURON_BLOCK = 4;
+
+// Independent accumulators kept in flight by the dot product kernels, so consecutive multiply-adds don't wait for the latency of each other
+constexpr uint32_t ACCUMULATOR_COUNT = 8;
+
+// Calculates the z values of NeuronCount consecutive neurons of the dense layout, every loaded input vector is used for all of the neurons.
+// The rows are zero padded to a multiple of the vector width, so the tail of the input is processed in a zero padded vector.
+template <uint32_t NeuronCount> void EvaluateDenseNeurons(const float* weights, uint32_t row_stride, const float* biases, const float* input, float* output, uint32_t weights_per_neuron)
+{
+    constexpr uint32_t chain_count = std::max(1u, ACCUMULATOR_COUNT / NeuronCount);
+    constexpr uint32_t width = uint32_t(simd::FloatVec::width);
+
+    simd::FloatVec acc[chain_count][NeuronCount];
+    for (uint32_t c = 0; c < chain_count; ++c) {
+        for (uint32_t n = 0; n < NeuronCount; ++n) {
+            acc[c][n] = simd::FloatVec(0.0f);
+        }
+    }
+
+    const auto accumulate = [&](uint32_t chain, uint32_t i, simd::FloatVec x) {
+        for (uint32_t n = 0; n < NeuronCount; ++n) {
+            acc[chain][n] = simd::MultiplyAdd(simd::FloatVec::Load(weights + size_t(n) * row_stride + i), x, acc[chain][n]);
+        }
+    };
+
+    uint32_t i = 0;
+    for (; i + chain_count * width <= weights_per_neuron; i += chain_count * width) {
+        for (uint32_t c = 0; c < chain_count; ++c) {
+            accumulate(c, i + c * width, simd::FloatVec::Load(input + i + c * width));
+        }
+    }
+    for (; i + width <= weights_per_neuron; i += width) {
+        accumulate(0, i, simd::FloatVec::Load(input + i));
+    }
+
+    if (i < weights_per_neuron) {
+        float tail[simd::FloatVec::width]{};
+        std::copy(input + i, input + weights_per_neuron, tail);
+        accumulate(0, i, simd::FloatVec::Load(tail));
+    }
+
+    for (uint32_t n = 0; n < NeuronCount; ++n) {
+        for (uint32_t c = 1; c < chain_count; ++c) {
+            acc[0][n] = acc[0][n] + acc[c][n];
+        }
+        output[n] = simd::HorizontalSum(acc[0][n]) + biases[n];
+    }
+}
+
+// Layout of the tensors prepared for inference: the neurons are split into panels of PANEL_WIDTH neurons (the last panel may be narrower), and a panel stores the
+// weights of its neurons interleaved input by input ([input][neuron of the panel]), followed by the biases of all neurons. The evaluation then loads the weights
+// of a whole panel for an input with a few vector loads, and reuses every loaded weight for a block of samples, instead of streaming one row per neuron.
+constexpr uint32_t PANEL_WIDTH = 16;
+constexpr uint32_t PANEL_SAMPLE_BLOCK = 4;
+static_assert(PANEL_WIDTH % simd::FloatVec::width == 0 && DENSE_ROW_ALIGNMENT % simd::FloatVec::width == 0);
+
+// Calculates the z values of a full panel for SampleCount samples, the accumulators stay in registers for the whole dot product.
+// With few samples the inputs are distributed between multiple chains of accumulators.
+template <uint32_t SampleCount>
+void EvaluatePanel(const float* panel_weights, const float* biases, const float* input, float* output, uint32_t weights_per_neuron, uint32_t input_stride, uint32_t output_stride)
+{
+    constexpr size_t vector_count = PANEL_WIDTH / simd::FloatVec::width;
+    constexpr uint32_t chain_count = std::max(size_t(1), ACCUMULATOR_COUNT / (SampleCount * vector_count));
+
+    simd::FloatVec acc[chain_count][SampleCount][vector_count];
+    for (uint32_t c = 0; c < chain_count; ++c) {
+        for (uint32_t s = 0; s < SampleCount; ++s) {
+            for (size_t v = 0; v < vector_count; ++v) {
+                acc[c][s][v] = simd::FloatVec(0.0f);
+            }
+        }
+    }
+
+    const auto accumulate = [&](uint32_t chain, uint32_t i) {
+        simd::FloatVec weights[vector_count];
+        for (size_t v = 0; v < vector_count; ++v) {
+            weights[v] = simd::FloatVec::Load(panel_weights + size_t(i) * PANEL_WIDTH + v * simd::FloatVec::width);
+        }
+
+        for (uint32_t s = 0; s < SampleCount; ++s) {
+            const simd::FloatVec x(input[size_t(s) * input_stride + i]);
+            for (size_t v = 0; v < vector_count; ++v) {
+                acc[chain][s][v] = simd::MultiplyAdd(x, weights[v], acc[chain][s][v]);
+            }
+        }
+    };
+
+    uint32_t i = 0;
+    for (; i + chain_count <= weights_per_neuron; i += chain_count) {
+        for (uint32_t c = 0; c < chain_count; ++c) {
+            accumulate(c, i + c);
+        }
+    }
+    for (; i < weights_per_neuron; ++i) {
+        accumulate(0, i);
+    }
+
+    for (uint32_t s = 0; s < SampleCount; ++s) {
+        for (size_t v = 0; v < vector_count; ++v) {
+            for (uint32_t c = 1; c < chain_count; ++c) {
+                acc[0][s][v] = acc[0][s][v] + acc[c][s][v];
+            }
+            (acc[0][s][v] + simd::FloatVec::Load(biases + v * simd::FloatVec::width)).Store(output + size_t(s) * output_stride + v * simd::FloatVec::width);
+        }
+    }
+}
+
+// The last panel of a layer with fewer neurons than the panel width
+void EvaluatePartialPanel(const float* panel_weights, const float* biases, const float* input, float* output, uint32_t weights_per_neuron, uint32_t panel_width, uint32_t sample_count,
+                          uint32_t input_stride, uint32_t output_stride)
+{
+    for (uint32_t s = 0; s < sample_count; ++s) {
+        for (uint32_t n = 0; n < panel_width; ++n) {
+            float acc = 0.0f;
+            for (uint32_t i = 0; i < weights_per_neuron; ++i) {
+                acc += panel_weights[size_t(i) * panel_width + n] * input[size_t(s) * input_stride + i];
+            }
+            output[size_t(s) * output_stride + n] = acc + biases[n];
+        }
+    }
+}
+
 } // namespace
 
+CPUComputeDevice::CPUComputeDevice(const nlohmann::json& device_config)
+    : m_allocator(std::make_shared<CPUBufferAllocator>(GetBoolFlagFromJson(device_config, "use_huge_pages", true),
+                                                       size_t(std::max(GetIntFromJson(device_config, "buffer_pool_size_mb", 1024), 0)) << 20))
+{
+}
+
 std::unique_ptr<IBuffer> CPUComputeDevice::CreateBuffer(size_t size, BufferUsage, const std::string& name)
 {
-    auto ret = std::make_unique<CPUBuffer>();
-    ret->m_data.resize(size);
+    auto ret = std::make_unique<CPUBuffer>(m_allocator, size);
 
     return ret;
 }
 
+std::unique_ptr<IBuffer> CPUComputeDevice::CreateBufferView(IBuffer* buffer, size_t offset, size_t size, const std::string&)
+{
+    CPUBuffer* cpu_buffer = BufferCast<CPUBuffer>(buffer);
+
+    ASSERT(offset % GetBufferViewAlignment() == 0 && cpu_buffer->m_data.size() >= offset + size);
+
+    return std::make_unique<CPUBuffer>(*cpu_buffer, offset, size);
+}
+
+// Views start on a cache line, like the rows of the dense layout
+size_t CPUComputeDevice::GetBufferViewAlignment() const { return DENSE_ROW_ALIGNMENT * sizeof(float); }
+
 void CPUComputeDevice::QueueWriteToBuffer(IBuffer* dst_buffer, std::span<const uint8_t> src, size_t buffer_offset)
 {
     CPUBuffer* cpu_buffer = BufferCast<CPUBuffer>(dst_buffer);
@@ -126,6 +454,18 @@ void CPUComputeDevice::QueueFillBuffer(IBuffer* buffer, uint32_t data, size_t of
     memset(cpu_buffer->m_data.data() + offset_bytes, data, size_bytes);
 }
 
+// The buffers are in host memory and the operations are not queued, so the data is accessed directly
+std::span<uint8_t> CPUComputeDevice::MapBuffer(IBuffer* buffer, BufferUsage, size_t offset_bytes, size_t size_bytes)
+{
+    CPUBuffer* cpu_buffer = BufferCast<CPUBuffer>(buffer);
+
+    ASSERT(cpu_buffer->m_data.size() >= offset_bytes + size_bytes);
+
+    return cpu_buffer->m_data.subspan(offset_bytes, size_bytes);
+}
+
+void CPUComputeDevice::UnmapBuffer(IBuffer*) {}
+
 void CPUComputeDevice::SubmitQueue()
 { /*CPU doesn't queue operations*/
 }
@@ -137,26 +477,126 @@ void CPUComputeDevice::WaitQueueIdle()
 void CPUComputeDevice::QueueEvaluateLayer(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
                                           uint32_t layer_input_count, uint32_t layer_neuron_count)
 {
-    const auto weights_f32 = BufferCast<const CPUBuffer>(tensor_buffer)->As<const float>();
+    QueueEvaluateLayerBatched(tensor_buffer, layer_input_buffer, layer_output_buffer, activation_function, layer_input_count, layer_neuron_count, 1, 0);
+}
+
+bool CPUComputeDevice::PrepareTensorForInference(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron)
+{
+    CPUBuffer* cpu_buffer = BufferCast<CPUBuffer>(tensor_buffer);
+    if (cpu_buffer->m_is_panel_packed) {
+        return true;
+    }
+
+    const DenseLayout layout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron};
+    ASSERT(cpu_buffer->m_data.size() >= layout.GetElementCount() * sizeof(float));
+
+    // The panel layout has no row padding, so it fits into the buffer of the dense layout
+    const std::vector<float> dense(cpu_buffer->As<const float>(), cpu_buffer->As<const float>() + layout.GetElementCount());
+    float* packed = cpu_buffer->As<float>();
+    std::fill_n(packed, layout.GetElementCount(), 0.0f);
+
+    for (uint32_t panel_begin = 0; panel_begin < layer_neuron_count; panel_begin += PANEL_WIDTH) {
+        const uint32_t panel_width = std::min(PANEL_WIDTH, layer_neuron_count - panel_begin);
+        float* panel = packed + size_t(panel_begin) * weights_per_neuron;
+        for (uint32_t i = 0; i < weights_per_neuron; ++i) {
+            for (uint32_t n = 0; n < panel_width; ++n) {
+                panel[size_t(i) * panel_width + n] = dense[layout.GetWeightIndex(panel_begin + n, i)];
+            }
+        }
+    }
+    std::copy_n(dense.begin() + layout.GetBiasOffset(), layer_neuron_count, packed + size_t(layer_neuron_count) * weights_per_neuron);
+
+    cpu_buffer->m_is_panel_packed = true;
+    return true;
+}
+
+void CPUComputeDevice::QueueEvaluateLayerBatched(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
+                                                 uint32_t layer_input_count, uint32_t layer_neuron_count, uint32_t batch_size, uint32_t weights_batch_stride)
+{
+    const auto tensor_cpu_buffer = BufferCast<const CPUBuffer>(tensor_buffer);
+    const auto weights_f32 = tensor_cpu_buffer->As<const float>();
     const auto layer_input = BufferCast<const CPUBuffer>(layer_input_buffer)->As<const float>();
     auto layer_output = BufferCast<CPUBuffer>(layer_output_buffer)->As<float>();
 
     const uint32_t weights_per_neuron = layer_input_count; // neurons in the prev layer
+    const DenseLayout layout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron};
+
+    // Multiply-adds of the layer, small layers are evaluated on the calling thread
+    const size_t work = size_t(layer_neuron_count) * weights_per_neuron * batch_size;
+
+    const auto calculate_packed_zvalues = [&]() {
+        ASSERTM(weights_batch_stride == 0, "Tensors prepared for inference can't be evaluated with a weights batch stride!");
 
-    std::for_each_n(std::execution::par_unseq, weights_f32, layer_neuron_count, [&](const float& f) {
-        const uint32_t neuron_id = &f - weights_f32;
+        const uint32_t panel_count = (layer_neuron_count + PANEL_WIDTH - 1) / PANEL_WIDTH;
+        const uint32_t sample_block_count = (batch_size + PANEL_SAMPLE_BLOCK - 1) / PANEL_SAMPLE_BLOCK;
+        const float* biases = weights_f32 + size_t(layer_neuron_count) * weights_per_neuron;
 
-        const uint32_t neuron_data_size = weights_per_neuron + 1; // weights in prev layer + 1 bias
+        ParallelFor(panel_count * sample_block_count, work, [&](uint32_t work_item) {
+            const uint32_t panel_begin = (work_item % panel_count) * PANEL_WIDTH;
+            const uint32_t panel_width = std::min(PANEL_WIDTH, layer_neuron_count - panel_begin);
+            const uint32_t sample_begin = (work_item / panel_count) * PANEL_SAMPLE_BLOCK;
+            const uint32_t sample_count = std::min(PANEL_SAMPLE_BLOCK, batch_size - sample_begin);
 
-        const float* neuron_weights_biases = weights_f32 + neuron_id * neuron_data_size;
+            const float* panel_weights = weights_f32 + size_t(panel_begin) * weights_per_neuron;
+            const float* input = layer_input + size_t(sample_begin) * layer_input_count;
+            float* output = layer_output + size_t(sample_begin) * layer_neuron_count + panel_begin;
 
-        float acc = 0;
-        for (int i = 0; i < weights_per_neuron; ++i) {
-            acc += neuron_weights_biases[i] * layer_input[i];
+            if (panel_width < PANEL_WIDTH) {
+                EvaluatePartialPanel(panel_weights, biases + panel_begin, input, output, weights_per_neuron, panel_width, sample_count, layer_input_count, layer_neuron_count);
+                return;
+            }
+
+            switch (sample_count) {
+            case 1:
+                return EvaluatePanel<1>(panel_weights, biases + panel_begin, input, output, weights_per_neuron, layer_input_count, layer_neuron_count);
+            case 2:
+                return EvaluatePanel<2>(panel_weights, biases + panel_begin, input, output, weights_per_neuron, layer_input_count, layer_neuron_count);
+            case 3:
+                return EvaluatePanel<3>(panel_weights, biases + panel_begin, input, output, weights_per_neuron, layer_input_count, layer_neuron_count);
+            default:
+                return EvaluatePanel<PANEL_SAMPLE_BLOCK>(panel_weights, biases + panel_begin, input, output, weights_per_neuron, layer_input_count, layer_neuron_count);
+            }
+        });
+    };
+
+    const auto calculate_dense_zvalues = [&]() {
+        const uint32_t neuron_block_count = (layer_neuron_count + DENSE_NEURON_BLOCK - 1) / DENSE_NEURON_BLOCK;
+
+        ParallelFor(neuron_block_count * batch_size, work, [&](uint32_t work_item) {
+            const uint32_t batch_id = work_item / neuron_block_count;
+            const uint32_t neuron_begin = (work_item % neuron_block_count) * DENSE_NEURON_BLOCK;
+
+            const float* batch_weights = weights_f32 + size_t(batch_id) * weights_batch_stride;
+            const float* neuron_weights = batch_weights + layout.GetWeightIndex(neuron_begin, 0);
+            const float* biases = batch_weights + layout.GetBiasIndex(neuron_begin);
+            const float* input = layer_input + size_t(batch_id) * layer_input_count;
+            float* output = layer_output + size_t(batch_id) * layer_neuron_count + neuron_begin;
+            const uint32_t row_stride = layout.GetRowStride();
+
+            switch (std::min(DENSE_NEURON_BLOCK, layer_neuron_count - neuron_begin)) {
+            case 1:
+                return EvaluateDenseNeurons<1>(neuron_weights, row_stride, biases, input, output, weights_per_neuron);
+            case 2:
+                return EvaluateDenseNeurons<2>(neuron_weights, row_stride, biases, input, output, weights_per_neuron);
+            case 3:
+                return EvaluateDenseNeurons<3>(neuron_weights, row_stride, biases, input, output, weights_per_neuron);
+            default:
+                return EvaluateDenseNeurons<DENSE_NEURON_BLOCK>(neuron_weights, row_stride, biases, input, output, weights_per_neuron);
+            }
+        });
+    };
+
+    DispatchActivationFunction(activation_function, [&](auto activation_function_constant) {
+        if (tensor_cpu_buffer->m_is_panel_packed) {
+            calculate_packed_zvalues();
+        } else {
+            calculate_dense_zvalues();
         }
-        acc += neuron_weights_biases[weights_per_neuron]; // bias
 
-        layer_output[neuron_id] = CalculateActivationFunction(activation_function, acc);
+        // The activation function is applied on whole rows, so it can be vectorized
+        ParallelFor(batch_size, size_t(layer_neuron_count) * batch_size, [&](uint32_t batch_id) {
+            ApplyActivationFunction<decltype(activation_function_constant)::value>(std::span<float>(layer_output + size_t(batch_id) * layer_neuron_count, layer_neuron_count));
+        });
     });
 }
 
@@ -189,40 +629,48 @@ void CPUComputeDevice::QueueTrainForwardPass(const IBuffer* tensor_buffer, const
 {
     const auto weights_f32 = BufferCast<const CPUBuffer>(tensor_buffer)->As<const float>();
     auto activations_f32 = BufferCast<CPUBuffer>(activations)->As<float>();
-    auto zvalues_f32 = BufferCast<CPUBuffer>(zvalues)->As<float>();
+    auto zvalues_f32 = ActivationFunctionUsesZValues(activation_function) ? BufferCast<CPUBuffer>(zvalues)->As<float>() : nullptr;
     auto prev_activations_base = BufferCast<const CPUBuffer>(prev_activations_buffer)->As<const float>(); // layer_input
     const uint32_t& prev_layer_neuron_count = weights_per_neuron;
 
-    const uint32_t neuron_data_size = weights_per_neuron + 1; // weights in prev layer + 1 bias
+    const DenseLayout layout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron};
     auto prev_activations = prev_activations_base;
 
-    // TODOZ parallel for
-    for (size_t g_id = 0; g_id < layer_neuron_count * num_training_samples; ++g_id) {
-        const uint32_t layer_neuron_id = g_id % layer_neuron_count;
-        const uint32_t trainingSampleId = g_id / layer_neuron_count;
+    DispatchActivationFunction(activation_function, [&](auto activation_function_constant) {
+        // TODOZ parallel for
+        for (size_t g_id = 0; g_id < layer_neuron_count * num_training_samples; ++g_id) {
+            const uint32_t layer_neuron_id = g_id % layer_neuron_count;
+            const uint32_t trainingSampleId = g_id / layer_neuron_count;
 
-        const uint32_t prev_layer_offset = prev_layer_neuron_count * trainingSampleId;
-        const uint32_t layer_offset = layer_neuron_count * trainingSampleId;
-        const float* neuron_weights_biases = weights_f32 + layer_neuron_id * neuron_data_size;
+            const uint32_t prev_layer_offset = prev_layer_neuron_count * trainingSampleId;
+            const uint32_t layer_offset = layer_neuron_count * trainingSampleId;
+            const float* neuron_weights = weights_f32 + layout.GetWeightIndex(layer_neuron_id, 0);
 
-        prev_activations = prev_activations_base + prev_layer_offset;
+            prev_activations = prev_activations_base + prev_layer_offset;
 
-        // Calculate ZValues for layer
-        float acc = 0;
-        for (uint32_t i = 0; i < weights_per_neuron; ++i) {
-            acc += neuron_weights_biases[i] * prev_activations[i];
+            // Calculate ZValues for layer
+            float acc = 0;
+            for (uint32_t i = 0; i < weights_per_neuron; ++i) {
+                acc += neuron_weights[i] * prev_activations[i];
+            }
+            acc += weights_f32[layout.GetBiasIndex(layer_neuron_id)];
+
+            // The activation function is applied afterwards on the whole layer
+            activations_f32[layer_offset + layer_neuron_id] = acc;
         }
-        acc += neuron_weights_biases[weights_per_neuron]; // bias
 
-        // Store ZValues and the result of the activation function
-        zvalues_f32[layer_offset + layer_neuron_id] = acc;
-        activations_f32[layer_offset + layer_neuron_id] = CalculateActivationFunction(activation_function, acc);
-    }
+        if constexpr (ActivationFunctionUsesZValues(decltype(activation_function_constant)::value)) {
+            std::copy_n(activations_f32, size_t(layer_neuron_count) * num_training_samples, zvalues_f32);
+        }
+
+        for (uint32_t sample_id = 0; sample_id < num_training_samples; ++sample_id) {
+            ApplyActivationFunction<decltype(activation_function_constant)::value>(std::span<float>(activations_f32 + size_t(sample_id) * layer_neuron_count, layer_neuron_count));
+        }
+    });
 }
 
-void CPUComputeDevice::QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* prev_activations_buffer, const IBuffer* layer_activations_buffer,
-                                              const IBuffer* layer_zvalues_buffer, IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read,
-                                              IBuffer* current_layer_gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, ActivationFunction activation_function,
+void CPUComputeDevice::QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* layer_activations_buffer, const IBuffer* layer_zvalues_buffer,
+                                              IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, uint32_t layer_neuron_count, ActivationFunction activation_function,
                                               uint32_t num_training_samples, CostFunction costFunction, uint32_t next_layer_neuron_count)
 {
     // Next layer: the subsequent layer of the network towards the output of the whole network
@@ -230,85 +678,185 @@ void CPUComputeDevice::QueueTrainBackwardPass(bool is_output_layer, const IBuffe
 
     // TODOZ split this into two functions, one for hidden layers and one for the output layer. Or maybe do the full separation
     const auto next_layer_data = BufferCast<const CPUBuffer>(next_layer_data_buffer)->As<const float>();
-    auto prev_activations_base = BufferCast<const CPUBuffer>(prev_activations_buffer)->As<const float>();
     auto layer_activations = BufferCast<const CPUBuffer>(layer_activations_buffer)->As<const float>();
-    auto layer_zvalues = BufferCast<const CPUBuffer>(layer_zvalues_buffer)->As<const float>();
+    auto layer_zvalues = ActivationFunctionUsesZValues(activation_function) ? BufferCast<const CPUBuffer>(layer_zvalues_buffer)->As<const float>() : nullptr;
     auto delta_k_vector_read = BufferCast<const CPUBuffer>(delta_k_vector_buffer_read)->As<float>();
     auto delta_k_vector_write = BufferCast<CPUBuffer>(delta_k_vector_buffer_write)->As<float>();
-    auto current_layer_gradient = BufferCast<CPUBuffer>(current_layer_gradient_buffer)->As<float>();
-    const uint32_t& prev_layer_neuron_count = weights_per_neuron;
 
-    auto prev_activations = prev_activations_base;
+    const DenseLayout next_layer_layout{.m_num_neurons = next_layer_neuron_count, .m_weights_per_neuron = layer_neuron_count};
 
-    for (size_t g_id = 0; g_id < layer_neuron_count * num_training_samples; ++g_id) {
+    DispatchActivationFunction(activation_function, [&](auto activation_function_constant) {
+        for (size_t g_id = 0; g_id < layer_neuron_count * num_training_samples; ++g_id) {
 
-        const uint32_t layer_neuron_id = g_id % layer_neuron_count;
-        const uint32_t trainingSampleId = g_id / layer_neuron_count;
+            const uint32_t layer_neuron_id = g_id % layer_neuron_count;
+            const uint32_t trainingSampleId = g_id / layer_neuron_count;
 
-        const uint32_t prev_layer_offset = prev_layer_neuron_count * trainingSampleId;
-        const uint32_t layer_offset = layer_neuron_count * trainingSampleId;
-        const uint32_t next_layer_offset = next_layer_neuron_count * trainingSampleId;
-        const uint32_t delta_k_read_offset = next_layer_offset;
-        const uint32_t delta_k_write_offset = layer_offset;
+            const uint32_t layer_offset = layer_neuron_count * trainingSampleId;
+            const uint32_t next_layer_offset = next_layer_neuron_count * trainingSampleId;
+            const uint32_t delta_k_read_offset = next_layer_offset;
+            const uint32_t delta_k_write_offset = layer_offset;
 
-        prev_activations = prev_activations_base + prev_layer_offset;
+            const float zValue = ActivationFunctionUsesZValues(decltype(activation_function_constant)::value) ? layer_zvalues[layer_neuron_id + layer_offset] : 0.0f;
+            const float activation = layer_activations[layer_neuron_id + layer_offset];
 
-        const float zValue = layer_zvalues[layer_neuron_id + layer_offset];
+            float delta_k;
+
+            if (is_output_layer) {
+                // Output layer
+                const float desiredOutput = next_layer_data[layer_neuron_id + layer_offset];
+                if constexpr (decltype(activation_function_constant)::value == ActivationFunction::Softmax) {
+                    delta_k = CalculateSoftmaxDelta(costFunction, std::span<const float>(layer_activations + layer_offset, layer_neuron_count),
+                                                    std::span<const float>(next_layer_data + layer_offset, layer_neuron_count), layer_neuron_id);
+                } else {
+                    delta_k = CalculateCostFunctionDelta<decltype(activation_function_constant)::value>(costFunction, zValue, activation, desiredOutput);
+                }
+            } else {
+                // Hidden layer
+                delta_k = 0;
+                for (uint32_t i = 0; i < next_layer_neuron_count; ++i) {
+                    delta_k += delta_k_vector_read[delta_k_read_offset + i] * next_layer_data[next_layer_layout.GetWeightIndex(i, layer_neuron_id)];
+                }
+                delta_k *= CalculateActivationFunctionPrime<decltype(activation_function_constant)::value>(zValue, activation);
+            }
 
-        float delta_k;
+            // TODOZ: if this is the input layer of the network, this write is unnecessary, as it won't be used. This write can be omitted
+            delta_k_vector_write[delta_k_write_offset + layer_neuron_id] = delta_k;
+        }
+    });
+}
 
-        if (is_output_layer) {
-            // Output layer
-            const float activation = layer_activations[layer_neuron_id + layer_offset];
-            const float desiredOutput = next_layer_data[layer_neuron_id + layer_offset];
-            delta_k = CalculateCostFunctionDelta(costFunction, activation_function, zValue, activation, desiredOutput);
-        } else {
-            // Hidden layer
-            delta_k = 0;
-            const uint32_t next_layer_neuron_data_size = layer_neuron_count + 1; // weights + bias
-            for (uint32_t i = 0; i < next_layer_neuron_count; ++i) {
-                delta_k += delta_k_vector_read[delta_k_read_offset + i] * next_layer_data[layer_neuron_id + i * next_layer_neuron_data_size];
+void CPUComputeDevice::QueueTrainCalculateGradient(const IBuffer* delta_k_vector_buffer, const IBuffer* prev_activations_buffer, IBuffer* current_layer_gradient_buffer, uint32_t layer_neuron_count,
+                                                   uint32_t weights_per_neuron, uint32_t num_training_samples)
+{
+    const auto delta_k_vector = BufferCast<const CPUBuffer>(delta_k_vector_buffer)->As<const float>();
+    const auto prev_activations = BufferCast<const CPUBuffer>(prev_activations_buffer)->As<const float>();
+    auto current_layer_gradient = BufferCast<CPUBuffer>(current_layer_gradient_buffer)->As<float>();
+
+    const DenseLayout layout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron};
+
+    // Every neuron's gradient row is owned by a single task that accumulates the samples in order, so the result does not depend on the scheduling
+    const auto calculate_neuron_gradient = [&](float& f) {
+        const uint32_t layer_neuron_id = &f - current_layer_gradient;
+
+        float* neuron_gradient = current_layer_gradient + layout.GetWeightIndex(layer_neuron_id, 0);
+        float& bias_gradient = current_layer_gradient[layout.GetBiasIndex(layer_neuron_id)];
+
+        for (uint32_t sample_id = 0; sample_id < num_training_samples; ++sample_id) {
+            const float delta_k = delta_k_vector[sample_id * layer_neuron_count + layer_neuron_id];
+            const float* sample_prev_activations = prev_activations + sample_id * weights_per_neuron;
+
+            for (uint32_t i = 0; i < weights_per_neuron; ++i) {
+                neuron_gradient[i] += delta_k * sample_prev_activations[i];
             }
-            delta_k *= CalculateActivationFunctionPrime(activation_function, zValue);
+            bias_gradient += delta_k;
         }
+    };
+
+    // Small layers are not worth the overhead of scheduling parallel tasks
+    constexpr size_t min_parallel_work_size = 1 << 14;
+    if (size_t(layer_neuron_count) * (weights_per_neuron + 1) * num_training_samples < min_parallel_work_size) {
+        std::for_each_n(current_layer_gradient, layer_neuron_count, calculate_neuron_gradient);
+    } else {
+        std::for_each_n(std::execution::par_unseq, current_layer_gradient, layer_neuron_count, calculate_neuron_gradient);
+    }
+}
 
-        const uint32_t gradientBaseOffset = layer_neuron_id * (weights_per_neuron + 1);
+void CPUComputeDevice::QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, IBuffer* moment1_buffer, IBuffer* moment2_buffer, uint32_t layer_neuron_count,
+                                           uint32_t weights_per_neuron, const OptimizerParameters& optimizer_parameters)
+{
+    auto weights_f32 = BufferCast<CPUBuffer>(tensor_buffer)->As<float>();
+    const auto gradient = BufferCast<const CPUBuffer>(gradient_buffer)->As<const float>();
+    auto moment1 = moment1_buffer ? BufferCast<CPUBuffer>(moment1_buffer)->As<float>() : nullptr;
+    auto moment2 = moment2_buffer ? BufferCast<CPUBuffer>(moment2_buffer)->As<float>() : nullptr;
 
-        for (uint32_t i = 0; i < weights_per_neuron; ++i) {
-            float& v = *(current_layer_gradient + gradientBaseOffset + i);
-            v += delta_k * prev_activations[i];
-        }
-        float& v = *(current_layer_gradient + gradientBaseOffset + weights_per_neuron);
-        v += delta_k; // bias
+    ASSERT(optimizer_parameters.m_optimizer == Optimizer::SGD || moment1);
+    ASSERT((optimizer_parameters.m_optimizer != Optimizer::Adam && optimizer_parameters.m_optimizer != Optimizer::AdamW) || moment2);
 
-        // TODOZ: if this is the input layer of the network, this write is unnecessary, as it won't be used. This write can be omitted
-        delta_k_vector_write[delta_k_write_offset + layer_neuron_id] = delta_k;
+    const DenseLayout layout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron};
+    const size_t element_count = layout.GetElementCount();
+
+    // The parameters are independent of each other, every element is updated with its own optimizer state.
+    // The padding has zero weights and gradients, so it stays zero.
+    const auto apply_optimizer_step = [&](float& f) {
+        const uint32_t element_id = uint32_t(&f - weights_f32);
+        const bool is_bias = layout.IsBias(element_id);
+
+        f = ApplyOptimizerStep(optimizer_parameters, f, gradient[element_id], moment1 ? moment1 + element_id : nullptr, moment2 ? moment2 + element_id : nullptr, is_bias);
+    };
+
+    constexpr size_t min_parallel_work_size = 1 << 14;
+    if (element_count < min_parallel_work_size) {
+        std::for_each_n(weights_f32, element_count, apply_optimizer_step);
+    } else {
+        std::for_each_n(std::execution::par_unseq, weights_f32, element_count, apply_optimizer_step);
     }
 }
 
-void CPUComputeDevice::QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, float regularization_term_1,
-                                           float regularization_term_2, float normalized_learning_rate)
+void CPUComputeDevice::QueueApplyMutation(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t tensor_count,
+                                          const MutationParameters& mutation_parameters)
 {
     auto weights_f32 = BufferCast<CPUBuffer>(tensor_buffer)->As<float>();
-    const auto gradient = BufferCast<const CPUBuffer>(gradient_buffer)->As<const float>();
 
-    const bool applyRegularizationTerm2 = regularization_term_2 != 0.0f;
+    const DenseLayout layout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron};
+    const size_t tensor_stride = layout.GetTensorStride();
+    const size_t element_count = tensor_count == 0 ? 0 : tensor_stride * (tensor_count - 1) + layout.GetElementCount();
 
-    const auto neuron_data_size = weights_per_neuron + 1;
+    const auto apply_mutation = [&](float& f) {
+        const size_t element_id = &f - weights_f32;
+        const uint32_t tensor_id = uint32_t(element_id / tensor_stride);
+        const uint32_t tensor_element_id = uint32_t(element_id % tensor_stride);
+        if (tensor_element_id >= layout.GetElementCount() || layout.IsPadding(tensor_element_id)) {
+            return;
+        }
 
-    // TODO: async
-    size_t g_id = 0;
-    for (size_t i = 0; i < layer_neuron_count; ++i) {
-        auto neuron_weight_bias_data = weights_f32 + i * neuron_data_size;
-        for (size_t j = 0; j < weights_per_neuron; ++j) {
-            auto weight_data = neuron_weight_bias_data + j;
-            const auto g = gradient[g_id++];
-            *weight_data = regularization_term_1 * (*weight_data) - g * normalized_learning_rate;
-            if (applyRegularizationTerm2) {
-                *weight_data -= regularization_term_2 * sign(*weight_data);
-            }
+        if (layout.IsBias(tensor_element_id)) {
+            f += GenerateMutation(mutation_parameters.m_bias_distribution, mutation_parameters.m_bias_scale, mutation_parameters.m_seed, mutation_parameters.m_stream, tensor_id,
+                                  tensor_element_id);
+        } else {
+            f += GenerateMutation(mutation_parameters.m_weight_distribution, mutation_parameters.m_weight_scale, mutation_parameters.m_seed, mutation_parameters.m_stream, tensor_id,
+                                  tensor_element_id);
         }
-        *(neuron_weight_bias_data + weights_per_neuron) -= gradient[g_id++] * normalized_learning_rate; // bias
+    };
+
+    constexpr size_t min_parallel_work_size = 1 << 14;
+    if (element_count < min_parallel_work_size) {
+        std::for_each_n(weights_f32, element_count, apply_mutation);
+    } else {
+        std::for_each_n(std::execution::par_unseq, weights_f32, element_count, apply_mutation);
+    }
+}
+
+void CPUComputeDevice::QueueCrossover(const IBuffer* parents_tensor_buffer, IBuffer* children_tensor_buffer, const IBuffer* parent_ids_buffer, uint32_t layer_neuron_count,
+                                      uint32_t weights_per_neuron, uint32_t children_count, uint64_t seed, uint32_t stream)
+{
+    const auto parents = BufferCast<const CPUBuffer>(parents_tensor_buffer)->As<const float>();
+    auto children = BufferCast<CPUBuffer>(children_tensor_buffer)->As<float>();
+    const auto parent_ids = BufferCast<const CPUBuffer>(parent_ids_buffer)->As<const uint32_t>();
+
+    const DenseLayout layout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron};
+    const size_t tensor_stride = layout.GetTensorStride();
+    const size_t row_count = size_t(layer_neuron_count) * children_count;
+
+    // Every neuron of a child inherits its weights and bias from one of its two parents, chosen by a random bit
+    const auto inherit_neuron = [&](float& f) {
+        const size_t row_id = &f - children;
+        const uint32_t child_id = uint32_t(row_id / layer_neuron_count);
+        const uint32_t neuron_id = uint32_t(row_id % layer_neuron_count);
+
+        const auto random = Philox4x32_10({neuron_id, stream, child_id, 0}, {uint32_t(seed), uint32_t(seed >> 32)});
+        const uint32_t parent_id = parent_ids[child_id * 2 + (random[0] & 1)];
+
+        const float* parent = parents + parent_id * tensor_stride;
+        float* child = children + child_id * tensor_stride;
+        std::copy_n(parent + layout.GetWeightIndex(neuron_id, 0), layout.GetRowStride(), child + layout.GetWeightIndex(neuron_id, 0));
+        child[layout.GetBiasIndex(neuron_id)] = parent[layout.GetBiasIndex(neuron_id)];
+    };
+
+    constexpr size_t min_parallel_work_size = 1 << 14;
+    if (row_count * layout.GetRowStride() < min_parallel_work_size) {
+        std::for_each_n(children, row_count, inherit_neuron);
+    } else {
+        std::for_each_n(std::execution::par_unseq, children, row_count, inherit_neuron);
     }
 }
 
@@ -0,0 +1,97 @@
+#include "device_cache.h"
+#include "common.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <random>
+
+namespace macademy {
+
+std::optional<std::filesystem::path> GetCacheDirectory(const nlohmann::json& device_config)
+{
+    std::filesystem::path ret;
+
+    if (device_config.contains("cache_directory")) {
+        ret = GetStringFromJson(device_config, "cache_directory", "");
+        if (ret.empty()) {
+            return {};
+        }
+    } else if (const char* env_cache_dir = std::getenv("MACADEMY_CACHE_DIR"); env_cache_dir && *env_cache_dir) {
+        ret = env_cache_dir;
+    } else {
+        std::error_code ec;
+        ret = std::filesystem::temp_directory_path(ec);
+        if (ec) {
+            return {};
+        }
+        ret /= "macademy_cache";
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(ret, ec);
+    if (ec) {
+        return {};
+    }
+
+    return ret;
+}
+
+std::string GetCacheFileName(const std::string& device_key)
+{
+    std::string ret;
+    for (char c : device_key) {
+        ret += std::isalnum(static_cast<unsigned char>(c)) || c == '.' || c == '-' ? c : '_';
+    }
+
+    // The name is shortened and a hash is appended, to keep it unique and within the file name limits
+    if (ret.size() > 64) {
+        ret.resize(64);
+    }
+    ret += "_" + std::to_string(std::hash<std::string>{}(device_key));
+    return ret;
+}
+
+std::optional<std::vector<uint8_t>> ReadCacheFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        return {};
+    }
+
+    std::vector<uint8_t> ret((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad()) {
+        return {};
+    }
+
+    return ret;
+}
+
+bool WriteCacheFile(const std::filesystem::path& path, std::span<const uint8_t> data)
+{
+    auto temp_path = path;
+    temp_path += ".tmp" + std::to_string(std::random_device{}());
+
+    {
+        std::ofstream file(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(data.data()), std::streamsize(data.size()));
+        if (!file.good()) {
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace macademy
@@ -0,0 +1,184 @@
+#include "inference_server.h"
+#include "network.h"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace macademy {
+
+InferenceServer::InferenceServer(const NetworkResourceHandle& network_resources, const InferenceServerConfig& config) : m_network_resources(network_resources), m_config(config)
+{
+    if (m_config.m_max_batch_size == 0 || m_config.m_worker_count == 0) {
+        throw std::runtime_error("Invalid inference server config!");
+    }
+
+    m_batch_size_histogram.resize(size_t(m_config.m_max_batch_size) + 1);
+    m_latencies.reserve(m_config.m_latency_sample_count);
+
+    for (uint32_t i = 0; i < m_config.m_worker_count; ++i) {
+        m_workers.emplace_back(&InferenceServer::WorkerThread, this);
+    }
+}
+
+InferenceServer::~InferenceServer()
+{
+    {
+        std::scoped_lock lock(m_queue_mutex);
+        m_stop = true;
+    }
+    m_queue_condition.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+std::future<std::vector<float>> InferenceServer::Submit(std::span<const float> input)
+{
+    if (input.size() != m_network_resources.m_network->GetInputCount()) {
+        throw std::runtime_error("Invalid input length!");
+    }
+
+    Request request;
+    request.m_input.assign(input.begin(), input.end());
+    request.m_submit_time = std::chrono::steady_clock::now();
+    auto ret = request.m_promise.get_future();
+
+    bool batch_full = false;
+    {
+        std::scoped_lock lock(m_queue_mutex);
+        if (m_stop) {
+            throw std::runtime_error("Inference server is stopped!");
+        }
+        m_queue.emplace_back(std::move(request));
+        batch_full = m_queue.size() >= m_config.m_max_batch_size;
+    }
+
+    // A worker is waiting for either the first request of a batch, or for the batch to fill up
+    if (batch_full) {
+        m_queue_condition.notify_all();
+    } else {
+        m_queue_condition.notify_one();
+    }
+
+    return ret;
+}
+
+void InferenceServer::WorkerThread()
+{
+    std::vector<Request> batch;
+    batch.reserve(m_config.m_max_batch_size);
+
+    while (true) {
+        {
+            std::unique_lock lock(m_queue_mutex);
+            m_queue_condition.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+
+            if (m_queue.empty()) {
+                return; // stopped, and every request is served
+            }
+
+            // Wait for the batch to fill up, but never longer than the deadline of the oldest request
+            const auto deadline = m_queue.front().m_submit_time + m_config.m_max_wait_time;
+            m_queue_condition.wait_until(lock, deadline, [this]() { return m_stop || m_queue.size() >= m_config.m_max_batch_size; });
+
+            // Another worker could have taken the requests in the meantime
+            const size_t batch_size = std::min(m_queue.size(), size_t(m_config.m_max_batch_size));
+            for (size_t i = 0; i < batch_size; ++i) {
+                batch.emplace_back(std::move(m_queue.front()));
+                m_queue.pop_front();
+            }
+        }
+
+        if (!batch.empty()) {
+            EvaluateBatch(batch);
+            batch.clear();
+        }
+    }
+}
+
+void InferenceServer::EvaluateBatch(std::vector<Request>& batch)
+{
+    const uint32_t input_count = m_network_resources.m_network->GetInputCount();
+    const uint32_t output_count = m_network_resources.m_network->GetOutputCount();
+    const uint32_t batch_size = uint32_t(batch.size());
+
+    thread_local std::vector<float> inputs;
+    inputs.resize(size_t(batch_size) * input_count);
+    for (uint32_t i = 0; i < batch_size; ++i) {
+        std::copy(batch[i].m_input.begin(), batch[i].m_input.end(), inputs.begin() + size_t(i) * input_count);
+    }
+
+    std::vector<float> results;
+    std::exception_ptr error;
+    try {
+        results = m_compute_tasks.EvaluateBatch(m_network_resources, inputs, batch_size);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    // The statistics are updated before the results are returned, so they already contain the requests that the clients received
+    {
+        const auto now = std::chrono::steady_clock::now();
+
+        std::scoped_lock lock(m_statistics_mutex);
+        m_request_count += batch_size;
+        ++m_batch_count;
+        ++m_batch_size_histogram[batch_size];
+        for (const auto& request : batch) {
+            const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - request.m_submit_time);
+            if (m_latencies.size() < m_config.m_latency_sample_count) {
+                m_latencies.emplace_back(latency);
+            } else if (!m_latencies.empty()) {
+                m_latencies[m_latency_write_index] = latency;
+                m_latency_write_index = (m_latency_write_index + 1) % m_latencies.size();
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < batch_size; ++i) {
+        if (error) {
+            batch[i].m_promise.set_exception(error);
+        } else {
+            batch[i].m_promise.set_value(std::vector<float>(results.begin() + size_t(i) * output_count, results.begin() + size_t(i + 1) * output_count));
+        }
+    }
+}
+
+InferenceServerStatistics InferenceServer::GetStatistics() const
+{
+    InferenceServerStatistics ret;
+    std::vector<std::chrono::microseconds> latencies;
+
+    {
+        std::scoped_lock lock(m_statistics_mutex);
+        ret.m_request_count = m_request_count;
+        ret.m_batch_count = m_batch_count;
+        ret.m_batch_size_histogram = m_batch_size_histogram;
+        latencies = m_latencies;
+    }
+
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        const auto percentile = [&latencies](double p) { return latencies[std::min(latencies.size() - 1, size_t(p * latencies.size()))]; };
+        ret.m_latency_p50 = percentile(0.5);
+        ret.m_latency_p90 = percentile(0.9);
+        ret.m_latency_p99 = percentile(0.99);
+        ret.m_latency_max = latencies.back();
+    }
+
+    return ret;
+}
+
+void InferenceServer::ResetStatistics()
+{
+    std::scoped_lock lock(m_statistics_mutex);
+    m_request_count = 0;
+    m_batch_count = 0;
+    std::fill(m_batch_size_histogram.begin(), m_batch_size_histogram.end(), 0);
+    m_latencies.clear();
+    m_latency_write_index = 0;
+}
+
+} // namespace macademy
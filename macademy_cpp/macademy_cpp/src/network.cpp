@@ -10,20 +10,57 @@ const uint32_t Network::BINARY_VERSION = 0x00020000;
 
 std::unique_ptr<Tensor> GenerateWeights(DType dtype, const IWeightInitializer& initializer, uint32_t num_neurons, uint32_t weights_per_neuron)
 {
-    std::vector<float> data;
+    const DenseLayout layout{.m_num_neurons = num_neurons, .m_weights_per_neuron = weights_per_neuron};
 
-    data.reserve(num_neurons * (weights_per_neuron + 1 /*bias*/));
+    // The weights are generated into the tensor, the padding stays zero
+    auto ret = std::make_unique<Tensor>(dtype, layout);
+    auto data = ret->AsFloat32();
 
-    for (size_t i = 0; i < num_neurons; i++) {
-        for (size_t j = 0; j < weights_per_neuron; j++) {
-            data.push_back(initializer.GetRandomWeight(weights_per_neuron));
+    for (uint32_t i = 0; i < num_neurons; i++) {
+        for (uint32_t j = 0; j < weights_per_neuron; j++) {
+            data[layout.GetWeightIndex(i, j)] = initializer.GetRandomWeight(weights_per_neuron);
         }
-        data.push_back(initializer.GetRandomBias());
+        data[layout.GetBiasIndex(i)] = initializer.GetRandomBias();
     }
 
-    std::array<uint32_t, 1> shape{uint32_t(data.size())};
+    return ret;
+}
+
+std::vector<float> GetPackedWeights(const Tensor& tensor)
+{
+    const auto& layout = tensor.GetLayout();
+    const auto data = tensor.AsFloat32();
+
+    std::vector<float> ret;
+    ret.reserve(size_t(layout.m_num_neurons) * (layout.m_weights_per_neuron + 1));
+
+    for (uint32_t i = 0; i < layout.m_num_neurons; ++i) {
+        const auto row = data.begin() + layout.GetWeightIndex(i, 0);
+        ret.insert(ret.end(), row, row + layout.m_weights_per_neuron);
+        ret.push_back(data[layout.GetBiasIndex(i)]);
+    }
+
+    return ret;
+}
+
+std::unique_ptr<Tensor> CreateTensorFromPackedWeights(DType dtype, std::span<const float> packed_weights, uint32_t num_neurons, uint32_t weights_per_neuron)
+{
+    if (packed_weights.size() != size_t(num_neurons) * (weights_per_neuron + 1)) {
+        throw std::runtime_error("CreateTensorFromPackedWeights: invalid weight count!");
+    }
+
+    const DenseLayout layout{.m_num_neurons = num_neurons, .m_weights_per_neuron = weights_per_neuron};
+
+    auto ret = std::make_unique<Tensor>(dtype, layout); // the padding is zero, so it doesn't contribute to the weighted sums
+    auto data = ret->AsFloat32();
+
+    for (uint32_t i = 0; i < num_neurons; ++i) {
+        const auto row = packed_weights.begin() + size_t(i) * (weights_per_neuron + 1);
+        std::copy_n(row, weights_per_neuron, data.begin() + layout.GetWeightIndex(i, 0));
+        data[layout.GetBiasIndex(i)] = row[weights_per_neuron];
+    }
 
-    return std::make_unique<Tensor>(dtype, ToReadOnlyUi8Span(data), shape);
+    return ret;
 }
 
 std::unique_ptr<Network> BuildSequentialNetwork(const std::string& name, uint32_t input_count, std::span<const LayerConfig> layer_config, const IWeightInitializer& weight_initializer)
@@ -33,6 +70,7 @@ std::unique_ptr<Network> BuildSequentialNetwork(const std::string& name, uint32_
     }
 
     std::vector<macademy::Layer> layers;
+    layers.reserve(layer_config.size());
     uint32_t prev_layer_neuron_count = input_count;
     for (const auto& cfg : layer_config) {
         const auto activation_fnc = cfg.m_activation_function;
@@ -42,7 +80,14 @@ std::unique_ptr<Network> BuildSequentialNetwork(const std::string& name, uint32_
         prev_layer_neuron_count = cfg.m_num_neurons;
     }
 
-    return std::make_unique<macademy::Network>(name, input_count, layers);
+    return std::make_unique<macademy::Network>(name, input_count, std::move(layers));
+}
+
+Network::Network(const std::string& name, uint32_t input_count, std::vector<Layer>&& layers) : m_name(name), m_layers(std::move(layers)), m_input_arg_count(input_count)
+{
+    if (m_layers.empty()) {
+        throw std::runtime_error("Error! Cannot create empty network!");
+    }
 }
 
 Network::Network(const std::string& name, uint32_t input_count, std::span<const Layer> layer_list) : m_name(name), m_input_arg_count(input_count)
@@ -4,11 +4,16 @@
 #include "common.h"
 #include "utils.h"
 #include "training_suite.h"
+#include "workgroup_tuner.h"
+#include "device_cache.h"
 
 #include <fstream>
 #include <sstream>
 
 namespace {
+// Side length of the square work groups of the trainingCalculateGradient kernel, passed to the program as TRAINING_CALC_GRADIENT_TILE_SIZE
+constexpr size_t training_calc_gradient_tile_size = 16;
+
 size_t ExtendGlobalWorkSize(size_t desiredGlobalSize, size_t localSize)
 {
     return ((desiredGlobalSize % localSize) == 0) ? desiredGlobalSize : (desiredGlobalSize + (localSize - (desiredGlobalSize % localSize)));
@@ -28,6 +33,20 @@ cl_mem_flags ToOpenCLBufferUsage(macademy::BufferUsage usage)
     throw std::runtime_error("invalid buffer usage!");
 }
 
+cl_map_flags ToOpenCLMapFlags(macademy::BufferUsage access)
+{
+    switch (access) {
+    case macademy::BufferUsage::ReadOnly:
+        return CL_MAP_READ;
+    case macademy::BufferUsage::ReadWrite:
+        return CL_MAP_READ | CL_MAP_WRITE;
+    case macademy::BufferUsage::WriteOnly:
+        return CL_MAP_WRITE_INVALIDATE_REGION;
+    }
+
+    throw std::runtime_error("invalid buffer usage!");
+}
+
 } // namespace
 
 namespace macademy {
@@ -58,12 +77,12 @@ OpenCLComputeDevice::OpenCLComputeDevice(const ComputeDeviceInfo& device_info, c
     auto extensions = m_device.getInfo<CL_DEVICE_EXTENSIONS>() + " ";
 
     m_is_float16_supported = extensions.find("cl_khr_fp16 ") != std::string::npos;
-
-    std::vector<std::string> programStrings{opencl_kernel_source};
-    m_program = cl::Program(m_context, programStrings);
+    m_is_host_unified_memory = m_device.getInfo<CL_DEVICE_HOST_UNIFIED_MEMORY>() == CL_TRUE;
 
     std::string args = ""; //"-cl-std=CL1.1";
 
+    args += " -DTRAINING_CALC_GRADIENT_TILE_SIZE=" + std::to_string(training_calc_gradient_tile_size);
+
 #if CHECKED
     args += " -Werror";
 #endif
@@ -84,28 +103,120 @@ OpenCLComputeDevice::OpenCLComputeDevice(const ComputeDeviceInfo& device_info, c
         args += " -cl-unsafe-math-optimizations";
     }
 
-    m_program.build(args.c_str());
+    m_build_args = args;
+    m_cache_directory = GetCacheDirectory(device_config);
 
-    m_kernel_calc_single_layer = std::make_unique<KernelEval>(KernelEval(m_program, "evaluateLayer"));
-    m_kernel_calc_single_layer_ideal_workgroup_size = m_kernel_calc_single_layer->getKernel().getWorkGroupInfo<CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE>(m_device, nullptr);
+    m_program = BuildProgram(m_build_args);
 
-    m_kernel_calc_single_layer_ideal_workgroup_size = GetIntFromJson(device_config, "eval_threadgroup_size", m_kernel_calc_single_layer_ideal_workgroup_size);
-    m_kernel_training_ideal_workgroup_size_x = GetIntFromJson(device_config, "training_threadgroup_size_x", m_kernel_training_ideal_workgroup_size_x);
-    m_kernel_training_ideal_workgroup_size_y = GetIntFromJson(device_config, "training_threadgroup_size_x", m_kernel_training_ideal_workgroup_size_y);
-    m_kernel_training_apply_gradient_ideal_workgroup_size = GetIntFromJson(device_config, "gradient_apply_threadgroup_size", m_kernel_training_apply_gradient_ideal_workgroup_size);
-
-    m_kernel_train_forward_pass = std::make_unique<KernelTrainingForwardPass>(KernelTrainingForwardPass(m_program, "trainingForwardPass"));
-    m_kernel_train_backward_pass = std::make_unique<KernelTrainingBackwardPass>(KernelTrainingBackwardPass(m_program, "trainingBackwardPass"));
+    m_kernel_train_calc_gradient = std::make_unique<KernelTrainingCalculateGradient>(KernelTrainingCalculateGradient(m_program, "trainingCalculateGradient"));
     m_kernel_train_apply_gradient = std::make_unique<KernelTrainingApplyGradient>(KernelTrainingApplyGradient(m_program, "trainingApplyGradient"));
+    m_kernel_apply_mutation = std::make_unique<KernelApplyMutation>(KernelApplyMutation(m_program, "applyMutation"));
+    m_kernel_crossover = std::make_unique<KernelCrossover>(KernelCrossover(m_program, "crossover"));
+    m_kernel_softmax = std::make_unique<KernelSoftmax>(KernelSoftmax(m_program, "softmax"));
+
+    // Sigmoid is the most common activation function, its kernels are used to query the work group limits
+    const auto& activation_kernels = GetActivationKernels(ActivationFunction::Sigmoid);
+
+    WorkgroupSizes default_sizes{};
+    default_sizes.m_eval = uint32_t(activation_kernels.m_kernel_calc_single_layer->getKernel().getWorkGroupInfo<CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE>(m_device, nullptr));
+
+    // The tuned sizes must fit every kernel that uses them
+    WorkgroupSizeLimits limits{};
+    const auto max_work_item_sizes = m_device.getInfo<CL_DEVICE_MAX_WORK_ITEM_SIZES>();
+    limits.m_max_size_x = uint32_t(max_work_item_sizes[0]);
+    limits.m_max_size_y = uint32_t(max_work_item_sizes[1]);
+    limits.m_max_invocations = uint32_t(m_device.getInfo<CL_DEVICE_MAX_WORK_GROUP_SIZE>());
+    for (const cl::Kernel& kernel : {activation_kernels.m_kernel_calc_single_layer->getKernel(), activation_kernels.m_kernel_train_forward_pass->getKernel(),
+                                     activation_kernels.m_kernel_train_backward_pass->getKernel(), m_kernel_train_apply_gradient->getKernel(), m_kernel_apply_mutation->getKernel(),
+                                     m_kernel_crossover->getKernel(), m_kernel_softmax->getKernel()}) {
+        limits.m_max_invocations = std::min(limits.m_max_invocations, uint32_t(kernel.getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(m_device, nullptr)));
+    }
+
+    // The tuned sizes are only valid for the kernels they were measured with, so the kernel source and the build options are part of the key
+    const std::string device_key = m_device.getInfo<CL_DEVICE_NAME>() + "|" + m_device.getInfo<CL_DRIVER_VERSION>() + "|" +
+                                   std::to_string(std::hash<std::string>{}(std::string(opencl_kernel_source) + "|" + m_build_args));
+    LoadOrTuneWorkgroupSizes(*this, device_config, device_key, default_sizes, limits, [this](const WorkgroupSizes& sizes) {
+        m_kernel_calc_single_layer_ideal_workgroup_size = sizes.m_eval;
+        m_kernel_training_ideal_workgroup_size_x = sizes.m_training_x;
+        m_kernel_training_ideal_workgroup_size_y = sizes.m_training_y;
+        m_kernel_training_apply_gradient_ideal_workgroup_size = sizes.m_apply_gradient;
+    });
+}
+
+cl::Program OpenCLComputeDevice::BuildProgram(const std::string& build_args)
+{
+    // The compiled binary depends on the device, the driver, the kernel source and the build options
+    const std::string program_key = m_device.getInfo<CL_DEVICE_NAME>() + "|" + m_device.getInfo<CL_DRIVER_VERSION>() + "|" +
+                                    std::to_string(std::hash<std::string>{}(std::string(opencl_kernel_source) + "|" + build_args));
+
+    std::optional<std::filesystem::path> cache_path;
+    if (m_cache_directory) {
+        cache_path = *m_cache_directory / (GetCacheFileName(program_key) + ".clbin");
+    }
+
+    if (cache_path) {
+        if (auto binary = ReadCacheFile(*cache_path)) {
+            try {
+                std::vector<cl_int> binary_status;
+                cl::Program program(m_context, {m_device}, cl::Program::Binaries{*binary}, &binary_status);
+                program.build(build_args.c_str());
+                return program;
+            } catch (const cl::Error&) {
+                // the cached binary is corrupted or rejected by the driver, build the program from source instead
+            }
+        }
+    }
+
+    std::vector<std::string> programStrings{opencl_kernel_source};
+    cl::Program program(m_context, programStrings);
+    program.build(build_args.c_str());
+
+    if (cache_path) {
+        const auto binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+        if (binaries.size() == 1 && !binaries[0].empty()) {
+            WriteCacheFile(*cache_path, binaries[0]);
+        }
+    }
+
+    return program;
+}
+
+OpenCLComputeDevice::ActivationKernels& OpenCLComputeDevice::GetActivationKernels(ActivationFunction activation_function)
+{
+    auto& ret = m_activation_kernels[activation_function];
+
+    if (!ret) {
+        ret = std::make_unique<ActivationKernels>();
+        ret->m_program = BuildProgram(m_build_args + " -DACTIVATION_FUNCTION=" + std::to_string(uint32_t(activation_function)));
+        ret->m_kernel_calc_single_layer = std::make_unique<KernelEval>(KernelEval(ret->m_program, "evaluateLayer"));
+        ret->m_kernel_train_forward_pass = std::make_unique<KernelTrainingForwardPass>(KernelTrainingForwardPass(ret->m_program, "trainingForwardPass"));
+        ret->m_kernel_train_backward_pass = std::make_unique<KernelTrainingBackwardPass>(KernelTrainingBackwardPass(ret->m_program, "trainingBackwardPass"));
+    }
+
+    return *ret;
 }
 
 std::unique_ptr<IBuffer> OpenCLComputeDevice::CreateBuffer(size_t size, BufferUsage buffer_usage, const std::string& name)
 {
-    auto ret = std::make_unique<OpenCLBuffer>(m_context, ToOpenCLBufferUsage(buffer_usage), size, nullptr);
+    // On discrete devices host memory would be read over the bus by the kernels, so it is only used when the device shares the memory of the host
+    const cl_mem_flags host_ptr_flags = m_is_host_unified_memory ? CL_MEM_ALLOC_HOST_PTR : 0;
+    auto ret = std::make_unique<OpenCLBuffer>(m_context, ToOpenCLBufferUsage(buffer_usage) | host_ptr_flags, size, nullptr);
 
     return ret;
 }
 
+std::unique_ptr<IBuffer> OpenCLComputeDevice::CreateBufferView(IBuffer* buffer, size_t offset, size_t size, const std::string& name)
+{
+    auto cl_buffer = BufferCast<OpenCLBuffer>(buffer);
+
+    ASSERT(offset % GetBufferViewAlignment() == 0 && cl_buffer->GetSize() >= offset + size);
+
+    return std::make_unique<OpenCLBuffer>(*cl_buffer, offset, size);
+}
+
+// The origin of a sub-buffer must be aligned to CL_DEVICE_MEM_BASE_ADDR_ALIGN, which is given in bits
+size_t OpenCLComputeDevice::GetBufferViewAlignment() const { return size_t(m_device.getInfo<CL_DEVICE_MEM_BASE_ADDR_ALIGN>()) / 8; }
+
 void OpenCLComputeDevice::QueueWriteToBuffer(IBuffer* dst_buffer, std::span<const uint8_t> src, size_t buffer_offset)
 {
     auto cl_buffer = BufferCast<OpenCLBuffer>(dst_buffer);
@@ -127,21 +238,48 @@ void OpenCLComputeDevice::QueueFillBuffer(IBuffer* buffer, uint32_t data, size_t
     m_command_queue.enqueueFillBuffer(cl_buffer->GetBuffer(), cl_uint(data), cl::size_type(offset_bytes), cl::size_type(size_bytes));
 }
 
+std::span<uint8_t> OpenCLComputeDevice::MapBuffer(IBuffer* buffer, BufferUsage access, size_t offset_bytes, size_t size_bytes)
+{
+    auto cl_buffer = BufferCast<OpenCLBuffer>(buffer);
+
+    // The map is blocking, so the commands queued before it are finished
+    return cl_buffer->Map(m_command_queue, ToOpenCLMapFlags(access), offset_bytes, size_bytes);
+}
+
+void OpenCLComputeDevice::UnmapBuffer(IBuffer* buffer)
+{
+    auto cl_buffer = BufferCast<OpenCLBuffer>(buffer);
+
+    cl_buffer->Unmap(m_command_queue);
+}
+
 void OpenCLComputeDevice::SubmitQueue() { m_command_queue.flush(); }
 
 void OpenCLComputeDevice::WaitQueueIdle() { m_command_queue.finish(); }
 
 void OpenCLComputeDevice::QueueEvaluateLayer(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
                                              uint32_t layer_input_count, uint32_t layer_neuron_count)
+{
+    QueueEvaluateLayerBatched(tensor_buffer, layer_input_buffer, layer_output_buffer, activation_function, layer_input_count, layer_neuron_count, 1, 0);
+}
+
+void OpenCLComputeDevice::QueueEvaluateLayerBatched(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
+                                                    uint32_t layer_input_count, uint32_t layer_neuron_count, uint32_t batch_size, uint32_t weights_batch_stride)
 {
     const auto weights_buffer_cl = BufferCast<const OpenCLBuffer>(tensor_buffer);
     const auto layer_input_buffer_cl = BufferCast<const OpenCLBuffer>(layer_input_buffer);
     auto layer_output_buffer_cl = BufferCast<OpenCLBuffer>(layer_output_buffer);
 
-    (*m_kernel_calc_single_layer)(cl::EnqueueArgs(m_command_queue, cl::NDRange(ExtendGlobalWorkSize(layer_neuron_count, m_kernel_calc_single_layer_ideal_workgroup_size)),
-                                                  cl::NDRange(m_kernel_calc_single_layer_ideal_workgroup_size, 1)),
-                                  weights_buffer_cl->GetBuffer(), layer_input_buffer_cl->GetBuffer(), layer_output_buffer_cl->GetBuffer(), layer_input_count, layer_neuron_count,
-                                  cl_uint(activation_function));
+    std::scoped_lock lock(m_kernel_mutex);
+    auto& kernel = *GetActivationKernels(activation_function).m_kernel_calc_single_layer;
+    kernel(cl::EnqueueArgs(m_command_queue, cl::NDRange(ExtendGlobalWorkSize(layer_neuron_count, m_kernel_calc_single_layer_ideal_workgroup_size), batch_size),
+                           cl::NDRange(m_kernel_calc_single_layer_ideal_workgroup_size, 1)),
+           weights_buffer_cl->GetBuffer(), layer_input_buffer_cl->GetBuffer(), layer_output_buffer_cl->GetBuffer(), layer_input_count, layer_neuron_count, cl_uint(activation_function), batch_size,
+           weights_batch_stride);
+
+    if (activation_function == ActivationFunction::Softmax) {
+        QueueSoftmax(layer_output_buffer_cl, layer_neuron_count, batch_size);
+    }
 }
 
 void OpenCLComputeDevice::QueueTrainForwardPass(const IBuffer* tensor_buffer, const IBuffer* prev_activations, IBuffer* activations, IBuffer* zvalues, ActivationFunction activation_function,
@@ -150,49 +288,121 @@ void OpenCLComputeDevice::QueueTrainForwardPass(const IBuffer* tensor_buffer, co
     const auto weights_buffer_cl = BufferCast<const OpenCLBuffer>(tensor_buffer);
     const auto prev_activations_cl = BufferCast<const OpenCLBuffer>(prev_activations);
     auto activations_cl = BufferCast<OpenCLBuffer>(activations);
-    auto zvalues_cl = BufferCast<OpenCLBuffer>(zvalues);
+    // The kernel doesn't touch the z values if the activation function doesn't use them, the activations are bound in their place
+    auto zvalues_cl = ActivationFunctionUsesZValues(activation_function) ? BufferCast<OpenCLBuffer>(zvalues) : activations_cl;
+
+    std::scoped_lock lock(m_kernel_mutex);
+    auto& kernel = *GetActivationKernels(activation_function).m_kernel_train_forward_pass;
+    kernel(cl::EnqueueArgs(m_command_queue,
+                           cl::NDRange(ExtendGlobalWorkSize(layer_neuron_count, m_kernel_training_ideal_workgroup_size_x),
+                                       ExtendGlobalWorkSize(num_training_samples, m_kernel_training_ideal_workgroup_size_y)),
+                           cl::NDRange(m_kernel_training_ideal_workgroup_size_x, m_kernel_training_ideal_workgroup_size_y)),
+           weights_buffer_cl->GetBuffer(), prev_activations_cl->GetBuffer(), activations_cl->GetBuffer(), zvalues_cl->GetBuffer(), cl_uint(activation_function), cl_uint(layer_neuron_count),
+           cl_uint(weights_per_neuron), cl_uint(num_training_samples));
+
+    if (activation_function == ActivationFunction::Softmax) {
+        QueueSoftmax(activations_cl, layer_neuron_count, num_training_samples);
+    }
+}
 
-    (*m_kernel_train_forward_pass)(cl::EnqueueArgs(m_command_queue,
-                                                   cl::NDRange(ExtendGlobalWorkSize(layer_neuron_count, m_kernel_training_ideal_workgroup_size_x),
-                                                               ExtendGlobalWorkSize(num_training_samples, m_kernel_training_ideal_workgroup_size_y)),
-                                                   cl::NDRange(m_kernel_training_ideal_workgroup_size_x, m_kernel_training_ideal_workgroup_size_y)),
-                                   weights_buffer_cl->GetBuffer(), prev_activations_cl->GetBuffer(), activations_cl->GetBuffer(), zvalues_cl->GetBuffer(), cl_uint(activation_function),
-                                   cl_uint(layer_neuron_count), cl_uint(weights_per_neuron), cl_uint(num_training_samples));
+void OpenCLComputeDevice::QueueSoftmax(OpenCLBuffer* buffer, uint32_t row_length, uint32_t row_count)
+{
+    (*m_kernel_softmax)(cl::EnqueueArgs(m_command_queue, cl::NDRange(ExtendGlobalWorkSize(row_count, m_kernel_training_apply_gradient_ideal_workgroup_size)),
+                                        cl::NDRange(m_kernel_training_apply_gradient_ideal_workgroup_size)),
+                        buffer->GetBuffer(), cl_uint(row_length), cl_uint(row_count));
 }
 
-void OpenCLComputeDevice::QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* prev_activations_buffer, const IBuffer* layer_activations_buffer,
-                                                 const IBuffer* layer_zvalues_buffer, IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read,
-                                                 IBuffer* current_layer_gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, ActivationFunction activation_function,
+void OpenCLComputeDevice::QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* layer_activations_buffer, const IBuffer* layer_zvalues_buffer,
+                                                 IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, uint32_t layer_neuron_count, ActivationFunction activation_function,
                                                  uint32_t num_training_samples, CostFunction costFunction, uint32_t next_layer_neuron_count)
 {
     const auto next_layer_data_buffer_cl = BufferCast<const OpenCLBuffer>(next_layer_data_buffer);
-    const auto prev_activations_buffer_cl = BufferCast<const OpenCLBuffer>(prev_activations_buffer);
     const auto layer_activations_buffer_cl = BufferCast<const OpenCLBuffer>(layer_activations_buffer);
-    const auto layer_zvalues_buffer_cl = BufferCast<const OpenCLBuffer>(layer_zvalues_buffer);
+    const auto layer_zvalues_buffer_cl = ActivationFunctionUsesZValues(activation_function) ? BufferCast<const OpenCLBuffer>(layer_zvalues_buffer) : layer_activations_buffer_cl;
     auto delta_k_vector_buffer_write_cl = BufferCast<OpenCLBuffer>(delta_k_vector_buffer_write);
     const auto delta_k_vector_buffer_read_cl = BufferCast<const OpenCLBuffer>(delta_k_vector_buffer_read);
+
+    std::scoped_lock lock(m_kernel_mutex);
+    auto& kernel = *GetActivationKernels(activation_function).m_kernel_train_backward_pass;
+    kernel(cl::EnqueueArgs(m_command_queue,
+                           cl::NDRange(ExtendGlobalWorkSize(layer_neuron_count, m_kernel_training_ideal_workgroup_size_x),
+                                       ExtendGlobalWorkSize(num_training_samples, m_kernel_training_ideal_workgroup_size_y)),
+                           cl::NDRange(m_kernel_training_ideal_workgroup_size_x, m_kernel_training_ideal_workgroup_size_y)),
+           next_layer_data_buffer_cl->GetBuffer(), layer_activations_buffer_cl->GetBuffer(), layer_zvalues_buffer_cl->GetBuffer(), delta_k_vector_buffer_write_cl->GetBuffer(),
+           delta_k_vector_buffer_read_cl->GetBuffer(), cl_uint(layer_neuron_count), cl_uint(activation_function), cl_uint(num_training_samples), cl_uint(costFunction),
+           cl_uint(next_layer_neuron_count), cl_uint(is_output_layer ? 1 : 0));
+}
+
+void OpenCLComputeDevice::QueueTrainCalculateGradient(const IBuffer* delta_k_vector_buffer, const IBuffer* prev_activations_buffer, IBuffer* current_layer_gradient_buffer,
+                                                      uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t num_training_samples)
+{
+    const auto delta_k_vector_buffer_cl = BufferCast<const OpenCLBuffer>(delta_k_vector_buffer);
+    const auto prev_activations_buffer_cl = BufferCast<const OpenCLBuffer>(prev_activations_buffer);
     auto current_layer_gradient_buffer_cl = BufferCast<OpenCLBuffer>(current_layer_gradient_buffer);
 
-    (*m_kernel_train_backward_pass)(cl::EnqueueArgs(m_command_queue,
-                                                    cl::NDRange(ExtendGlobalWorkSize(layer_neuron_count, m_kernel_training_ideal_workgroup_size_x),
-                                                                ExtendGlobalWorkSize(num_training_samples, m_kernel_training_ideal_workgroup_size_y)),
-                                                    cl::NDRange(m_kernel_training_ideal_workgroup_size_x, m_kernel_training_ideal_workgroup_size_y)),
-                                    next_layer_data_buffer_cl->GetBuffer(), prev_activations_buffer_cl->GetBuffer(), layer_activations_buffer_cl->GetBuffer(), layer_zvalues_buffer_cl->GetBuffer(),
-                                    delta_k_vector_buffer_write_cl->GetBuffer(), delta_k_vector_buffer_read_cl->GetBuffer(), current_layer_gradient_buffer_cl->GetBuffer(), cl_uint(layer_neuron_count),
-                                    cl_uint(weights_per_neuron), cl_uint(activation_function), cl_uint(num_training_samples), cl_uint(costFunction), cl_uint(next_layer_neuron_count),
-                                    cl_uint(is_output_layer ? 1 : 0));
+    std::scoped_lock lock(m_kernel_mutex);
+    (*m_kernel_train_calc_gradient)(cl::EnqueueArgs(m_command_queue,
+                                                    cl::NDRange(ExtendGlobalWorkSize(weights_per_neuron + 1, training_calc_gradient_tile_size),
+                                                                ExtendGlobalWorkSize(layer_neuron_count, training_calc_gradient_tile_size)),
+                                                    cl::NDRange(training_calc_gradient_tile_size, training_calc_gradient_tile_size)),
+                                    delta_k_vector_buffer_cl->GetBuffer(), prev_activations_buffer_cl->GetBuffer(), current_layer_gradient_buffer_cl->GetBuffer(), cl_uint(layer_neuron_count),
+                                    cl_uint(weights_per_neuron), cl_uint(num_training_samples));
 }
 
-void OpenCLComputeDevice::QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, float regularization_term_1,
-                                              float regularization_term_2, float normalized_learning_rate)
+void OpenCLComputeDevice::QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, IBuffer* moment1_buffer, IBuffer* moment2_buffer, uint32_t layer_neuron_count,
+                                              uint32_t weights_per_neuron, const OptimizerParameters& optimizer_parameters)
 {
     const auto weights_buffer_cl = BufferCast<const OpenCLBuffer>(tensor_buffer);
     const auto gradient_cl = BufferCast<const OpenCLBuffer>(gradient_buffer);
 
-    (*m_kernel_train_apply_gradient)(cl::EnqueueArgs(m_command_queue, cl::NDRange(ExtendGlobalWorkSize(layer_neuron_count, m_kernel_training_apply_gradient_ideal_workgroup_size)),
+    // Optimizers that don't need the moment buffers never access them, the gradient buffer is bound in their place
+    const auto moment1_cl = moment1_buffer ? BufferCast<const OpenCLBuffer>(moment1_buffer) : gradient_cl;
+    const auto moment2_cl = moment2_buffer ? BufferCast<const OpenCLBuffer>(moment2_buffer) : moment1_cl;
+
+    const size_t element_count = DenseLayout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron}.GetElementCount();
+
+    std::scoped_lock lock(m_kernel_mutex);
+    (*m_kernel_train_apply_gradient)(cl::EnqueueArgs(m_command_queue, cl::NDRange(ExtendGlobalWorkSize(element_count, m_kernel_training_apply_gradient_ideal_workgroup_size)),
                                                      cl::NDRange(m_kernel_training_apply_gradient_ideal_workgroup_size)),
-                                     weights_buffer_cl->GetBuffer(), gradient_cl->GetBuffer(), layer_neuron_count, weights_per_neuron, regularization_term_1, regularization_term_2,
-                                     normalized_learning_rate);
+                                     weights_buffer_cl->GetBuffer(), gradient_cl->GetBuffer(), moment1_cl->GetBuffer(), moment2_cl->GetBuffer(), layer_neuron_count, weights_per_neuron,
+                                     cl_uint(optimizer_parameters.m_optimizer), optimizer_parameters.m_learning_rate, optimizer_parameters.m_gradient_scale,
+                                     optimizer_parameters.m_regularization_term_1, optimizer_parameters.m_regularization_term_2, optimizer_parameters.m_l1_gradient_term,
+                                     optimizer_parameters.m_l2_gradient_term, optimizer_parameters.m_beta1, optimizer_parameters.m_beta2, optimizer_parameters.m_epsilon,
+                                     optimizer_parameters.m_bias_correction_1, optimizer_parameters.m_bias_correction_2);
+}
+
+// The kernels only read the dense layout
+bool OpenCLComputeDevice::PrepareTensorForInference(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron) { return false; }
+
+void OpenCLComputeDevice::QueueApplyMutation(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t tensor_count,
+                                             const MutationParameters& mutation_parameters)
+{
+    const auto weights_buffer_cl = BufferCast<const OpenCLBuffer>(tensor_buffer);
+
+    const size_t element_count = size_t(DenseLayout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron}.GetTensorStride()) * tensor_count;
+
+    std::scoped_lock lock(m_kernel_mutex);
+    (*m_kernel_apply_mutation)(cl::EnqueueArgs(m_command_queue, cl::NDRange(ExtendGlobalWorkSize(element_count, m_kernel_training_apply_gradient_ideal_workgroup_size)),
+                                               cl::NDRange(m_kernel_training_apply_gradient_ideal_workgroup_size)),
+                               weights_buffer_cl->GetBuffer(), layer_neuron_count, weights_per_neuron, tensor_count, cl_uint(mutation_parameters.m_seed), cl_uint(mutation_parameters.m_seed >> 32),
+                               mutation_parameters.m_stream, cl_uint(mutation_parameters.m_weight_distribution), mutation_parameters.m_weight_scale,
+                               cl_uint(mutation_parameters.m_bias_distribution), mutation_parameters.m_bias_scale);
+}
+
+void OpenCLComputeDevice::QueueCrossover(const IBuffer* parents_tensor_buffer, IBuffer* children_tensor_buffer, const IBuffer* parent_ids_buffer, uint32_t layer_neuron_count,
+                                         uint32_t weights_per_neuron, uint32_t children_count, uint64_t seed, uint32_t stream)
+{
+    const auto parents_cl = BufferCast<const OpenCLBuffer>(parents_tensor_buffer);
+    auto children_cl = BufferCast<OpenCLBuffer>(children_tensor_buffer);
+    const auto parent_ids_cl = BufferCast<const OpenCLBuffer>(parent_ids_buffer);
+
+    const size_t element_count = size_t(children_count) * DenseLayout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron}.GetTensorStride();
+
+    std::scoped_lock lock(m_kernel_mutex);
+    (*m_kernel_crossover)(cl::EnqueueArgs(m_command_queue, cl::NDRange(ExtendGlobalWorkSize(element_count, m_kernel_training_apply_gradient_ideal_workgroup_size)),
+                                          cl::NDRange(m_kernel_training_apply_gradient_ideal_workgroup_size)),
+                          parents_cl->GetBuffer(), children_cl->GetBuffer(), parent_ids_cl->GetBuffer(), layer_neuron_count, weights_per_neuron, children_count, cl_uint(seed),
+                          cl_uint(seed >> 32), stream);
 }
 
 std::vector<cl::Device> OpenCLComputeDevice::GetDeviceList()
@@ -12,8 +12,38 @@ enum ActivationFunction
     Activation_Threshold,
     Activation_SoftPlus,
     Activation_ArcTan,
+    Activation_Softmax,
 };
 
+enum CostFunction
+{
+    CostFunction_MeanSquared,
+    CostFunction_CrossEntropy_Sigmoid,
+    CostFunction_CrossEntropy_Softmax,
+};
+
+// Layout of the weights and biases of a layer, see DenseLayout in common.h: a [neuron][row stride] weight matrix with zero padded rows, followed by the bias vector
+#define DENSE_ROW_ALIGNMENT 16
+
+uint GetRowStride(uint weights_per_neuron) { return (weights_per_neuron + DENSE_ROW_ALIGNMENT - 1) / DENSE_ROW_ALIGNMENT * DENSE_ROW_ALIGNMENT; }
+
+uint GetBiasOffset(uint layer_neuron_count, uint weights_per_neuron) { return layer_neuron_count * GetRowStride(weights_per_neuron); }
+
+uint GetTensorElementCount(uint layer_neuron_count, uint weights_per_neuron) { return GetBiasOffset(layer_neuron_count, weights_per_neuron) + layer_neuron_count; }
+
+// Tensors stored after each other, like the members of a population, start at multiples of this
+uint GetTensorStride(uint layer_neuron_count, uint weights_per_neuron)
+{
+    return (GetTensorElementCount(layer_neuron_count, weights_per_neuron) + DENSE_ROW_ALIGNMENT - 1) / DENSE_ROW_ALIGNMENT * DENSE_ROW_ALIGNMENT;
+}
+
+// Programs built with -DACTIVATION_FUNCTION=<id> are specialized for a single activation function, the activation function argument of the kernels is ignored
+#ifdef ACTIVATION_FUNCTION
+#define SELECT_ACTIVATION_FUNCTION(functionId) (ACTIVATION_FUNCTION)
+#else
+#define SELECT_ACTIVATION_FUNCTION(functionId) (functionId)
+#endif
+
 float ActivationFunction(uint functionId, float x)
 {
     switch (functionId) {
@@ -33,34 +63,39 @@ float ActivationFunction(uint functionId, float x)
         return log(1 + exp(x));
     case Activation_ArcTan:
         return atan(x);
+    case Activation_Softmax:
+        return x; // the rows are normalized by the softmax kernel
     default:
         return 0.0f;
     }
 }
 
-float ActivationFunctionPrime(uint functionId, float x)
+// The derivative of the other activation functions is calculated from their output, their z values are not stored
+bool ActivationFunctionUsesZValues(uint functionId)
+{
+    return functionId == Activation_SoftPlus || functionId == Activation_ArcTan;
+}
+
+// Derivative of the activation function at z, where a is the activation of z
+float ActivationFunctionPrime(uint functionId, float z, float a)
 {
     switch (functionId) {
-    case Activation_Sigmoid: {
-        const float sigm = ActivationFunction(Activation_Sigmoid, x);
-        return sigm * (1.0f - sigm);
-    }
+    case Activation_Sigmoid:
+        return a * (1.0f - a);
     case Activation_ReLU:
-        return x < 0.0f ? 0.0f : 1.0f;
-    case Activation_Tanh: {
-        const float sigm = ActivationFunction(Activation_Tanh, x);
-        return 1.0f - sigm * sigm;
-    }
+        return a > 0.0f ? 1.0f : 0.0f;
+    case Activation_Tanh:
+        return 1.0f - a * a;
     case Activation_Identity:
         return 1.0f;
     case Activation_Threshold:
         return 0.0f;
     case Activation_LeakyReLU:
-        return x < 0.0f ? 0.01f : 1.0f;
+        return a < 0.0f ? 0.01f : 1.0f;
     case Activation_SoftPlus:
-        return 1.0f / (1.0f + exp(-x));
+        return 1.0f / (1.0f + exp(-z));
     case Activation_ArcTan:
-        return 1.0f / (x * x + 1);
+        return 1.0f / (z * z + 1);
     default:
         return 0.0f;
     }
@@ -69,49 +104,36 @@ float ActivationFunctionPrime(uint functionId, float x)
 float CostFunctionDelta(uint costFunctionId, uint activationFunctionId, float z, float a, float desiredOutput)
 {
     switch (costFunctionId) {
-    case 0: // Mean-squared error cost function
-        return (a - desiredOutput) * ActivationFunctionPrime(activationFunctionId, z);
-    case 1: // Cross-entropy cost function
+    case CostFunction_MeanSquared:
+        return (a - desiredOutput) * ActivationFunctionPrime(activationFunctionId, z, a);
+    case CostFunction_CrossEntropy_Sigmoid:
+    case CostFunction_CrossEntropy_Softmax:
     default:
         return a - desiredOutput;
     }
 }
 
 __kernel void evaluateLayer(__global const float* weights_biases, __global const float* input_buffer, __global float* output_buffer,
-                                   const uint weights_per_neuron, const uint layer_neuron_count, const uint activation_function)
+                                   const uint weights_per_neuron, const uint layer_neuron_count, const uint activation_function, const uint batch_size,
+                                   const uint weights_batch_stride)
 {
     const uint layer_neuron_id = get_global_id(0);
+    const uint batch_id = get_global_id(1);
 
-    if (layer_neuron_id >= layer_neuron_count)
+    if (layer_neuron_id >= layer_neuron_count || batch_id >= batch_size)
         return;
 
-    const uint neuron_data_size = weights_per_neuron + 1; // weights in prev layer + 1 bias
-
-    __global const float* neuron_weights_biases = weights_biases + layer_neuron_id * neuron_data_size;
+    __global const float* batch_weights_biases = weights_biases + batch_id * weights_batch_stride;
+    __global const float* neuron_weights = batch_weights_biases + layer_neuron_id * GetRowStride(weights_per_neuron);
+    __global const float* batch_input = input_buffer + batch_id * weights_per_neuron;
 
     float acc = 0.0f;
     for (uint i = 0; i < weights_per_neuron; ++i) {
-        acc += neuron_weights_biases[i] * input_buffer[i];
+        acc += neuron_weights[i] * batch_input[i];
     }
-    acc += neuron_weights_biases[weights_per_neuron]; // bias
+    acc += batch_weights_biases[GetBiasOffset(layer_neuron_count, weights_per_neuron) + layer_neuron_id];
 
-    output_buffer[layer_neuron_id] = ActivationFunction(activation_function, acc);
-}
-
-// Atomic addition function from: https://streamhpc.com/blog/2016-02-09/atomic-operations-for-floats-in-opencl-improved/
-void atomicAdd_g_f(volatile __global float* addr, float val)
-{
-    union
-    {
-        unsigned int u32;
-        float f32;
-    } next, expected, current;
-    current.f32 = *addr;
-    do {
-        expected.f32 = current.f32;
-        next.f32 = expected.f32 + val;
-        current.u32 = atomic_cmpxchg((volatile __global unsigned int*)addr, expected.u32, next.u32);
-    } while (current.u32 != expected.u32);
+    output_buffer[batch_id * layer_neuron_count + layer_neuron_id] = ActivationFunction(SELECT_ACTIVATION_FUNCTION(activation_function), acc);
 }
 
 uint GetLayerNeuronCountOffset(uint layerId, __constant const uint* layer_config)
@@ -140,36 +162,34 @@ __kernel void trainingForwardPass(__global const float* weights_biases,
     }
 
     const uint prev_layer_neuron_count = weights_per_neuron;
-    const uint neuron_data_size = weights_per_neuron + 1; // weights in prev layer + 1 bias
 
     const int prev_layer_offset = prev_layer_neuron_count * trainingSampleId;
     const int layer_offset = layer_neuron_count * trainingSampleId;
     
-    __global const float* neuron_weights_biases = weights_biases + layer_neuron_id * neuron_data_size;
+    __global const float* neuron_weights = weights_biases + layer_neuron_id * GetRowStride(weights_per_neuron);
 
     __global const float* prevActivations = prev_activations_base + prev_layer_offset;
 
     // Calculate ZValues for layer
     float acc = 0;
     for (uint i = 0; i < weights_per_neuron; ++i) {
-        acc += neuron_weights_biases[i] * prevActivations[i];
+        acc += neuron_weights[i] * prevActivations[i];
     }
-    acc += neuron_weights_biases[weights_per_neuron]; // bias
+    acc += weights_biases[GetBiasOffset(layer_neuron_count, weights_per_neuron) + layer_neuron_id];
 
-    // Store ZValues and the result of the activation function
-    zvalues[layer_offset + layer_neuron_id] = acc;
-    activations[layer_offset + layer_neuron_id] = ActivationFunction(activation_function, acc);
+    // Store the result of the activation function, and the ZValues if the backward pass needs them
+    if (ActivationFunctionUsesZValues(SELECT_ACTIVATION_FUNCTION(activation_function))) {
+        zvalues[layer_offset + layer_neuron_id] = acc;
+    }
+    activations[layer_offset + layer_neuron_id] = ActivationFunction(SELECT_ACTIVATION_FUNCTION(activation_function), acc);
 }
 
 __kernel void trainingBackwardPass( __global const float* next_layer_data,
-                                    __global const float* prev_activations_base,
                                     __global const float* layer_activations,
                                     __global const float* layer_zvalues,
                                     __global float* delta_k_vector_write,
                                     __global const float* delta_k_vector_read,
-                                    __global float* current_layer_gradient,
                                     const uint layer_neuron_count,
-                                    const uint weights_per_neuron,
                                     const uint activation_function,
                                     const uint num_training_samples,
                                     const uint cost_function,
@@ -183,70 +203,306 @@ __kernel void trainingBackwardPass( __global const float* next_layer_data,
         return;
     }
 
-    const uint prev_layer_neuron_count = weights_per_neuron;
-    const uint prev_layer_offset = prev_layer_neuron_count * trainingSampleId;
     const uint layer_offset = layer_neuron_count * trainingSampleId;
     const uint next_layer_offset = next_layer_neuron_count * trainingSampleId;
     const uint delta_k_read_offset = next_layer_offset;
     const uint delta_k_write_offset = layer_offset;
 
-    __global const float* prev_activations = prev_activations_base + prev_layer_offset;
-
-    const float zValue = layer_zvalues[layer_offset + layer_neuron_id];
+    const float zValue = ActivationFunctionUsesZValues(SELECT_ACTIVATION_FUNCTION(activation_function)) ? layer_zvalues[layer_offset + layer_neuron_id] : 0.0f;
+    const float activation = layer_activations[layer_offset + layer_neuron_id];
 
     float delta_k;
 
     if (is_output_layer) {
         // Output layer
-        const float activation = layer_activations[layer_offset + layer_neuron_id];
         const float desiredOutput = next_layer_data[layer_offset + layer_neuron_id];
-        delta_k = CostFunctionDelta(cost_function, activation_function, zValue, activation, desiredOutput);
+        if (SELECT_ACTIVATION_FUNCTION(activation_function) == Activation_Softmax && cost_function == CostFunction_MeanSquared) {
+            // Every output of softmax depends on every z value of the row, the error is multiplied by the full Jacobian
+            float dot = 0.0f;
+            for (uint i = 0; i < layer_neuron_count; ++i) {
+                dot += (layer_activations[layer_offset + i] - next_layer_data[layer_offset + i]) * layer_activations[layer_offset + i];
+            }
+            delta_k = activation * ((activation - desiredOutput) - dot);
+        } else {
+            delta_k = CostFunctionDelta(cost_function, SELECT_ACTIVATION_FUNCTION(activation_function), zValue, activation, desiredOutput);
+        }
     } else {
         // Hidden layer
         delta_k = 0;
-        const uint next_layer_neuron_data_size = layer_neuron_count + 1;                   // weights + bias
+        const uint next_layer_row_stride = GetRowStride(layer_neuron_count);
         for (uint i = 0; i < next_layer_neuron_count; ++i) {
-            delta_k += delta_k_vector_read[delta_k_read_offset + i] * next_layer_data[layer_neuron_id + i * next_layer_neuron_data_size];
+            delta_k += delta_k_vector_read[delta_k_read_offset + i] * next_layer_data[layer_neuron_id + i * next_layer_row_stride];
         }
-        delta_k *= ActivationFunctionPrime(activation_function, zValue);
+        delta_k *= ActivationFunctionPrime(SELECT_ACTIVATION_FUNCTION(activation_function), zValue, activation);
     }
 
-    const uint gradientBaseOffset = layer_neuron_id * (weights_per_neuron + 1);
+    //TODOZ: if this is the input layer of the network, this write is unnecessary, as it won't be used. This write can be omitted
+    delta_k_vector_write[delta_k_write_offset + layer_neuron_id] = delta_k;
+}
 
-    for (uint i = 0; i < weights_per_neuron; ++i) {
-        atomicAdd_g_f(current_layer_gradient + gradientBaseOffset + i, delta_k * prev_activations[i]);
+// Normalizes every row of the values with softmax, one work item per row
+__kernel void softmax(__global float* values, const uint row_length, const uint row_count)
+{
+    const uint row_id = get_global_id(0);
+
+    if (row_id >= row_count)
+        return;
+
+    __global float* row = values + row_id * row_length;
+
+    // Subtracting the maximum doesn't change the result, but avoids the overflow of exp
+    float max_value = row[0];
+    for (uint i = 1; i < row_length; ++i) {
+        max_value = max(max_value, row[i]);
     }
-    atomicAdd_g_f(current_layer_gradient + gradientBaseOffset + weights_per_neuron, delta_k); //bias
 
-    //TODOZ: if this is the input layer of the network, this write is unnecessary, as it won't be used. This write can be omitted
-    delta_k_vector_write[delta_k_write_offset + layer_neuron_id] = delta_k;
+    float sum = 0.0f;
+    for (uint i = 0; i < row_length; ++i) {
+        const float e = exp(row[i] - max_value);
+        row[i] = e;
+        sum += e;
+    }
+
+    const float scale = 1.0f / sum;
+    for (uint i = 0; i < row_length; ++i) {
+        row[i] *= scale;
+    }
+}
+
+// Accumulates the gradient of a layer: gradient += transpose(delta_k) * [prev_activations, 1]
+// Every work item owns one gradient element and sums the training samples in a fixed order, so the result is deterministic.
+// Work groups load TRAINING_CALC_GRADIENT_TILE_SIZE samples of the deltas and activations into local memory per iteration.
+__kernel __attribute__((reqd_work_group_size(TRAINING_CALC_GRADIENT_TILE_SIZE, TRAINING_CALC_GRADIENT_TILE_SIZE, 1)))
+void trainingCalculateGradient(__global const float* delta_k_vector,
+                               __global const float* prev_activations,
+                               __global float* current_layer_gradient,
+                               const uint layer_neuron_count,
+                               const uint weights_per_neuron,
+                               const uint num_training_samples)
+{
+    __local float delta_k_tile[TRAINING_CALC_GRADIENT_TILE_SIZE][TRAINING_CALC_GRADIENT_TILE_SIZE];           // [neuron][sample]
+    __local float prev_activations_tile[TRAINING_CALC_GRADIENT_TILE_SIZE][TRAINING_CALC_GRADIENT_TILE_SIZE]; // [sample][weight]
+
+    const uint weight_id = get_global_id(0); // weight_id == weights_per_neuron is the bias
+    const uint layer_neuron_id = get_global_id(1);
+    const uint local_x = get_local_id(0);
+    const uint local_y = get_local_id(1);
+    const uint tile_neuron_base = get_group_id(1) * TRAINING_CALC_GRADIENT_TILE_SIZE;
+
+    float acc = 0.0f;
+    for (uint sample_base = 0; sample_base < num_training_samples; sample_base += TRAINING_CALC_GRADIENT_TILE_SIZE) {
+        const uint delta_k_sample = sample_base + local_x;
+        const uint delta_k_neuron = tile_neuron_base + local_y;
+        delta_k_tile[local_y][local_x] = (delta_k_sample < num_training_samples && delta_k_neuron < layer_neuron_count) ? delta_k_vector[delta_k_sample * layer_neuron_count + delta_k_neuron] : 0.0f;
+
+        const uint activation_sample = sample_base + local_y;
+        float activation = 0.0f;
+        if (activation_sample < num_training_samples) {
+            if (weight_id < weights_per_neuron) {
+                activation = prev_activations[activation_sample * weights_per_neuron + weight_id];
+            } else if (weight_id == weights_per_neuron) {
+                activation = 1.0f; // bias
+            }
+        }
+        prev_activations_tile[local_y][local_x] = activation;
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint k = 0; k < TRAINING_CALC_GRADIENT_TILE_SIZE; ++k) {
+            acc += delta_k_tile[local_y][k] * prev_activations_tile[k][local_x];
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (layer_neuron_id < layer_neuron_count) {
+        if (weight_id < weights_per_neuron) {
+            current_layer_gradient[layer_neuron_id * GetRowStride(weights_per_neuron) + weight_id] += acc;
+        } else if (weight_id == weights_per_neuron) {
+            current_layer_gradient[GetBiasOffset(layer_neuron_count, weights_per_neuron) + layer_neuron_id] += acc;
+        }
+    }
 }
 
+enum Optimizer
+{
+    Optimizer_SGD,
+    Optimizer_Momentum,
+    Optimizer_Nesterov,
+    Optimizer_Adam,
+    Optimizer_AdamW,
+};
+
 __kernel void trainingApplyGradient(__global float* weights_biases,
                                     __global const float* gradient,
+                                    __global float* moment1,
+                                    __global float* moment2,
                                     const uint layer_neuron_count,
                                     const uint weights_per_neuron,
+                                    const uint optimizer,
+                                    const float learning_rate,
+                                    const float gradient_scale,
                                     const float regularization_term_1,
                                     const float regularization_term_2,
-                                    const float normalized_learning_rate)
+                                    const float l1_gradient_term,
+                                    const float l2_gradient_term,
+                                    const float beta1,
+                                    const float beta2,
+                                    const float epsilon,
+                                    const float bias_correction_1,
+                                    const float bias_correction_2)
 {
-    const uint layer_neuron_id = get_global_id(0);
+    const uint element_id = get_global_id(0);
 
-    if (layer_neuron_id >= layer_neuron_count)
+    if (element_id >= GetTensorElementCount(layer_neuron_count, weights_per_neuron))
         return;
 
-    const bool applyRegularizationTerm2 = regularization_term_2 != 0.0f;
+    // The padding has zero weights and gradients, so it stays zero
+    const bool is_bias = element_id >= GetBiasOffset(layer_neuron_count, weights_per_neuron);
+
+    float weight = weights_biases[element_id];
 
-    __global float* neuron_weight_data = weights_biases + layer_neuron_id * (weights_per_neuron + 1);
-    const __global float* neuron_gradient_data = gradient + layer_neuron_id * (weights_per_neuron + 1);
+    float g = gradient[element_id] * gradient_scale;
+    if (!is_bias) {
+        g += l2_gradient_term * weight + l1_gradient_term * sign(weight);
+    }
+
+    float step = g;
+    switch (optimizer) {
+    case Optimizer_Momentum: {
+        const float m = beta1 * moment1[element_id] + g;
+        moment1[element_id] = m;
+        step = m;
+        break;
+    }
+    case Optimizer_Nesterov: {
+        const float m = beta1 * moment1[element_id] + g;
+        moment1[element_id] = m;
+        step = g + beta1 * m;
+        break;
+    }
+    case Optimizer_Adam:
+    case Optimizer_AdamW: {
+        const float m = beta1 * moment1[element_id] + (1.0f - beta1) * g;
+        const float v = beta2 * moment2[element_id] + (1.0f - beta2) * g * g;
+        moment1[element_id] = m;
+        moment2[element_id] = v;
+        step = (m * bias_correction_1) / (sqrt(v * bias_correction_2) + epsilon);
+        break;
+    }
+    default:
+        break;
+    }
 
-    for (size_t j = 0; j < weights_per_neuron; ++j) {
-        float weight = neuron_weight_data[j];
-        weight = regularization_term_1 * weight - neuron_gradient_data[j] * normalized_learning_rate;
-        if (applyRegularizationTerm2) {
+    if (is_bias) {
+        weight -= step * learning_rate;
+    } else {
+        weight = regularization_term_1 * weight - step * learning_rate;
+        if (regularization_term_2 != 0.0f) {
             weight -= regularization_term_2 * sign(weight);
         }
-        neuron_weight_data[j] = weight;
     }
-    neuron_weight_data[weights_per_neuron] -= neuron_gradient_data[weights_per_neuron] * normalized_learning_rate; // bias
+
+    weights_biases[element_id] = weight;
+}
+
+enum RandomDistribution
+{
+    RandomDistribution_Uniform,
+    RandomDistribution_Gaussian,
+};
+
+// Philox4x32-10 counter based random number generator, see Salmon et al.: Parallel Random Numbers: As Easy as 1, 2, 3
+uint4 philox4x32_10(uint4 counter, uint2 key)
+{
+    for (int round = 0; round < 10; ++round) {
+        const uint hi0 = mul_hi(0xD2511F53u, counter.x);
+        const uint lo0 = 0xD2511F53u * counter.x;
+        const uint hi1 = mul_hi(0xCD9E8D57u, counter.z);
+        const uint lo1 = 0xCD9E8D57u * counter.z;
+        counter = (uint4)(hi1 ^ counter.y ^ key.x, lo1, hi0 ^ counter.w ^ key.y, lo0);
+        key += (uint2)(0x9E3779B9u, 0xBB67AE85u);
+    }
+    return counter;
+}
+
+// The counter is keyed on the tensor and the element within it, so a population doesn't run out of 32 bit element ids
+float generateMutation(uint distribution, float scale, uint2 seed, uint stream, uint tensor_id, uint element_id)
+{
+    const uint4 random = philox4x32_10((uint4)(element_id, stream, tensor_id, 0), seed);
+
+    if (distribution == RandomDistribution_Gaussian) {
+        // Box-Muller transform
+        const float u1 = (float)((random.x >> 8) + 1) * (1.0f / 16777216.0f);
+        const float u2 = (float)(random.y >> 8) * (1.0f / 16777216.0f);
+        return sqrt(-2.0f * log(u1)) * cos(6.28318530718f * u2) * scale;
+    }
+
+    const float u = (float)(random.x >> 8) * (1.0f / 16777216.0f);
+    return (2.0f * u - 1.0f) * scale;
+}
+
+__kernel void applyMutation(__global float* weights_biases,
+                            const uint layer_neuron_count,
+                            const uint weights_per_neuron,
+                            const uint tensor_count,
+                            const uint seed_lo,
+                            const uint seed_hi,
+                            const uint stream,
+                            const uint weight_distribution,
+                            const float weight_scale,
+                            const uint bias_distribution,
+                            const float bias_scale)
+{
+    const size_t element_id = get_global_id(0);
+
+    const uint tensor_stride = GetTensorStride(layer_neuron_count, weights_per_neuron);
+
+    if (element_id >= (size_t)tensor_count * tensor_stride)
+        return;
+
+    const uint tensor_id = element_id / tensor_stride;
+    const uint tensor_element_id = element_id % tensor_stride;
+
+    if (tensor_element_id >= GetTensorElementCount(layer_neuron_count, weights_per_neuron))
+        return; // padding between the tensors
+
+    const bool is_bias = tensor_element_id >= GetBiasOffset(layer_neuron_count, weights_per_neuron);
+
+    if (!is_bias && tensor_element_id % GetRowStride(weights_per_neuron) >= weights_per_neuron)
+        return; // padding
+
+    weights_biases[element_id] += is_bias ? generateMutation(bias_distribution, bias_scale, (uint2)(seed_lo, seed_hi), stream, tensor_id, tensor_element_id)
+                                          : generateMutation(weight_distribution, weight_scale, (uint2)(seed_lo, seed_hi), stream, tensor_id, tensor_element_id);
+}
+
+__kernel void crossover(__global const float* parents,
+                        __global float* children,
+                        __global const uint* parent_ids,
+                        const uint layer_neuron_count,
+                        const uint weights_per_neuron,
+                        const uint children_count,
+                        const uint seed_lo,
+                        const uint seed_hi,
+                        const uint stream)
+{
+    const size_t element_id = get_global_id(0);
+    const uint tensor_stride = GetTensorStride(layer_neuron_count, weights_per_neuron);
+    const uint bias_offset = GetBiasOffset(layer_neuron_count, weights_per_neuron);
+
+    if (element_id >= (size_t)children_count * tensor_stride)
+        return;
+
+    const uint child_id = element_id / tensor_stride;
+    const uint tensor_element_id = element_id % tensor_stride;
+
+    if (tensor_element_id >= GetTensorElementCount(layer_neuron_count, weights_per_neuron))
+        return; // padding between the tensors
+    const uint neuron_id = tensor_element_id >= bias_offset ? tensor_element_id - bias_offset : tensor_element_id / GetRowStride(weights_per_neuron);
+
+    // Every neuron of a child inherits its weights and bias from one of its two parents, chosen by a random bit
+    const uint4 random = philox4x32_10((uint4)(neuron_id, stream, child_id, 0), (uint2)(seed_lo, seed_hi));
+    const uint parent_id = parent_ids[child_id * 2 + (random.x & 1)];
+
+    children[element_id] = parents[(size_t)parent_id * tensor_stride + tensor_element_id];
 }
@@ -1,8 +1,78 @@
 #include "training.h"
 #include "training_suite.h"
 #include "compute_tasks.h"
+#include "i_compute_device.h"
+#include "utils.h"
+
+#include <numeric>
+#include <limits>
+#include <random>
+#include <chrono>
+#include <future>
 
 namespace macademy {
+
+namespace {
+// std::shuffle and the std distributions are implementation defined, so the shuffle is implemented here to make the order of the
+// training data only depend on the seed, regardless of the standard library used
+void ShuffleIndices(std::span<uint64_t> indices, std::mt19937_64& gen)
+{
+    for (uint64_t i = indices.size(); i > 1; --i) {
+        // draw a uniform random number in [0, i) using rejection sampling to avoid modulo bias
+        const uint64_t limit = std::numeric_limits<uint64_t>::max() - std::numeric_limits<uint64_t>::max() % i;
+        uint64_t r = gen();
+        while (r >= limit) {
+            r = gen();
+        }
+        std::swap(indices[i - 1], indices[r % i]);
+    }
+}
+
+// Splits the samples of a minibatch proportionally to the weights of the devices. Every device gets at least one sample if possible, so the throughput
+// of each device keeps being measured
+std::vector<uint64_t> SplitMinibatch(uint64_t sample_count, std::span<const double> device_weights)
+{
+    std::vector<uint64_t> ret(device_weights.size(), sample_count >= device_weights.size() ? 1 : 0);
+    const uint64_t remaining_sample_count = sample_count - std::accumulate(ret.begin(), ret.end(), uint64_t(0));
+    const double weight_sum = std::accumulate(device_weights.begin(), device_weights.end(), 0.0);
+
+    uint64_t assigned_sample_count = 0;
+    for (size_t i = 0; i < ret.size(); ++i) {
+        const uint64_t share = uint64_t(double(remaining_sample_count) * device_weights[i] / weight_sum);
+        ret[i] += share;
+        assigned_sample_count += share;
+    }
+
+    for (size_t i = 0; assigned_sample_count < remaining_sample_count; i = (i + 1) % ret.size()) {
+        ++ret[i];
+        ++assigned_sample_count;
+    }
+
+    return ret;
+}
+
+void CopyNetworkWeights(const NetworkResourceHandle& src, std::span<NetworkResourceHandle* const> dst)
+{
+    const auto layers = src.m_network->GetLayers();
+
+    std::vector<std::vector<uint8_t>> weights(layers.size());
+    for (size_t i = 0; i < layers.size(); ++i) {
+        weights[i].resize(layers[i].m_tensor->GetByteSize());
+        src.m_compute_device->QueueReadFromBuffer(src.m_tensor_buffers[i].get(), weights[i], 0);
+    }
+    src.m_compute_device->SubmitQueue();
+    src.m_compute_device->WaitQueueIdle();
+
+    for (auto network : dst) {
+        for (size_t i = 0; i < layers.size(); ++i) {
+            network->m_compute_device->QueueWriteToBuffer(network->m_tensor_buffers[i].get(), weights[i], 0);
+        }
+        network->m_compute_device->SubmitQueue();
+        network->m_compute_device->WaitQueueIdle();
+    }
+}
+} // namespace
+
 std::shared_ptr<const TrainingResultTracker> Training::Train(NetworkResourceHandle& network, std::shared_ptr<TrainingSuite> training_suite)
 {
     auto training_result_tracker = std::make_shared<TrainingResultTracker>();
@@ -20,21 +90,16 @@ std::shared_ptr<const TrainingResultTracker> Training::Train(NetworkResourceHand
     }
 
     training_result_tracker->m_future = std::async(std::launch::async, [this, training_suite, &network, training_result_tracker]() {
-        std::random_device rd;
-        std::mt19937 g(rd());
-
-        std::vector<TrainingData> training_data_shuffle_buffer; // TODO: threadlocal + clear
-        std::span<const TrainingData> training_data_view;
+        std::mt19937_64 gen(training_suite->m_deterministic ? training_suite->m_random_seed : std::random_device{}());
 
+        // the training data is shuffled through an index permutation, so the samples themselves are never copied
+        std::vector<uint64_t> training_data_order;
         if (training_suite->m_shuffle_training_data) {
-            training_data_shuffle_buffer.resize(training_suite->m_training_data.size());
-            std::copy(training_suite->m_training_data.begin(), training_suite->m_training_data.end(), std::back_inserter(training_data_shuffle_buffer));
-            training_data_view = training_data_shuffle_buffer;
-        } else {
-            training_data_view = training_suite->m_training_data;
+            training_data_order.resize(training_suite->m_training_data.size());
+            std::iota(training_data_order.begin(), training_data_order.end(), uint64_t(0));
         }
 
-        network.AllocateTrainingResources(training_suite->m_mini_batch_size ? *training_suite->m_mini_batch_size : training_suite->m_training_data.size());
+        network.AllocateTrainingResources(*training_suite);
 
         for (uint32_t currentEpoch = 0; currentEpoch < training_suite->m_epochs; currentEpoch++) {
             if (training_result_tracker->m_stop_at_next_epoch) {
@@ -42,8 +107,7 @@ std::shared_ptr<const TrainingResultTracker> Training::Train(NetworkResourceHand
             }
 
             if (training_suite->m_shuffle_training_data) {
-                std::shuffle(training_data_shuffle_buffer.begin(), training_data_shuffle_buffer.end(), g);
-                training_data_view = training_suite->m_training_data; // update span after shuffling the source vector (todo: this might not be necessary)
+                ShuffleIndices(training_data_order, gen);
             }
 
             uint64_t trainingDataBegin = 0;
@@ -53,7 +117,7 @@ std::shared_ptr<const TrainingResultTracker> Training::Train(NetworkResourceHand
             ComputeTasks compute_tasks;
 
             while (true) {
-                compute_tasks.TrainMinibatch(network, *training_suite, trainingDataBegin, trainingDataEnd);
+                compute_tasks.TrainMinibatch(network, *training_suite, trainingDataBegin, trainingDataEnd, training_data_order);
 
                 if (training_suite->m_mini_batch_size) {
                     if (trainingDataEnd >= training_suite->m_training_data.size()) {
@@ -80,4 +144,176 @@ std::shared_ptr<const TrainingResultTracker> Training::Train(NetworkResourceHand
 
     return training_result_tracker;
 }
-} // namespace macademy
\ No newline at end of file
+
+std::shared_ptr<const TrainingResultTracker> Training::Train(std::span<NetworkResourceHandle* const> networks_span, std::shared_ptr<TrainingSuite> training_suite)
+{
+    if (networks_span.empty()) {
+        throw std::runtime_error("No network to train!");
+    }
+
+    if (networks_span.size() == 1) {
+        return Train(*networks_span[0], training_suite);
+    }
+
+    auto training_result_tracker = std::make_shared<TrainingResultTracker>();
+
+    if (training_suite->m_epochs < 1 || training_suite->m_training_data.empty()) {
+        return training_result_tracker;
+    }
+
+    for (auto network : networks_span) {
+        if (network->m_network->GetLayerCount() != networks_span[0]->m_network->GetLayerCount() || network->m_network->GetNeuronCount() != networks_span[0]->m_network->GetNeuronCount() ||
+            network->m_network->GetInputCount() != networks_span[0]->m_network->GetInputCount()) {
+            throw std::runtime_error("Data parallel training requires the same network on every device!");
+        }
+    }
+
+    if (training_suite->m_training_data[0].m_input.size() != networks_span[0]->m_network->GetInputCount()) {
+        throw std::runtime_error("Invalid training input size!");
+    }
+
+    if (training_suite->m_training_data[0].m_desired_output.size() != networks_span[0]->m_network->GetOutputCount()) {
+        throw std::runtime_error("Invalid training desired output size!");
+    }
+
+    std::vector<NetworkResourceHandle*> networks(networks_span.begin(), networks_span.end());
+
+    training_result_tracker->m_future = std::async(std::launch::async, [training_suite, networks, training_result_tracker]() {
+        std::mt19937_64 gen(training_suite->m_deterministic ? training_suite->m_random_seed : std::random_device{}());
+
+        std::vector<uint64_t> training_data_order;
+        if (training_suite->m_shuffle_training_data) {
+            training_data_order.resize(training_suite->m_training_data.size());
+            std::iota(training_data_order.begin(), training_data_order.end(), uint64_t(0));
+        }
+
+        const uint64_t mini_batch_size = training_suite->m_mini_batch_size ? *training_suite->m_mini_batch_size : training_suite->m_training_data.size();
+        for (auto network : networks) {
+            network->AllocateTrainingResources(*training_suite);
+        }
+
+        // Every device starts from the weights of the first one
+        CopyNetworkWeights(*networks[0], std::span<NetworkResourceHandle* const>(networks.data() + 1, networks.size() - 1));
+
+        const auto layers = networks[0]->m_network->GetLayers();
+
+        // Samples per second of each device, the split is kept static in deterministic mode, as the summation order of the gradients depends on it
+        std::vector<double> device_throughput(networks.size(), 1.0);
+        std::vector<std::vector<std::vector<float>>> device_gradients(networks.size());
+        for (auto& gradients : device_gradients) {
+            for (const auto& layer : layers) {
+                gradients.emplace_back(layer.m_tensor->GetElementSize());
+            }
+        }
+
+        ComputeTasks compute_tasks;
+
+        const auto train_minibatch = [&](uint64_t training_data_begin, uint64_t training_data_end) {
+            const auto split = SplitMinibatch(training_data_end - training_data_begin, device_throughput);
+
+            std::vector<std::future<double>> device_tasks;
+            uint64_t device_data_begin = training_data_begin;
+            for (size_t d = 0; d < networks.size(); ++d) {
+                if (split[d] == 0) {
+                    continue;
+                }
+
+                device_tasks.emplace_back(std::async(std::launch::async, [&, d, device_data_begin]() {
+                    const auto start = std::chrono::steady_clock::now();
+
+                    NetworkResourceHandle& network = *networks[d];
+                    compute_tasks.CalculateGradients(network, *training_suite, device_data_begin, device_data_begin + split[d], training_data_order);
+
+                    for (size_t i = 0; i < layers.size(); ++i) {
+                        network.m_compute_device->QueueReadFromBuffer(network.m_gradient_buffers[i].get(), ToWriteableUi8Span(device_gradients[d][i]), 0);
+                    }
+                    network.m_compute_device->SubmitQueue();
+                    network.m_compute_device->WaitQueueIdle();
+
+                    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                }));
+                device_data_begin += split[d];
+            }
+
+            std::vector<double> device_times;
+            for (auto& task : device_tasks) {
+                device_times.emplace_back(task.get());
+            }
+
+            // All-reduce on the host, always summed in the order of the devices
+            std::vector<std::vector<float>>* reduced_gradients = nullptr;
+            for (size_t d = 0; d < networks.size(); ++d) {
+                if (split[d] == 0) {
+                    continue;
+                }
+
+                if (!reduced_gradients) {
+                    reduced_gradients = &device_gradients[d];
+                    continue;
+                }
+
+                for (size_t i = 0; i < layers.size(); ++i) {
+                    std::transform(reduced_gradients->at(i).begin(), reduced_gradients->at(i).end(), device_gradients[d][i].begin(), reduced_gradients->at(i).begin(), std::plus<float>{});
+                }
+            }
+
+            std::vector<std::future<void>> apply_tasks;
+            for (size_t d = 0; d < networks.size(); ++d) {
+                apply_tasks.emplace_back(std::async(std::launch::async, [&, d]() {
+                    NetworkResourceHandle& network = *networks[d];
+                    for (size_t i = 0; i < layers.size(); ++i) {
+                        network.m_compute_device->QueueWriteToBuffer(network.m_gradient_buffers[i].get(), ToReadOnlyUi8Span(reduced_gradients->at(i)), 0);
+                    }
+                    compute_tasks.ApplyGradients(network, *training_suite, uint32_t(training_data_end - training_data_begin));
+                }));
+            }
+            for (auto& task : apply_tasks) {
+                task.get();
+            }
+
+            if (!training_suite->m_deterministic) {
+                for (size_t d = 0, t = 0; d < networks.size(); ++d) {
+                    if (split[d] > 0) {
+                        const double elapsed = device_times[t++];
+                        if (elapsed > 0.0) {
+                            device_throughput[d] = 0.8 * device_throughput[d] + 0.2 * (double(split[d]) / elapsed);
+                        }
+                    }
+                }
+            }
+        };
+
+        for (uint32_t currentEpoch = 0; currentEpoch < training_suite->m_epochs; currentEpoch++) {
+            if (training_result_tracker->m_stop_at_next_epoch) {
+                return currentEpoch;
+            }
+
+            if (training_suite->m_shuffle_training_data) {
+                ShuffleIndices(training_data_order, gen);
+            }
+
+            for (uint64_t training_data_begin = 0; training_data_begin < training_suite->m_training_data.size(); training_data_begin += mini_batch_size) {
+                const uint64_t training_data_end = std::min(training_data_begin + mini_batch_size, training_suite->m_training_data.size());
+                train_minibatch(training_data_begin, training_data_end);
+
+                training_result_tracker->m_epoch_progress = float(training_data_end) / training_suite->m_training_data.size();
+            }
+
+            // Different devices can round differently when applying the same update, so the weights are realigned after each epoch
+            CopyNetworkWeights(*networks[0], std::span<NetworkResourceHandle* const>(networks.data() + 1, networks.size() - 1));
+
+            ++training_result_tracker->m_epochs_finished;
+        }
+
+        networks[0]->SynchronizeNetworkData();
+        for (auto network : networks) {
+            network->FreeCachedResources();
+        }
+
+        return training_suite->m_epochs;
+    });
+
+    return training_result_tracker;
+}
+
+} // namespace macademy
@@ -0,0 +1,243 @@
+#include "training_memory_plan.h"
+#include "network.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <sstream>
+
+namespace macademy {
+
+namespace {
+const char* GetRoleName(TrainingBufferRole role)
+{
+    switch (role) {
+    case TrainingBufferRole::Input:
+        return "input";
+    case TrainingBufferRole::DesiredOutput:
+        return "desired_output";
+    case TrainingBufferRole::Activations:
+        return "activations";
+    case TrainingBufferRole::ZValues:
+        return "zvalues";
+    case TrainingBufferRole::DeltaK:
+        return "delta_k";
+    case TrainingBufferRole::ForwardActivations:
+        return "forward_activations";
+    case TrainingBufferRole::ForwardZValues:
+        return "forward_zvalues";
+    }
+
+    throw std::runtime_error("Invalid training buffer role!");
+}
+
+// Assigns the buffers to physical buffers, a physical buffer can be reused by a buffer that is first written after the last use of its previous buffer.
+// The smallest free physical buffer that is large enough is preferred, otherwise the largest free one is grown.
+void AssignPhysicalBuffers(TrainingMemoryPlan& plan)
+{
+    std::vector<size_t> order(plan.m_buffers.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return plan.m_buffers[a].m_first_use < plan.m_buffers[b].m_first_use; });
+
+    std::vector<uint32_t> physical_buffer_free_after; // last use of the buffer currently assigned to the physical buffer
+
+    for (size_t buffer_id : order) {
+        auto& buffer = plan.m_buffers[buffer_id];
+
+        std::optional<uint32_t> best_fit;
+        std::optional<uint32_t> largest_free;
+        for (uint32_t i = 0; i < uint32_t(plan.m_physical_buffer_sizes.size()); ++i) {
+            if (physical_buffer_free_after[i] >= buffer.m_first_use) {
+                continue;
+            }
+
+            const size_t size = plan.m_physical_buffer_sizes[i];
+            if (size >= buffer.m_size && (!best_fit || size < plan.m_physical_buffer_sizes[*best_fit])) {
+                best_fit = i;
+            }
+            if (!largest_free || size > plan.m_physical_buffer_sizes[*largest_free]) {
+                largest_free = i;
+            }
+        }
+
+        if (best_fit) {
+            buffer.m_physical_buffer_id = *best_fit;
+        } else if (largest_free) {
+            buffer.m_physical_buffer_id = *largest_free;
+            plan.m_physical_buffer_sizes[*largest_free] = buffer.m_size;
+        } else {
+            buffer.m_physical_buffer_id = uint32_t(plan.m_physical_buffer_sizes.size());
+            plan.m_physical_buffer_sizes.emplace_back(buffer.m_size);
+            physical_buffer_free_after.emplace_back(0);
+        }
+
+        physical_buffer_free_after[buffer.m_physical_buffer_id] = buffer.m_last_use;
+    }
+}
+} // namespace
+
+const TrainingMemoryPlan::Buffer& TrainingMemoryPlan::GetBuffer(TrainingBufferRole role, uint32_t layer_id) const
+{
+    for (const auto& buffer : m_buffers) {
+        if (buffer.m_role == role && buffer.m_layer_id == layer_id) {
+            return buffer;
+        }
+    }
+
+    throw std::runtime_error("Training buffer is not part of the memory plan!");
+}
+
+bool TrainingMemoryPlan::HasBuffer(TrainingBufferRole role, uint32_t layer_id) const
+{
+    return std::any_of(m_buffers.begin(), m_buffers.end(), [&](const Buffer& buffer) { return buffer.m_role == role && buffer.m_layer_id == layer_id; });
+}
+
+size_t TrainingMemoryPlan::GetTransientSize() const { return std::accumulate(m_physical_buffer_sizes.begin(), m_physical_buffer_sizes.end(), size_t(0)); }
+
+size_t TrainingMemoryPlan::GetTransientSizeWithoutReuse() const
+{
+    return std::accumulate(m_buffers.begin(), m_buffers.end(), size_t(0), [](size_t acc, const Buffer& buffer) { return acc + buffer.m_size; });
+}
+
+std::string TrainingMemoryPlan::ToString() const
+{
+    std::stringstream ss;
+    ss << "Training memory plan for " << m_training_sample_count << " samples per step";
+    if (m_checkpoint_interval != 0) {
+        ss << ", checkpoint every " << m_checkpoint_interval << " layers";
+    }
+    ss << ":\n";
+    ss << "  weights: " << m_weights_size << " bytes\n";
+    ss << "  gradients: " << m_gradients_size << " bytes\n";
+    ss << "  optimizer state: " << m_optimizer_size << " bytes\n";
+    ss << "  per-sample buffers: " << GetTransientSize() << " bytes in " << m_physical_buffer_sizes.size() << " buffers (" << GetTransientSizeWithoutReuse() << " bytes without reuse)\n";
+    for (const auto& buffer : m_buffers) {
+        ss << "    " << GetRoleName(buffer.m_role);
+        if (buffer.m_role != TrainingBufferRole::Input && buffer.m_role != TrainingBufferRole::DesiredOutput) {
+            ss << "_" << buffer.m_layer_id;
+        }
+        ss << ": " << buffer.m_size << " bytes, passes [" << buffer.m_first_use << ", " << buffer.m_last_use << "], buffer #" << buffer.m_physical_buffer_id << "\n";
+    }
+    ss << "  total: " << GetTotalSize() << " bytes";
+    return ss.str();
+}
+
+TrainingMemoryPlan CreateTrainingMemoryPlan(const Network& network, uint32_t training_sample_count, Optimizer optimizer, uint32_t checkpoint_interval)
+{
+    const auto layers = network.GetLayers();
+    const uint32_t layer_count = uint32_t(layers.size());
+
+    TrainingMemoryPlan ret;
+    ret.m_training_sample_count = training_sample_count;
+    ret.m_checkpoint_interval = checkpoint_interval;
+
+    for (const auto& layer : layers) {
+        ret.m_weights_size += layer.m_tensor->GetByteSize();
+    }
+    ret.m_gradients_size = ret.m_weights_size;
+
+    const uint32_t moment_buffer_count = optimizer == Optimizer::SGD ? 0 : (optimizer == Optimizer::Adam || optimizer == Optimizer::AdamW) ? 2 : 1;
+    ret.m_optimizer_size = moment_buffer_count * ret.m_weights_size;
+
+    // The layers after the last checkpoint are processed by the backward pass right after the forward pass, they are never recomputed
+    const uint32_t last_segment_begin = checkpoint_interval != 0 ? ((layer_count - 1) / checkpoint_interval) * checkpoint_interval : 0;
+    const auto is_recomputed = [&](uint32_t layer_id) { return layer_id < last_segment_begin && (layer_id + 1) % checkpoint_interval != 0; };
+
+    // Passes of a training step: uploading the samples, the forward pass of each layer, then the backward pass and gradient calculation of each layer in reverse order.
+    // The recomputed layers of a segment are evaluated again right before the backward pass of the checkpoint that ends the segment.
+    std::vector<uint32_t> forward_pass(layer_count);
+    std::vector<uint32_t> recompute_pass(layer_count);
+    std::vector<uint32_t> backward_pass(layer_count);
+    uint32_t pass = 0;
+    for (uint32_t i = 0; i < layer_count; ++i) {
+        forward_pass[i] = ++pass;
+    }
+    for (uint32_t i = layer_count; i-- > 0;) {
+        if (i > 0 && !is_recomputed(i) && is_recomputed(i - 1)) {
+            uint32_t segment_begin = i - 1;
+            while (segment_begin > 0 && is_recomputed(segment_begin - 1)) {
+                --segment_begin;
+            }
+            for (uint32_t j = segment_begin; j < i; ++j) {
+                recompute_pass[j] = ++pass;
+            }
+        }
+        backward_pass[i] = ++pass;
+        ++pass; // gradient calculation
+    }
+    const auto gradient_pass = [&](uint32_t layer_id) { return backward_pass[layer_id] + 1; };
+
+    const auto per_sample_size = [training_sample_count](uint32_t value_count) { return size_t(training_sample_count) * value_count * sizeof(float); };
+
+    ret.m_buffers.emplace_back(TrainingMemoryPlan::Buffer{
+        .m_role = TrainingBufferRole::Input, .m_size = per_sample_size(network.GetInputCount()), .m_first_use = 0, .m_last_use = gradient_pass(0)});
+    ret.m_buffers.emplace_back(TrainingMemoryPlan::Buffer{
+        .m_role = TrainingBufferRole::DesiredOutput, .m_size = per_sample_size(network.GetOutputCount()), .m_first_use = 0, .m_last_use = backward_pass[layer_count - 1]});
+
+    for (uint32_t i = 0; i < layer_count; ++i) {
+        const size_t size = per_sample_size(layers[i].m_num_neurons);
+
+        // The z values are only stored for the activation functions whose derivative can't be calculated from the activations
+        const bool uses_zvalues = ActivationFunctionUsesZValues(layers[i].m_activation);
+
+        // The activations are also read by the forward pass and the gradient calculation of the next layer, both happen before the backward pass of this layer
+        uint32_t first_use = forward_pass[i];
+        if (is_recomputed(i)) {
+            first_use = recompute_pass[i];
+            ret.m_buffers.emplace_back(TrainingMemoryPlan::Buffer{
+                .m_role = TrainingBufferRole::ForwardActivations, .m_layer_id = i, .m_size = size, .m_first_use = forward_pass[i], .m_last_use = forward_pass[i + 1]});
+            if (uses_zvalues) {
+                ret.m_buffers.emplace_back(TrainingMemoryPlan::Buffer{
+                    .m_role = TrainingBufferRole::ForwardZValues, .m_layer_id = i, .m_size = size, .m_first_use = forward_pass[i], .m_last_use = forward_pass[i]});
+            }
+        }
+        ret.m_buffers.emplace_back(
+            TrainingMemoryPlan::Buffer{.m_role = TrainingBufferRole::Activations, .m_layer_id = i, .m_size = size, .m_first_use = first_use, .m_last_use = backward_pass[i]});
+        if (uses_zvalues) {
+            ret.m_buffers.emplace_back(
+                TrainingMemoryPlan::Buffer{.m_role = TrainingBufferRole::ZValues, .m_layer_id = i, .m_size = size, .m_first_use = first_use, .m_last_use = backward_pass[i]});
+        }
+
+        // The delta_k vector is read by the gradient calculation of the layer, and by the backward pass of the previous layer
+        ret.m_buffers.emplace_back(TrainingMemoryPlan::Buffer{
+            .m_role = TrainingBufferRole::DeltaK, .m_layer_id = i, .m_size = size, .m_first_use = backward_pass[i], .m_last_use = i == 0 ? gradient_pass(0) : backward_pass[i - 1]});
+    }
+
+    AssignPhysicalBuffers(ret);
+
+    return ret;
+}
+
+uint32_t CalculateMaxTrainingSampleCount(const Network& network, Optimizer optimizer, size_t memory_budget, uint32_t checkpoint_interval)
+{
+    const auto fits = [&](uint32_t sample_count) { return CreateTrainingMemoryPlan(network, sample_count, optimizer, checkpoint_interval).GetTotalSize() <= memory_budget; };
+
+    if (!fits(1)) {
+        return 0;
+    }
+
+    // The size of the plan grows with the sample count, find an upper bound, then binary search
+    uint32_t lo = 1;
+    uint32_t hi = 2;
+    while (fits(hi)) {
+        lo = hi;
+        if (hi > std::numeric_limits<uint32_t>::max() / 2) {
+            return hi;
+        }
+        hi *= 2;
+    }
+
+    while (hi - lo > 1) {
+        const uint32_t mid = lo + (hi - lo) / 2;
+        if (fits(mid)) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+} // namespace macademy
@@ -17,16 +17,15 @@ nlohmann::json GetNetworkAsJsonObj(const Network& network)
         nlohmann::json weightsMx;
         nlohmann::json biases;
 
-        auto weights_data = network_layer.m_tensor->AsFloat32().data();
+        const auto& layout = network_layer.m_tensor->GetLayout();
+        const auto weights_data = network_layer.m_tensor->AsFloat32();
         for (uint32_t n = 0; n < network_layer.m_num_neurons; ++n) {
             nlohmann::json weights;
             for (uint32_t w = 0; w < weights_per_neuron; ++w) {
-                weights.push_back(*weights_data);
-                ++weights_data;
+                weights.push_back(weights_data[layout.GetWeightIndex(n, w)]);
             }
 
-            biases.push_back(*weights_data);
-            ++weights_data;
+            biases.push_back(weights_data[layout.GetBiasIndex(n)]);
 
             weightsMx.push_back(std::move(weights));
         }
@@ -83,19 +82,22 @@ void ExportNetworkAsBinary(const Network& network, std::ostream& file)
         uint32_t tensor_dtype = uint32_t(layer.m_tensor->GetDType());
         file.write(reinterpret_cast<const char*>(&tensor_dtype), sizeof(tensor_dtype));
 
-        uint64_t tensor_size = uint64_t(layer.m_tensor->GetByteSize());
+        // The weights are stored packed, independently of the memory layout used by the compute devices
+        const auto packed_weights = GetPackedWeights(*layer.m_tensor);
+
+        uint64_t tensor_size = uint64_t(packed_weights.size() * sizeof(float));
         file.write(reinterpret_cast<const char*>(&tensor_size), sizeof(tensor_size));
 
-        file.write(reinterpret_cast<const char*>(layer.m_tensor->GetRawData().data()), layer.m_tensor->GetRawData().size_bytes());
+        file.write(reinterpret_cast<const char*>(packed_weights.data()), tensor_size);
     }
 }
+
 std::unique_ptr<Network> ImportNetworkFromBinary(std::istream& file)
 {
-#if 0
     uint32_t file_binary_version;
     file.read(reinterpret_cast<char*>(&file_binary_version), sizeof(file_binary_version));
 
-    if (file_binary_version != Network::BINARY_VERSION) {
+    if (!file || file_binary_version != Network::BINARY_VERSION) {
         return nullptr;
     }
 
@@ -112,8 +114,9 @@ std::unique_ptr<Network> ImportNetworkFromBinary(std::istream& file)
     uint32_t layer_count;
     file.read(reinterpret_cast<char*>(&layer_count), sizeof(layer_count));
 
-    std::vector<LayerConfig> layer_config;
-    layer_config.reserve(layer_count);
+    std::vector<Layer> layers;
+    layers.reserve(layer_count);
+    uint32_t weights_per_neuron = input_count;
     for (uint32_t i = 0; i < layer_count; ++i) {
         uint32_t activation;
         file.read(reinterpret_cast<char*>(&activation), sizeof(activation));
@@ -121,20 +124,30 @@ std::unique_ptr<Network> ImportNetworkFromBinary(std::istream& file)
         uint32_t neuron_count;
         file.read(reinterpret_cast<char*>(&neuron_count), sizeof(neuron_count));
 
-        layer_config.emplace_back(LayerConfig{.m_activation = ActivationFunction(activation), .m_num_neurons = neuron_count});
-    }
+        uint32_t tensor_dtype;
+        file.read(reinterpret_cast<char*>(&tensor_dtype), sizeof(tensor_dtype));
+
+        uint64_t tensor_size;
+        file.read(reinterpret_cast<char*>(&tensor_size), sizeof(tensor_size));
+
+        if (!file || DType(tensor_dtype) != DType::Float32 || tensor_size != uint64_t(neuron_count) * (weights_per_neuron + 1) * sizeof(float)) {
+            return nullptr;
+        }
+
+        std::vector<float> packed_weights(tensor_size / sizeof(float));
+        file.read(reinterpret_cast<char*>(packed_weights.data()), tensor_size);
 
-    uint64_t total_weight_count;
-    file.read(reinterpret_cast<char*>(&total_weight_count), sizeof(total_weight_count));
+        layers.emplace_back(Layer{.m_tensor = CreateTensorFromPackedWeights(DType::Float32, packed_weights, neuron_count, weights_per_neuron),
+                                  .m_activation = ActivationFunction(activation),
+                                  .m_num_neurons = neuron_count});
+        weights_per_neuron = neuron_count;
+    }
 
-    std::vector<float> weights;
-    weights.resize(total_weight_count);
-    file.read(reinterpret_cast<char*>(weights.data()), total_weight_count * sizeof(float));
+    if (!file) {
+        return nullptr;
+    }
 
-    return NetworkFactory::Build(name, input_count, layer_config, weights);
-#else
-    return {};
-#endif
+    return std::make_unique<Network>(name, input_count, std::move(layers));
 }
 
 } // namespace macademy
\ No newline at end of file
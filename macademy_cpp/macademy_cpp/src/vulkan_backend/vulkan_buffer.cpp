@@ -24,5 +24,31 @@ VulkanBuffer::VulkanBuffer(Device* device, const std::string& name, size_t size,
     device->GetInstance()->SetDebugObjectName(device, uint64_t(m_buffer), name.c_str(), VK_OBJECT_TYPE_BUFFER);
 }
 
-VulkanBuffer::~VulkanBuffer() { vmaDestroyBuffer(m_allocator, m_buffer, m_allocation); }
+VulkanBuffer::VulkanBuffer(VulkanBuffer& buffer, const std::string& name, size_t offset, size_t size)
+    : m_device(buffer.m_device), m_allocator(buffer.m_allocator), m_buffer(buffer.m_buffer), m_root_buffer(buffer.m_root_buffer ? buffer.m_root_buffer : &buffer),
+      m_offset(buffer.m_offset + offset), m_size(size), m_name(name)
+{
+    if (offset + size > buffer.m_size) {
+        throw std::runtime_error("Buffer view is out of range: " + name);
+    }
+}
+
+void VulkanBuffer::FlushMappedRange(size_t offset, size_t size)
+{
+    const VulkanBuffer& root_buffer = m_root_buffer ? *m_root_buffer : *this;
+    vmaFlushAllocation(m_allocator, root_buffer.m_allocation, VkDeviceSize(m_offset + offset), VkDeviceSize(size));
+}
+
+void VulkanBuffer::InvalidateMappedRange(size_t offset, size_t size)
+{
+    const VulkanBuffer& root_buffer = m_root_buffer ? *m_root_buffer : *this;
+    vmaInvalidateAllocation(m_allocator, root_buffer.m_allocation, VkDeviceSize(m_offset + offset), VkDeviceSize(size));
+}
+
+VulkanBuffer::~VulkanBuffer()
+{
+    if (!m_root_buffer) {
+        vmaDestroyBuffer(m_allocator, m_buffer, m_allocation);
+    }
+}
 } // namespace macademy::vk
@@ -5,6 +5,8 @@
 #include "common.h"
 #include "utils.h"
 #include "training_suite.h"
+#include "workgroup_tuner.h"
+#include "device_cache.h"
 
 #include <fstream>
 #include <array>
@@ -33,11 +35,22 @@ namespace macademy {
 
 #include "vulkan_backend/shaders/kernel_training_backward_pass_constants.h"
 #include "vulkan_backend/shaders/kernel_training_backward_pass.glsl.h"
-#include "vulkan_backend/shaders/kernel_training_backward_pass_swadd.glsl.h"
+
+#include "vulkan_backend/shaders/kernel_training_calc_gradient_constants.h"
+#include "vulkan_backend/shaders/kernel_training_calc_gradient.glsl.h"
 
 #include "vulkan_backend/shaders/kernel_training_apply_gradient_constants.h"
 #include "vulkan_backend/shaders/kernel_apply_gradient.glsl.h"
 
+#include "vulkan_backend/shaders/kernel_apply_mutation_constants.h"
+#include "vulkan_backend/shaders/kernel_apply_mutation.glsl.h"
+
+#include "vulkan_backend/shaders/kernel_crossover_constants.h"
+#include "vulkan_backend/shaders/kernel_crossover.glsl.h"
+
+#include "vulkan_backend/shaders/kernel_softmax_constants.h"
+#include "vulkan_backend/shaders/kernel_softmax.glsl.h"
+
 namespace {
 
 size_t GetLocalWorkgroupCount(size_t total_work_items, size_t local_workgroup_size)
@@ -52,6 +65,32 @@ template <size_t N> vk::SpirvBinary get_spirv_binary(const std::array<uint32_t,
     memcpy(ret.data(), byte_array.data(), N * sizeof(uint32_t));
     return ret;
 }
+
+// Hashes the SPIR-V of every kernel
+size_t GetKernelBinariesHash()
+{
+    std::string binaries;
+    for (std::span<const uint32_t> binary :
+         {std::span<const uint32_t>(vulkan_kernel_source_kernel_calc_single_layer_glsl), std::span<const uint32_t>(vulkan_kernel_source_kernel_training_forward_pass_glsl),
+          std::span<const uint32_t>(vulkan_kernel_source_kernel_training_backward_pass_glsl), std::span<const uint32_t>(vulkan_kernel_source_kernel_training_calc_gradient_glsl),
+          std::span<const uint32_t>(vulkan_kernel_source_kernel_apply_gradient_glsl), std::span<const uint32_t>(vulkan_kernel_source_kernel_apply_mutation_glsl),
+          std::span<const uint32_t>(vulkan_kernel_source_kernel_crossover_glsl), std::span<const uint32_t>(vulkan_kernel_source_kernel_softmax_glsl)}) {
+        binaries.append(reinterpret_cast<const char*>(binary.data()), binary.size_bytes());
+    }
+    return std::hash<std::string>{}(binaries);
+}
+
+// Sums the device local heaps, a heap is counted once even if multiple memory types refer to it
+VkDeviceSize GetDeviceLocalMemorySize(const VkPhysicalDeviceMemoryProperties& memory_properties)
+{
+    VkDeviceSize ret = 0;
+    for (uint32_t i = 0; i < memory_properties.memoryHeapCount; ++i) {
+        if (memory_properties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+            ret += memory_properties.memoryHeaps[i].size;
+        }
+    }
+    return ret;
+}
 } // namespace
 
 std::vector<ComputeDeviceInfo> VulkanComputeDevice::GetVulkanComputeDeviceInfo()
@@ -91,12 +130,7 @@ std::vector<ComputeDeviceInfo> VulkanComputeDevice::GetVulkanComputeDeviceInfo()
 
         VkPhysicalDeviceMemoryProperties memoryProperties;
         vkGetPhysicalDeviceMemoryProperties(it, &memoryProperties);
-        VkDeviceSize totalDeviceLocalMemory = 0;
-        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i) {
-            if (memoryProperties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) {
-                totalDeviceLocalMemory += memoryProperties.memoryHeaps[memoryProperties.memoryTypes[i].heapIndex].size;
-            }
-        }
+        const VkDeviceSize totalDeviceLocalMemory = GetDeviceLocalMemorySize(memoryProperties);
 
         ret.push_back(ComputeDeviceInfo{.m_backend = "vulkan", .m_device_index = idx++, .m_device_name = std::string(props.deviceName), .m_total_memory = uint64_t(totalDeviceLocalMemory)});
     }
@@ -106,8 +140,23 @@ std::vector<ComputeDeviceInfo> VulkanComputeDevice::GetVulkanComputeDeviceInfo()
     return ret;
 }
 
+VulkanComputeDevice::RecordingGuard::~RecordingGuard()
+{
+    if (std::uncaught_exceptions() > m_uncaught_exceptions) {
+        // Nested guards are fine, the outer ones find that the thread isn't recording anymore
+        m_device.SubmitQueue();
+        m_device.WaitQueueIdle();
+    }
+}
+
 VkCommandBuffer& VulkanComputeDevice::GetCommandBuffer()
 {
+    if (!IsRecordingThread()) {
+        // A thread owns the command buffer from its first queued command until WaitQueueIdle, so commands of different threads are never interleaved
+        m_recording_mutex.lock();
+        m_recording_thread = std::this_thread::get_id();
+    }
+
     if (m_current_command_buffer == VK_NULL_HANDLE) {
 #ifdef DEBUG_RENDERDOC
         if (rdoc_api) {
@@ -145,11 +194,6 @@ VulkanComputeDevice::VulkanComputeDevice(const ComputeDeviceInfo& device_info, c
     bool validation_layer_enabled = GetBoolFlagFromJson(device_config, "validation_layer_enabled", false);
     bool debug_labels_enabled = GetBoolFlagFromJson(device_config, "debug_labels_enabled", debug_label_default_enabled);
 
-    m_kernel_calc_single_layer_ideal_workgroup_size = GetIntFromJson(device_config, "eval_threadgroup_size", m_kernel_calc_single_layer_ideal_workgroup_size);
-    m_kernel_training_ideal_workgroup_size_x = GetIntFromJson(device_config, "training_threadgroup_size_x", m_kernel_training_ideal_workgroup_size_x);
-    m_kernel_training_ideal_workgroup_size_y = GetIntFromJson(device_config, "training_threadgroup_size_x", m_kernel_training_ideal_workgroup_size_y);
-    m_kernel_training_apply_gradient_ideal_workgroup_size = GetIntFromJson(device_config, "gradient_apply_threadgroup_size", m_kernel_training_apply_gradient_ideal_workgroup_size);
-
     m_instance = std::make_unique<vk::Instance>(validation_layer_enabled, debug_labels_enabled);
 
     uint32_t deviceCount = 0;
@@ -160,65 +204,171 @@ VulkanComputeDevice::VulkanComputeDevice(const ComputeDeviceInfo& device_info, c
 
     m_device = std::make_unique<vk::Device>(m_instance.get(), physical_devices[device_info.m_device_index], true);
 
-    m_hw_atomic_add_support = m_device->GetDeviceAtomicFloatFeatures().shaderBufferFloat32AtomicAdd;
+    const auto& device_props = m_device->GetDeviceProps().properties;
+    const std::string device_key = std::string(device_props.deviceName) + "|" + std::to_string(device_props.driverVersion);
+
+    // Pipelines compiled in earlier runs are loaded from the disk, this includes every specialization of the kernels that was used before
+    if (auto cache_directory = GetCacheDirectory(device_config)) {
+        m_pipeline_cache_path = *cache_directory / (GetCacheFileName(device_key) + ".vkpipelinecache");
+        if (auto data = ReadCacheFile(*m_pipeline_cache_path)) {
+            m_device->LoadPipelineCache(*data);
+            m_saved_pipeline_cache_size = data->size();
+        }
+    }
+
+    WorkgroupSizeLimits limits{};
+    limits.m_max_invocations = device_props.limits.maxComputeWorkGroupInvocations;
+    limits.m_max_size_x = device_props.limits.maxComputeWorkGroupSize[0];
+    limits.m_max_size_y = device_props.limits.maxComputeWorkGroupSize[1];
+
+    // The tuned sizes are only valid for the kernels they were measured with, so the SPIR-V is part of the key
+    const std::string workgroup_sizes_key = device_key + "|" + std::to_string(GetKernelBinariesHash());
+    LoadOrTuneWorkgroupSizes(*this, device_config, workgroup_sizes_key, WorkgroupSizes{}, limits, [this](const WorkgroupSizes& sizes) {
+        // The work group sizes are specialization constants, so the kernels are (re)created when they change
+        if (!m_kernel_train_calc_gradient || m_kernel_calc_single_layer_ideal_workgroup_size != sizes.m_eval || m_kernel_training_ideal_workgroup_size_x != sizes.m_training_x ||
+            m_kernel_training_ideal_workgroup_size_y != sizes.m_training_y || m_kernel_training_apply_gradient_ideal_workgroup_size != sizes.m_apply_gradient) {
+            m_kernel_calc_single_layer_ideal_workgroup_size = sizes.m_eval;
+            m_kernel_training_ideal_workgroup_size_x = sizes.m_training_x;
+            m_kernel_training_ideal_workgroup_size_y = sizes.m_training_y;
+            m_kernel_training_apply_gradient_ideal_workgroup_size = sizes.m_apply_gradient;
+            CreateKernels();
+        }
+    });
+
+    SavePipelineCache();
+}
+
+void VulkanComputeDevice::SavePipelineCache()
+{
+    if (!m_pipeline_cache_path) {
+        return;
+    }
+
+    // The cache only grows, it has to be written only if new pipelines were added to it
+    const auto data = m_device->GetPipelineCacheData();
+    if (!data.empty() && data.size() != m_saved_pipeline_cache_size && WriteCacheFile(*m_pipeline_cache_path, data)) {
+        m_saved_pipeline_cache_size = data.size();
+    }
+}
+
+VulkanComputeDevice::ActivationKernels& VulkanComputeDevice::GetActivationKernels(ActivationFunction activation_function)
+{
+    auto& ret = m_activation_kernels[activation_function];
+
+    if (!ret.m_kernel_calc_single_layer) {
+        {
+            vk::ShaderSpecializationMap shader_specialization;
+            shader_specialization.emplace(0, m_kernel_calc_single_layer_ideal_workgroup_size);
+            shader_specialization.emplace(2, uint32_t(activation_function));
+
+            // Note: there should be currently at most 2 simultaneous descriptor sets, but I used 8 here just in case the compute tasks api gets used in some unintended way.
+            ret.m_kernel_calc_single_layer = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_calc_single_layer", 3, uint32_t(sizeof(CalcSingleLayerPushConstantData)), 8,
+                                                                                 get_spirv_binary(vulkan_kernel_source_kernel_calc_single_layer_glsl), shader_specialization);
+        }
+
+        {
+            vk::ShaderSpecializationMap shader_specialization;
+            shader_specialization.emplace(0, m_kernel_training_ideal_workgroup_size_x);
+            shader_specialization.emplace(1, m_kernel_training_ideal_workgroup_size_y);
+            shader_specialization.emplace(2, uint32_t(activation_function));
+
+            ret.m_kernel_train_forward_pass = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_train_forward_pass", 4, uint32_t(sizeof(TrainingForwardPassPushConstantData)), 8,
+                                                                                  get_spirv_binary(vulkan_kernel_source_kernel_training_forward_pass_glsl), shader_specialization);
+        }
+
+        {
+            vk::ShaderSpecializationMap shader_specialization;
+            shader_specialization.emplace(0, m_kernel_training_ideal_workgroup_size_x);
+            shader_specialization.emplace(1, m_kernel_training_ideal_workgroup_size_y);
+            shader_specialization.emplace(2, uint32_t(activation_function));
+
+            ret.m_kernel_train_backward_pass = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_train_backward_pass", 5, uint32_t(sizeof(TrainingBackwardPassPushConstantData)), 8,
+                                                                                   get_spirv_binary(vulkan_kernel_source_kernel_training_backward_pass_glsl), shader_specialization);
+        }
+    }
+
+    return ret;
+}
+
+void VulkanComputeDevice::CreateKernels()
+{
+    // The kernels of the activation functions are recreated on their next use with the current work group sizes
+    m_activation_kernels.clear();
+
+    {
+        // The work group size of this kernel is fixed by TRAINING_CALC_GRADIENT_TILE_SIZE, as it sizes the shared memory tiles
+        vk::ShaderSpecializationMap shader_specialization;
 
-    if (GetBoolFlagFromJson(device_config, "disable_hw_atomic_add", false)) {
-        m_hw_atomic_add_support = false;
+        m_kernel_train_calc_gradient = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_train_calc_gradient", 3, uint32_t(sizeof(TrainingCalcGradientPushConstantData)), 8,
+                                                                           get_spirv_binary(vulkan_kernel_source_kernel_training_calc_gradient_glsl), shader_specialization);
     }
 
     {
         vk::ShaderSpecializationMap shader_specialization;
-        shader_specialization.emplace(0, m_kernel_calc_single_layer_ideal_workgroup_size);
+        shader_specialization.emplace(0, m_kernel_training_apply_gradient_ideal_workgroup_size);
 
-        // Note: there should be currently at most 2 simultaneous descriptor sets, but I used 8 here just in case the compute tasks api gets used in some unintended way.
-        m_kernel_calc_single_layer = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_calc_single_layer", 3, uint32_t(sizeof(CalcSingleLayerPushConstantData)), 8,
-                                                                         get_spirv_binary(vulkan_kernel_source_kernel_calc_single_layer_glsl), shader_specialization);
+        m_kernel_train_apply_gradient = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_train_apply_gradient", 4, uint32_t(sizeof(ApplyGradientPushConstantData)), 8,
+                                                                            get_spirv_binary(vulkan_kernel_source_kernel_apply_gradient_glsl), shader_specialization);
     }
 
     {
         vk::ShaderSpecializationMap shader_specialization;
-        shader_specialization.emplace(0, m_kernel_training_ideal_workgroup_size_x);
-        shader_specialization.emplace(1, m_kernel_training_ideal_workgroup_size_y);
+        shader_specialization.emplace(0, m_kernel_training_apply_gradient_ideal_workgroup_size);
 
-        m_kernel_train_forward_pass = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_train_forward_pass", 4, uint32_t(sizeof(TrainingForwardPassPushConstantData)), 8,
-                                                                          get_spirv_binary(vulkan_kernel_source_kernel_training_forward_pass_glsl), shader_specialization);
+        m_kernel_apply_mutation = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_apply_mutation", 1, uint32_t(sizeof(ApplyMutationPushConstantData)), 8,
+                                                                      get_spirv_binary(vulkan_kernel_source_kernel_apply_mutation_glsl), shader_specialization);
     }
 
     {
         vk::ShaderSpecializationMap shader_specialization;
-        shader_specialization.emplace(0, m_kernel_training_ideal_workgroup_size_x);
-        shader_specialization.emplace(1, m_kernel_training_ideal_workgroup_size_y);
+        shader_specialization.emplace(0, m_kernel_training_apply_gradient_ideal_workgroup_size);
 
-        const auto spirv_binary =
-            m_hw_atomic_add_support ? get_spirv_binary(vulkan_kernel_source_kernel_training_backward_pass_glsl) : get_spirv_binary(vulkan_kernel_source_kernel_training_backward_pass_swadd_glsl);
-        m_kernel_train_backward_pass =
-            std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_train_backward_pass", 7, uint32_t(sizeof(TrainingBackwardPassPushConstantData)), 8, spirv_binary, shader_specialization);
+        m_kernel_crossover = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_crossover", 3, uint32_t(sizeof(CrossoverPushConstantData)), 8,
+                                                                 get_spirv_binary(vulkan_kernel_source_kernel_crossover_glsl), shader_specialization);
     }
 
     {
         vk::ShaderSpecializationMap shader_specialization;
         shader_specialization.emplace(0, m_kernel_training_apply_gradient_ideal_workgroup_size);
 
-        m_kernel_train_apply_gradient = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_train_apply_gradient", 2, uint32_t(sizeof(ApplyGradientPushConstantData)), 8,
-                                                                            get_spirv_binary(vulkan_kernel_source_kernel_apply_gradient_glsl), shader_specialization);
+        m_kernel_softmax = std::make_unique<vk::ComputeKernel>(m_device.get(), "kernel_softmax", 1, uint32_t(sizeof(SoftmaxPushConstantData)), 8,
+                                                               get_spirv_binary(vulkan_kernel_source_kernel_softmax_glsl), shader_specialization);
     }
 }
 
-VulkanComputeDevice::~VulkanComputeDevice() {}
+VulkanComputeDevice::~VulkanComputeDevice() { SavePipelineCache(); }
 
 std::unique_ptr<IBuffer> VulkanComputeDevice::CreateBuffer(size_t size, BufferUsage buffer_usage, const std::string& name)
 {
     VkBufferUsageFlags buffer_usage_flags = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 
+    // Device local memory that is also host visible (integrated devices, resizable BAR) is preferred and persistently mapped, so MapBuffer doesn't need a staging buffer.
+    // Otherwise the buffer is allocated in device local memory, and accessed through staging buffers.
     auto ret = std::make_unique<vk::VulkanBuffer>(m_device.get(), name, size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                                  VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT);
+                                                  VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE,
+                                                  VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+                                                      VMA_ALLOCATION_CREATE_HOST_ACCESS_ALLOW_TRANSFER_INSTEAD_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
 
     return ret;
 }
 
+std::unique_ptr<IBuffer> VulkanComputeDevice::CreateBufferView(IBuffer* buffer, size_t offset, size_t size, const std::string& name)
+{
+    auto vk_buffer = BufferCast<vk::VulkanBuffer>(buffer);
+
+    ASSERT(offset % GetBufferViewAlignment() == 0);
+
+    return std::make_unique<vk::VulkanBuffer>(*vk_buffer, name, offset, size);
+}
+
+// Views are bound as storage buffer descriptors at their offset
+size_t VulkanComputeDevice::GetBufferViewAlignment() const { return size_t(m_device->GetDeviceProps().properties.limits.minStorageBufferOffsetAlignment); }
+
 void VulkanComputeDevice::QueueWriteToBuffer(IBuffer* dst_buffer, std::span<const uint8_t> src, size_t buffer_offset)
 {
     auto vk_buffer = BufferCast<vk::VulkanBuffer>(dst_buffer);
+    RecordingGuard recording_guard(*this);
+    auto command_buffer = GetCommandBuffer();
     auto& staging_buffer = m_staging_buffers.emplace_back(m_device->GetLoaderStagingBuffer(src.size()));
 
     auto dst_memory = staging_buffer->m_staging_buffer->MapMemory();
@@ -226,22 +376,23 @@ void VulkanComputeDevice::QueueWriteToBuffer(IBuffer* dst_buffer, std::span<cons
     memcpy(dst_memory, src.data(), src.size_bytes());
     staging_buffer->m_staging_buffer->UnmapMemory();
 
-    VkBufferCopy copy_region{.srcOffset = 0, .dstOffset = buffer_offset, .size = src.size_bytes()};
-    vkCmdCopyBuffer(GetCommandBuffer(), staging_buffer->m_staging_buffer->GetHandle(), vk_buffer->GetHandle(), 1, &copy_region);
+    VkBufferCopy copy_region{.srcOffset = 0, .dstOffset = vk_buffer->GetOffset() + buffer_offset, .size = src.size_bytes()};
+    vkCmdCopyBuffer(command_buffer, staging_buffer->m_staging_buffer->GetHandle(), vk_buffer->GetHandle(), 1, &copy_region);
 
-    m_dirty_buffers.emplace(vk_buffer, BufferSynchronizationEvent::TransferWrite);
+    MarkBufferDirty(vk_buffer, BufferSynchronizationEvent::TransferWrite);
 }
 
 void VulkanComputeDevice::QueueReadFromBuffer(IBuffer* src_buffer, std::span<uint8_t> dst, size_t buffer_offset)
 {
     auto vk_buffer = BufferCast<vk::VulkanBuffer>(src_buffer);
-    auto& staging_buffer = m_staging_buffers.emplace_back(m_device->GetLoaderStagingBuffer(dst.size()));
+    RecordingGuard recording_guard(*this);
     auto command_buffer = GetCommandBuffer();
+    auto& staging_buffer = m_staging_buffers.emplace_back(m_device->GetLoaderStagingBuffer(dst.size()));
 
     std::array<const vk::VulkanBuffer*, 1> buffers{{vk_buffer}};
     SynchronizeBuffers(command_buffer, SynchronizationAction::TransferRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
 
-    VkBufferCopy copy_region{.srcOffset = 0, .dstOffset = buffer_offset, .size = dst.size_bytes()};
+    VkBufferCopy copy_region{.srcOffset = vk_buffer->GetOffset() + buffer_offset, .dstOffset = 0, .size = dst.size_bytes()};
     vkCmdCopyBuffer(command_buffer, vk_buffer->GetHandle(), staging_buffer->m_staging_buffer->GetHandle(), 1, &copy_region);
 
     m_memory_reads.emplace_back();
@@ -252,14 +403,124 @@ void VulkanComputeDevice::QueueReadFromBuffer(IBuffer* src_buffer, std::span<uin
 void VulkanComputeDevice::QueueFillBuffer(IBuffer* buffer, uint32_t data, size_t offset_bytes, size_t size_bytes)
 {
     auto vk_buffer = BufferCast<vk::VulkanBuffer>(buffer);
-    vkCmdFillBuffer(GetCommandBuffer(), vk_buffer->GetHandle(), VkDeviceSize(offset_bytes), VkDeviceSize(size_bytes), data);
+    RecordingGuard recording_guard(*this);
+    vkCmdFillBuffer(GetCommandBuffer(), vk_buffer->GetHandle(), VkDeviceSize(vk_buffer->GetOffset() + offset_bytes), VkDeviceSize(size_bytes), data);
+
+    MarkBufferDirty(vk_buffer, BufferSynchronizationEvent::TransferWrite);
+}
+
+std::span<uint8_t> VulkanComputeDevice::MapBuffer(IBuffer* buffer, BufferUsage access, size_t offset_bytes, size_t size_bytes)
+{
+    auto vk_buffer = BufferCast<vk::VulkanBuffer>(buffer);
+
+    ASSERT(vk_buffer->GetSize() >= offset_bytes + size_bytes);
+
+    {
+        // Checked before anything is recorded, the check at the end only catches another thread mapping the same buffer concurrently
+        std::lock_guard lock(m_mapped_buffers_mutex);
+        if (m_mapped_buffers.contains(buffer)) {
+            throw std::runtime_error("Buffer is already mapped!");
+        }
+    }
+
+    RecordingGuard recording_guard(*this);
+
+    const bool has_queued_commands = IsRecordingThread() && m_current_command_buffer != VK_NULL_HANDLE;
+
+    MappedBuffer mapped_buffer{.m_access = access, .m_offset = offset_bytes, .m_size = size_bytes};
+    std::span<uint8_t> ret;
+
+    // A buffer that is only written is filled through a staging buffer if the queued commands may still use it, so the queue doesn't have to be waited for
+    if (vk_buffer->IsHostVisible() && (access != BufferUsage::WriteOnly || !has_queued_commands)) {
+        if (access != BufferUsage::WriteOnly) {
+            // Waiting for the queue doesn't make the device writes visible to the host, that needs a barrier to the host stage
+            std::array<const vk::VulkanBuffer*, 1> buffers{{vk_buffer}};
+            SynchronizeBuffers(GetCommandBuffer(), SynchronizationAction::HostRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
+        }
+
+        if (IsRecordingThread() && m_current_command_buffer != VK_NULL_HANDLE) {
+            SubmitQueue();
+            WaitQueueIdle();
+        }
+
+        if (access != BufferUsage::WriteOnly) {
+            vk_buffer->InvalidateMappedRange(offset_bytes, size_bytes);
+        }
+
+        ret = std::span<uint8_t>(static_cast<uint8_t*>(vk_buffer->MapMemory()) + offset_bytes, size_bytes);
+    } else {
+        auto command_buffer = GetCommandBuffer();
+        mapped_buffer.m_staging_buffer = m_device->GetLoaderStagingBuffer(size_bytes);
+
+        if (access != BufferUsage::WriteOnly) {
+            std::array<const vk::VulkanBuffer*, 1> buffers{{vk_buffer}};
+            SynchronizeBuffers(command_buffer, SynchronizationAction::TransferRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
+
+            VkBufferCopy copy_region{.srcOffset = vk_buffer->GetOffset() + offset_bytes, .dstOffset = 0, .size = size_bytes};
+            vkCmdCopyBuffer(command_buffer, vk_buffer->GetHandle(), mapped_buffer.m_staging_buffer->m_staging_buffer->GetHandle(), 1, &copy_region);
+
+            SubmitQueue();
+            WaitQueueIdle();
+        }
+
+        auto staging_memory = mapped_buffer.m_staging_buffer->m_staging_buffer->MapMemory();
+        ASSERT(staging_memory); // loader staging buffers should be host_visible, and therefore mappable!
+        ret = std::span<uint8_t>(static_cast<uint8_t*>(staging_memory), size_bytes);
+    }
+
+    std::lock_guard lock(m_mapped_buffers_mutex);
+    if (!m_mapped_buffers.emplace(buffer, std::move(mapped_buffer)).second) {
+        throw std::runtime_error("Buffer is already mapped!");
+    }
+
+    return ret;
+}
+
+void VulkanComputeDevice::UnmapBuffer(IBuffer* buffer)
+{
+    auto vk_buffer = BufferCast<vk::VulkanBuffer>(buffer);
+
+    MappedBuffer mapped_buffer;
+    {
+        std::lock_guard lock(m_mapped_buffers_mutex);
+        auto it = m_mapped_buffers.find(buffer);
+        if (it == m_mapped_buffers.end()) {
+            throw std::runtime_error("Buffer is not mapped!");
+        }
+        mapped_buffer = std::move(it->second);
+        m_mapped_buffers.erase(it);
+    }
+
+    if (!mapped_buffer.m_staging_buffer) {
+        // The host writes are made available to the device by the next queue submission
+        if (mapped_buffer.m_access != BufferUsage::ReadOnly) {
+            vk_buffer->FlushMappedRange(mapped_buffer.m_offset, mapped_buffer.m_size);
+        }
+        vk_buffer->UnmapMemory();
+        return;
+    }
+
+    mapped_buffer.m_staging_buffer->m_staging_buffer->UnmapMemory();
 
-    m_dirty_buffers.emplace(vk_buffer, BufferSynchronizationEvent::TransferWrite);
+    if (mapped_buffer.m_access == BufferUsage::ReadOnly) {
+        return;
+    }
+
+    RecordingGuard recording_guard(*this);
+    auto command_buffer = GetCommandBuffer();
+
+    VkBufferCopy copy_region{.srcOffset = 0, .dstOffset = vk_buffer->GetOffset() + mapped_buffer.m_offset, .size = mapped_buffer.m_size};
+    vkCmdCopyBuffer(command_buffer, mapped_buffer.m_staging_buffer->m_staging_buffer->GetHandle(), vk_buffer->GetHandle(), 1, &copy_region);
+
+    MarkBufferDirty(vk_buffer, BufferSynchronizationEvent::TransferWrite);
+
+    // The staging buffer is released when the copy is finished
+    m_staging_buffers.emplace_back(std::move(mapped_buffer.m_staging_buffer));
 }
 
 void VulkanComputeDevice::SubmitQueue()
 {
-    if (m_current_command_buffer != VK_NULL_HANDLE) {
+    if (IsRecordingThread() && m_current_command_buffer != VK_NULL_HANDLE) {
 
         vkEndCommandBuffer(m_current_command_buffer);
 
@@ -274,6 +535,10 @@ void VulkanComputeDevice::SubmitQueue()
 
 void VulkanComputeDevice::WaitQueueIdle()
 {
+    if (!IsRecordingThread()) {
+        return;
+    }
+
     if (m_current_command_buffer != VK_NULL_HANDLE) {
         vkQueueWaitIdle(m_device->GetComputeQueue());
 
@@ -290,13 +555,18 @@ void VulkanComputeDevice::WaitQueueIdle()
 
         m_memory_reads.clear();
 
-        m_kernel_calc_single_layer->FreeDescriptorSets();
-        m_kernel_train_forward_pass->FreeDescriptorSets();
-        m_kernel_train_backward_pass->FreeDescriptorSets();
+        for (auto& [activation_function, kernels] : m_activation_kernels) {
+            kernels.m_kernel_calc_single_layer->FreeDescriptorSets();
+            kernels.m_kernel_train_forward_pass->FreeDescriptorSets();
+            kernels.m_kernel_train_backward_pass->FreeDescriptorSets();
+        }
+        m_kernel_train_calc_gradient->FreeDescriptorSets();
         m_kernel_train_apply_gradient->FreeDescriptorSets();
+        m_kernel_apply_mutation->FreeDescriptorSets();
+        m_kernel_crossover->FreeDescriptorSets();
+        m_kernel_softmax->FreeDescriptorSets();
 
         m_staging_buffers.clear();
-        m_dirty_buffers.clear();
 
 #ifdef DEBUG_RENDERDOC
         if (rdoc_api) {
@@ -304,8 +574,19 @@ void VulkanComputeDevice::WaitQueueIdle()
         }
 #endif
     }
+
+    m_recording_thread = std::thread::id{};
+    m_recording_mutex.unlock();
+}
+
+void VulkanComputeDevice::MarkBufferDirty(const vk::VulkanBuffer* buffer, BufferSynchronizationEvent buffer_event)
+{
+    auto& events = m_dirty_buffers[buffer->GetHandle()];
+    events = BufferSynchronizationEvent(uint32_t(events) | uint32_t(buffer_event));
 }
 
+bool VulkanComputeDevice::IsRecordingThread() const { return m_recording_thread.load() == std::this_thread::get_id(); }
+
 void VulkanComputeDevice::SynchronizeBuffers(VkCommandBuffer command_buffer, SynchronizationAction action, std::span<const vk::VulkanBuffer*> buffers)
 {
     thread_local std::vector<VkBufferMemoryBarrier> buffer_memory_barriers;
@@ -316,7 +597,7 @@ void VulkanComputeDevice::SynchronizeBuffers(VkCommandBuffer command_buffer, Syn
 
         for (int i = 0; i < int(buffers.size()); ++i) {
 
-            auto it = m_dirty_buffers.find(buffers[i]);
+            auto it = m_dirty_buffers.find(buffers[i]->GetHandle());
 
             if (it != m_dirty_buffers.end() && (uint32_t(it->second) & uint32_t(buffer_event)) != 0) {
                 auto& bufferMemoryBarrier = buffer_memory_barriers.emplace_back(VkBufferMemoryBarrier{});
@@ -368,15 +649,31 @@ void VulkanComputeDevice::SynchronizeBuffers(VkCommandBuffer command_buffer, Syn
         // Add barriers for buffers that are currently being written by an earlier compute shader...
         CollectBarriers(BufferSynchronizationEvent::ComputeShaderWrite, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT);
         InsertBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    } else if (action == SynchronizationAction::HostRead) {
+        // Host side wants to read the mapped memory of a buffer
+
+        // Add barriers for buffers that are currently being transferred to...
+        CollectBarriers(BufferSynchronizationEvent::TransferWrite, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT);
+        InsertBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT);
+
+        // Add barriers for buffers that are currently being written by an earlier compute shader...
+        CollectBarriers(BufferSynchronizationEvent::ComputeShaderWrite, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT);
+        InsertBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT);
     }
 
     for (int i = 0; i < int(buffers.size()); ++i) {
-        m_dirty_buffers.erase(buffers[i]);
+        m_dirty_buffers.erase(buffers[i]->GetHandle());
     }
 }
 
 void VulkanComputeDevice::QueueEvaluateLayer(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
                                              uint32_t layer_input_count, uint32_t layer_neuron_count)
+{
+    QueueEvaluateLayerBatched(tensor_buffer, layer_input_buffer, layer_output_buffer, activation_function, layer_input_count, layer_neuron_count, 1, 0);
+}
+
+void VulkanComputeDevice::QueueEvaluateLayerBatched(const IBuffer* tensor_buffer, const IBuffer* layer_input_buffer, IBuffer* layer_output_buffer, ActivationFunction activation_function,
+                                                    uint32_t layer_input_count, uint32_t layer_neuron_count, uint32_t batch_size, uint32_t weights_batch_stride)
 {
     const auto weights_buffer_vk = BufferCast<const vk::VulkanBuffer>(tensor_buffer);
     const auto layer_input_buffer_vk = BufferCast<const vk::VulkanBuffer>(layer_input_buffer);
@@ -389,6 +686,7 @@ void VulkanComputeDevice::QueueEvaluateLayer(const IBuffer* tensor_buffer, const
     buffers[1] = layer_input_buffer_vk;
     buffers[2] = layer_output_buffer_vk;
 
+    RecordingGuard recording_guard(*this);
     auto command_buffer = GetCommandBuffer();
 
     SynchronizeBuffers(command_buffer, SynchronizationAction::ComputeShaderRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
@@ -397,11 +695,18 @@ void VulkanComputeDevice::QueueEvaluateLayer(const IBuffer* tensor_buffer, const
     push_constant_data.activation_function = uint32_t(activation_function);
     push_constant_data.weights_per_neuron = layer_input_count;
     push_constant_data.layer_neuron_count = layer_neuron_count;
+    push_constant_data.batch_size = batch_size;
+    push_constant_data.weights_batch_stride = weights_batch_stride;
 
-    m_kernel_calc_single_layer->Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
-    m_kernel_calc_single_layer->Dispatch(command_buffer, GetLocalWorkgroupCount(layer_neuron_count, m_kernel_calc_single_layer_ideal_workgroup_size), 1, 1);
+    auto& kernel = *GetActivationKernels(activation_function).m_kernel_calc_single_layer;
+    kernel.Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
+    kernel.Dispatch(command_buffer, GetLocalWorkgroupCount(layer_neuron_count, m_kernel_calc_single_layer_ideal_workgroup_size), batch_size, 1);
 
-    m_dirty_buffers.emplace(layer_output_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+    MarkBufferDirty(layer_output_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+
+    if (activation_function == ActivationFunction::Softmax) {
+        QueueSoftmax(layer_output_buffer_vk, layer_neuron_count, batch_size);
+    }
 }
 
 void VulkanComputeDevice::QueueTrainForwardPass(const IBuffer* tensor_buffer, const IBuffer* prev_activations, IBuffer* activations, IBuffer* zvalues, ActivationFunction activation_function,
@@ -411,7 +716,8 @@ void VulkanComputeDevice::QueueTrainForwardPass(const IBuffer* tensor_buffer, co
     const auto weights_buffer_vk = BufferCast<const vk::VulkanBuffer>(tensor_buffer);
     const auto prev_activations_buffer_vk = BufferCast<const vk::VulkanBuffer>(prev_activations);
     auto activations_buffer_vk = BufferCast<vk::VulkanBuffer>(activations);
-    auto zvalues_buffer_vk = BufferCast<vk::VulkanBuffer>(zvalues);
+    // The kernel doesn't touch the z values if the activation function doesn't use them, the activations are bound in their place
+    auto zvalues_buffer_vk = ActivationFunctionUsesZValues(activation_function) ? BufferCast<vk::VulkanBuffer>(zvalues) : activations_buffer_vk;
 
     thread_local std::vector<const vk::VulkanBuffer*> buffers;
 
@@ -421,6 +727,7 @@ void VulkanComputeDevice::QueueTrainForwardPass(const IBuffer* tensor_buffer, co
     buffers[2] = activations_buffer_vk;
     buffers[3] = zvalues_buffer_vk;
 
+    RecordingGuard recording_guard(*this);
     auto command_buffer = GetCommandBuffer();
 
     SynchronizeBuffers(command_buffer, SynchronizationAction::ComputeShaderRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
@@ -431,71 +738,132 @@ void VulkanComputeDevice::QueueTrainForwardPass(const IBuffer* tensor_buffer, co
     push_constant_data.weights_per_neuron = weights_per_neuron;
     push_constant_data.num_training_samples = num_training_samples;
 
-    m_kernel_train_forward_pass->Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
-    m_kernel_train_forward_pass->Dispatch(command_buffer, GetLocalWorkgroupCount(layer_neuron_count, m_kernel_training_ideal_workgroup_size_x),
-                                          GetLocalWorkgroupCount(num_training_samples, m_kernel_training_ideal_workgroup_size_y), 1);
+    auto& kernel = *GetActivationKernels(activation_function).m_kernel_train_forward_pass;
+    kernel.Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
+    kernel.Dispatch(command_buffer, GetLocalWorkgroupCount(layer_neuron_count, m_kernel_training_ideal_workgroup_size_x),
+                    GetLocalWorkgroupCount(num_training_samples, m_kernel_training_ideal_workgroup_size_y), 1);
+
+    MarkBufferDirty(activations_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+    if (ActivationFunctionUsesZValues(activation_function)) {
+        MarkBufferDirty(zvalues_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+    }
+
+    if (activation_function == ActivationFunction::Softmax) {
+        QueueSoftmax(activations_buffer_vk, layer_neuron_count, num_training_samples);
+    }
+}
+
+void VulkanComputeDevice::QueueSoftmax(vk::VulkanBuffer* buffer, uint32_t row_length, uint32_t row_count)
+{
+    thread_local std::vector<const vk::VulkanBuffer*> buffers;
+
+    buffers.resize(1);
+    buffers[0] = buffer;
 
-    m_dirty_buffers.emplace(activations_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
-    m_dirty_buffers.emplace(zvalues_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+    RecordingGuard recording_guard(*this);
+    auto command_buffer = GetCommandBuffer();
+
+    SynchronizeBuffers(command_buffer, SynchronizationAction::ComputeShaderRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
+
+    SoftmaxPushConstantData push_constant_data{};
+    push_constant_data.row_length = row_length;
+    push_constant_data.row_count = row_count;
+
+    m_kernel_softmax->Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
+    m_kernel_softmax->Dispatch(command_buffer, GetLocalWorkgroupCount(row_count, m_kernel_training_apply_gradient_ideal_workgroup_size), 1, 1);
+
+    MarkBufferDirty(buffer, BufferSynchronizationEvent::ComputeShaderWrite);
 }
 
-void VulkanComputeDevice::QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* prev_activations_buffer, const IBuffer* layer_activations_buffer,
-                                                 const IBuffer* layer_zvalues_buffer, IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read,
-                                                 IBuffer* current_layer_gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, ActivationFunction activation_function,
+void VulkanComputeDevice::QueueTrainBackwardPass(bool is_output_layer, const IBuffer* next_layer_data_buffer, const IBuffer* layer_activations_buffer, const IBuffer* layer_zvalues_buffer,
+                                                 IBuffer* delta_k_vector_buffer_write, const IBuffer* delta_k_vector_buffer_read, uint32_t layer_neuron_count, ActivationFunction activation_function,
                                                  uint32_t num_training_samples, CostFunction cost_function, uint32_t next_layer_neuron_count)
 {
     const auto next_layer_data_buffer_vk = BufferCast<const vk::VulkanBuffer>(next_layer_data_buffer);
-    const auto prev_activations_buffer_vk = BufferCast<const vk::VulkanBuffer>(prev_activations_buffer);
     const auto layer_activations_buffer_vk = BufferCast<const vk::VulkanBuffer>(layer_activations_buffer);
-    const auto layer_zvalues_buffer_vk = BufferCast<const vk::VulkanBuffer>(layer_zvalues_buffer);
+    const auto layer_zvalues_buffer_vk = ActivationFunctionUsesZValues(activation_function) ? BufferCast<const vk::VulkanBuffer>(layer_zvalues_buffer) : layer_activations_buffer_vk;
     auto delta_k_vector_buffer_write_vk = BufferCast<vk::VulkanBuffer>(delta_k_vector_buffer_write);
     const auto delta_k_vector_buffer_read_vk = BufferCast<const vk::VulkanBuffer>(delta_k_vector_buffer_read);
-    auto current_layer_gradient_buffer_vk = BufferCast<vk::VulkanBuffer>(current_layer_gradient_buffer);
 
     thread_local std::vector<const vk::VulkanBuffer*> buffers;
 
-    buffers.resize(7);
+    buffers.resize(5);
     buffers[0] = next_layer_data_buffer_vk;
-    buffers[1] = prev_activations_buffer_vk;
-    buffers[2] = layer_activations_buffer_vk;
-    buffers[3] = layer_zvalues_buffer_vk;
-    buffers[4] = delta_k_vector_buffer_write_vk;
-    buffers[5] = delta_k_vector_buffer_read_vk;
-    buffers[6] = current_layer_gradient_buffer_vk;
+    buffers[1] = layer_activations_buffer_vk;
+    buffers[2] = layer_zvalues_buffer_vk;
+    buffers[3] = delta_k_vector_buffer_write_vk;
+    buffers[4] = delta_k_vector_buffer_read_vk;
 
+    RecordingGuard recording_guard(*this);
     auto command_buffer = GetCommandBuffer();
 
     SynchronizeBuffers(command_buffer, SynchronizationAction::ComputeShaderRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
 
     TrainingBackwardPassPushConstantData push_constant_data{};
     push_constant_data.layer_neuron_count = layer_neuron_count;
-    push_constant_data.weights_per_neuron = weights_per_neuron;
     push_constant_data.activation_function = uint32_t(activation_function);
     push_constant_data.num_training_samples = num_training_samples;
     push_constant_data.cost_function = uint32_t(cost_function);
     push_constant_data.next_layer_neuron_count = next_layer_neuron_count;
     push_constant_data.is_output_layer = is_output_layer;
 
-    m_kernel_train_backward_pass->Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
-    m_kernel_train_backward_pass->Dispatch(command_buffer, GetLocalWorkgroupCount(layer_neuron_count, m_kernel_training_ideal_workgroup_size_x),
-                                           GetLocalWorkgroupCount(num_training_samples, m_kernel_training_ideal_workgroup_size_y), 1);
+    auto& kernel = *GetActivationKernels(activation_function).m_kernel_train_backward_pass;
+    kernel.Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
+    kernel.Dispatch(command_buffer, GetLocalWorkgroupCount(layer_neuron_count, m_kernel_training_ideal_workgroup_size_x),
+                    GetLocalWorkgroupCount(num_training_samples, m_kernel_training_ideal_workgroup_size_y), 1);
+
+    MarkBufferDirty(delta_k_vector_buffer_write_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+}
+
+void VulkanComputeDevice::QueueTrainCalculateGradient(const IBuffer* delta_k_vector_buffer, const IBuffer* prev_activations_buffer, IBuffer* current_layer_gradient_buffer,
+                                                      uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t num_training_samples)
+{
+    const auto delta_k_vector_buffer_vk = BufferCast<const vk::VulkanBuffer>(delta_k_vector_buffer);
+    const auto prev_activations_buffer_vk = BufferCast<const vk::VulkanBuffer>(prev_activations_buffer);
+    auto current_layer_gradient_buffer_vk = BufferCast<vk::VulkanBuffer>(current_layer_gradient_buffer);
+
+    thread_local std::vector<const vk::VulkanBuffer*> buffers;
+
+    buffers.resize(3);
+    buffers[0] = delta_k_vector_buffer_vk;
+    buffers[1] = prev_activations_buffer_vk;
+    buffers[2] = current_layer_gradient_buffer_vk;
+
+    RecordingGuard recording_guard(*this);
+    auto command_buffer = GetCommandBuffer();
 
-    m_dirty_buffers.emplace(delta_k_vector_buffer_write_vk, BufferSynchronizationEvent::ComputeShaderWrite);
-    m_dirty_buffers.emplace(current_layer_gradient_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+    SynchronizeBuffers(command_buffer, SynchronizationAction::ComputeShaderRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
+
+    TrainingCalcGradientPushConstantData push_constant_data{};
+    push_constant_data.layer_neuron_count = layer_neuron_count;
+    push_constant_data.weights_per_neuron = weights_per_neuron;
+    push_constant_data.num_training_samples = num_training_samples;
+
+    m_kernel_train_calc_gradient->Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
+    m_kernel_train_calc_gradient->Dispatch(command_buffer, GetLocalWorkgroupCount(weights_per_neuron + 1, TRAINING_CALC_GRADIENT_TILE_SIZE),
+                                           GetLocalWorkgroupCount(layer_neuron_count, TRAINING_CALC_GRADIENT_TILE_SIZE), 1);
+
+    MarkBufferDirty(current_layer_gradient_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
 }
 
-void VulkanComputeDevice::QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, float regularization_term_1,
-                                              float regularization_term_2, float normalized_learning_rate)
+void VulkanComputeDevice::QueueApplyGradients(IBuffer* tensor_buffer, const IBuffer* gradient_buffer, IBuffer* moment1_buffer, IBuffer* moment2_buffer, uint32_t layer_neuron_count,
+                                              uint32_t weights_per_neuron, const OptimizerParameters& optimizer_parameters)
 {
     auto weights_buffer_vk = BufferCast<vk::VulkanBuffer>(tensor_buffer);
     const auto gradient_vk = BufferCast<const vk::VulkanBuffer>(gradient_buffer);
+    auto moment1_vk = moment1_buffer ? BufferCast<vk::VulkanBuffer>(moment1_buffer) : nullptr;
+    auto moment2_vk = moment2_buffer ? BufferCast<vk::VulkanBuffer>(moment2_buffer) : nullptr;
 
     thread_local std::vector<const vk::VulkanBuffer*> buffers;
 
-    buffers.resize(2);
-    buffers[0] = BufferCast<const vk::VulkanBuffer>(weights_buffer_vk);
-    buffers[1] = BufferCast<const vk::VulkanBuffer>(gradient_vk);
+    // Optimizers that don't need the moment buffers never access them, the gradient buffer is bound in their place
+    buffers.resize(4);
+    buffers[0] = weights_buffer_vk;
+    buffers[1] = gradient_vk;
+    buffers[2] = moment1_vk ? moment1_vk : gradient_vk;
+    buffers[3] = moment2_vk ? moment2_vk : buffers[2];
 
+    RecordingGuard recording_guard(*this);
     auto command_buffer = GetCommandBuffer();
 
     SynchronizeBuffers(command_buffer, SynchronizationAction::ComputeShaderRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
@@ -503,19 +871,106 @@ void VulkanComputeDevice::QueueApplyGradients(IBuffer* tensor_buffer, const IBuf
     ApplyGradientPushConstantData push_constant_data{};
     push_constant_data.layer_neuron_count = layer_neuron_count;
     push_constant_data.weights_per_neuron = weights_per_neuron;
-    push_constant_data.regularization_term_1 = regularization_term_1;
-    push_constant_data.regularization_term_2 = regularization_term_2;
-    push_constant_data.normalized_learning_rate = normalized_learning_rate;
+    push_constant_data.optimizer = uint32_t(optimizer_parameters.m_optimizer);
+    push_constant_data.learning_rate = optimizer_parameters.m_learning_rate;
+    push_constant_data.gradient_scale = optimizer_parameters.m_gradient_scale;
+    push_constant_data.regularization_term_1 = optimizer_parameters.m_regularization_term_1;
+    push_constant_data.regularization_term_2 = optimizer_parameters.m_regularization_term_2;
+    push_constant_data.l1_gradient_term = optimizer_parameters.m_l1_gradient_term;
+    push_constant_data.l2_gradient_term = optimizer_parameters.m_l2_gradient_term;
+    push_constant_data.beta1 = optimizer_parameters.m_beta1;
+    push_constant_data.beta2 = optimizer_parameters.m_beta2;
+    push_constant_data.epsilon = optimizer_parameters.m_epsilon;
+    push_constant_data.bias_correction_1 = optimizer_parameters.m_bias_correction_1;
+    push_constant_data.bias_correction_2 = optimizer_parameters.m_bias_correction_2;
 
     m_kernel_train_apply_gradient->Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
-    m_kernel_train_apply_gradient->Dispatch(command_buffer, GetLocalWorkgroupCount(layer_neuron_count, m_kernel_calc_single_layer_ideal_workgroup_size), 1, 1);
+    const uint32_t element_count = DenseLayout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron}.GetElementCount();
+    m_kernel_train_apply_gradient->Dispatch(command_buffer, GetLocalWorkgroupCount(element_count, m_kernel_training_apply_gradient_ideal_workgroup_size), 1, 1);
+
+    MarkBufferDirty(weights_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+    if (moment1_vk) {
+        MarkBufferDirty(moment1_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+    }
+    if (moment2_vk) {
+        MarkBufferDirty(moment2_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+    }
+}
+
+// The kernels only read the dense layout
+bool VulkanComputeDevice::PrepareTensorForInference(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron) { return false; }
+
+void VulkanComputeDevice::QueueApplyMutation(IBuffer* tensor_buffer, uint32_t layer_neuron_count, uint32_t weights_per_neuron, uint32_t tensor_count,
+                                             const MutationParameters& mutation_parameters)
+{
+    auto weights_buffer_vk = BufferCast<vk::VulkanBuffer>(tensor_buffer);
+
+    thread_local std::vector<const vk::VulkanBuffer*> buffers;
+
+    buffers.resize(1);
+    buffers[0] = weights_buffer_vk;
+
+    RecordingGuard recording_guard(*this);
+    auto command_buffer = GetCommandBuffer();
+
+    SynchronizeBuffers(command_buffer, SynchronizationAction::ComputeShaderRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
+
+    ApplyMutationPushConstantData push_constant_data{};
+    push_constant_data.layer_neuron_count = layer_neuron_count;
+    push_constant_data.weights_per_neuron = weights_per_neuron;
+    push_constant_data.tensor_count = tensor_count;
+    push_constant_data.seed_lo = uint32_t(mutation_parameters.m_seed);
+    push_constant_data.seed_hi = uint32_t(mutation_parameters.m_seed >> 32);
+    push_constant_data.stream = mutation_parameters.m_stream;
+    push_constant_data.weight_distribution = uint32_t(mutation_parameters.m_weight_distribution);
+    push_constant_data.weight_scale = mutation_parameters.m_weight_scale;
+    push_constant_data.bias_distribution = uint32_t(mutation_parameters.m_bias_distribution);
+    push_constant_data.bias_scale = mutation_parameters.m_bias_scale;
+
+    m_kernel_apply_mutation->Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
+    const uint32_t element_count = DenseLayout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron}.GetTensorStride() * tensor_count;
+    m_kernel_apply_mutation->Dispatch(command_buffer, GetLocalWorkgroupCount(element_count, m_kernel_training_apply_gradient_ideal_workgroup_size), 1, 1);
+
+    MarkBufferDirty(weights_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+}
+
+void VulkanComputeDevice::QueueCrossover(const IBuffer* parents_tensor_buffer, IBuffer* children_tensor_buffer, const IBuffer* parent_ids_buffer, uint32_t layer_neuron_count,
+                                         uint32_t weights_per_neuron, uint32_t children_count, uint64_t seed, uint32_t stream)
+{
+    const auto parents_vk = BufferCast<const vk::VulkanBuffer>(parents_tensor_buffer);
+    auto children_vk = BufferCast<vk::VulkanBuffer>(children_tensor_buffer);
+    const auto parent_ids_vk = BufferCast<const vk::VulkanBuffer>(parent_ids_buffer);
+
+    thread_local std::vector<const vk::VulkanBuffer*> buffers;
+
+    buffers.resize(3);
+    buffers[0] = parents_vk;
+    buffers[1] = children_vk;
+    buffers[2] = parent_ids_vk;
+
+    RecordingGuard recording_guard(*this);
+    auto command_buffer = GetCommandBuffer();
+
+    SynchronizeBuffers(command_buffer, SynchronizationAction::ComputeShaderRead, std::span<const vk::VulkanBuffer*>(buffers.begin(), buffers.end()));
+
+    CrossoverPushConstantData push_constant_data{};
+    push_constant_data.layer_neuron_count = layer_neuron_count;
+    push_constant_data.weights_per_neuron = weights_per_neuron;
+    push_constant_data.children_count = children_count;
+    push_constant_data.seed_lo = uint32_t(seed);
+    push_constant_data.seed_hi = uint32_t(seed >> 32);
+    push_constant_data.stream = stream;
+
+    m_kernel_crossover->Bind(command_buffer, buffers, AsUint8TSpan(push_constant_data));
+    const uint32_t element_count = DenseLayout{.m_num_neurons = layer_neuron_count, .m_weights_per_neuron = weights_per_neuron}.GetTensorStride() * children_count;
+    m_kernel_crossover->Dispatch(command_buffer, GetLocalWorkgroupCount(element_count, m_kernel_training_apply_gradient_ideal_workgroup_size), 1, 1);
 
-    m_dirty_buffers.emplace(weights_buffer_vk, BufferSynchronizationEvent::ComputeShaderWrite);
+    MarkBufferDirty(children_vk, BufferSynchronizationEvent::ComputeShaderWrite);
 }
 
 std::string VulkanComputeDevice::GetDeviceName() const { return "Vulkan Device: " + m_device->GetName(); }
 
-size_t VulkanComputeDevice::GetTotalMemory() const { return 0; }
+size_t VulkanComputeDevice::GetTotalMemory() const { return size_t(GetDeviceLocalMemorySize(m_device->GetMemoryProps().memoryProperties)); }
 
 bool VulkanComputeDevice::SupportsWeightFormat(DType format) const
 {
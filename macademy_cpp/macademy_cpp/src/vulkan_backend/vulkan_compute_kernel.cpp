@@ -85,7 +85,7 @@ VkDescriptorSet ComputeKernel::GetDescriptorSet(const std::vector<const vk::Vulk
         buffer_infos.resize(storage_buffers.size());
         for (int i = 0; i < int(storage_buffers.size()); ++i) {
             buffer_infos[i].buffer = storage_buffers[i]->GetHandle();
-            buffer_infos[i].offset = 0;
+            buffer_infos[i].offset = storage_buffers[i]->GetOffset();
             buffer_infos[i].range = storage_buffers[i]->GetSize();
         }
 
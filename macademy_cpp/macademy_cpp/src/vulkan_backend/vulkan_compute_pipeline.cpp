@@ -69,7 +69,7 @@ ComputePipeline::ComputePipeline(Device* device, const std::string& name, const
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE; // Optional
     pipelineInfo.basePipelineIndex = -1;              // Optional
 
-    auto result = vkCreateComputePipelines(m_device->GetHandle(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_compute_pipeline);
+    auto result = vkCreateComputePipelines(m_device->GetHandle(), m_device->GetPipelineCache(), 1, &pipelineInfo, nullptr, &m_compute_pipeline);
     if (result != VK_SUCCESS) {
         throw std::runtime_error("failed to create compute pipeline! " + std::to_string(result));
     }
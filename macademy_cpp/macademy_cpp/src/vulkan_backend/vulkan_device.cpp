@@ -98,6 +98,55 @@ Device::Device(Instance* instance, VkPhysicalDevice physical_device, bool enable
     }
 
     m_command_pool = std::make_unique<CommandPool>(this, "command_pool", compute_queue_index.value());
+
+    LoadPipelineCache({});
+}
+
+bool Device::IsPipelineCacheCompatible(std::span<const uint8_t> data) const
+{
+    VkPipelineCacheHeaderVersionOne header{};
+    if (data.size() < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+
+    return header.headerSize >= sizeof(header) && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE && header.vendorID == m_device_props.properties.vendorID &&
+           header.deviceID == m_device_props.properties.deviceID && memcmp(header.pipelineCacheUUID, m_device_props.properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+void Device::LoadPipelineCache(std::span<const uint8_t> data)
+{
+    if (m_pipeline_cache != VK_NULL_HANDLE) {
+        vkDestroyPipelineCache(m_device, m_pipeline_cache, nullptr);
+        m_pipeline_cache = VK_NULL_HANDLE;
+    }
+
+    VkPipelineCacheCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    if (IsPipelineCacheCompatible(data)) {
+        create_info.initialDataSize = data.size();
+        create_info.pInitialData = data.data();
+    }
+
+    if (vkCreatePipelineCache(m_device, &create_info, nullptr, &m_pipeline_cache) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create pipeline cache!");
+    }
+}
+
+std::vector<uint8_t> Device::GetPipelineCacheData()
+{
+    size_t size = 0;
+    if (vkGetPipelineCacheData(m_device, m_pipeline_cache, &size, nullptr) != VK_SUCCESS) {
+        return {};
+    }
+
+    std::vector<uint8_t> ret(size);
+    if (vkGetPipelineCacheData(m_device, m_pipeline_cache, &size, ret.data()) != VK_SUCCESS) {
+        return {};
+    }
+    ret.resize(size);
+
+    return ret;
 }
 
 VkCommandBuffer Device::CreateCommandBuffer()
@@ -186,6 +235,7 @@ Device::~Device()
     vkDeviceWaitIdle(m_device);
     m_command_pool.reset();
     m_loader_staging_buffers.clear();
+    vkDestroyPipelineCache(m_device, m_pipeline_cache, nullptr);
     vmaDestroyAllocator(m_vma);
     vkDestroyDevice(m_device, nullptr);
 }
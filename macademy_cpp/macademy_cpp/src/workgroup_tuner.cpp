@@ -0,0 +1,264 @@
+#include "workgroup_tuner.h"
+#include "device_cache.h"
+#include "i_compute_device.h"
+#include "common.h"
+
+#include <chrono>
+#include <limits>
+
+namespace macademy {
+
+namespace {
+constexpr const char* workgroup_sizes_cache_file_name = "workgroup_sizes.json";
+
+double MeasureSeconds(IComputeDevice& device, const std::function<void()>& queue_work)
+{
+    constexpr int repetitions = 3;
+
+    // The first run is not measured, it includes the lazy initialization done by the drivers
+    queue_work();
+    device.SubmitQueue();
+    device.WaitQueueIdle();
+
+    double ret = std::numeric_limits<double>::max();
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        queue_work();
+        device.SubmitQueue();
+        device.WaitQueueIdle();
+        ret = std::min(ret, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return ret;
+}
+
+// Returns the fastest candidate, or the current value if no candidate could be measured
+template <typename T>
+T SelectFastest(IComputeDevice& device, std::span<const T> candidates, T current, const std::function<void(const T&)>& apply_candidate, const std::function<void()>& queue_work)
+{
+    T ret = current;
+    double best_time = std::numeric_limits<double>::max();
+
+    for (const auto& candidate : candidates) {
+        try {
+            apply_candidate(candidate);
+            const double time = MeasureSeconds(device, queue_work);
+            if (time < best_time) {
+                best_time = time;
+                ret = candidate;
+            }
+        } catch (const std::exception&) {
+            // the device rejected this work group size, try the next one
+        }
+    }
+
+    apply_candidate(ret);
+    return ret;
+}
+
+std::optional<WorkgroupSizes> ParseWorkgroupSizes(const nlohmann::json& json)
+{
+    if (!json.is_object()) {
+        return {};
+    }
+
+    WorkgroupSizes ret;
+    ret.m_eval = GetIntFromJson(json, "eval", 0);
+    ret.m_training_x = GetIntFromJson(json, "training_x", 0);
+    ret.m_training_y = GetIntFromJson(json, "training_y", 0);
+    ret.m_apply_gradient = GetIntFromJson(json, "apply_gradient", 0);
+
+    if (ret.m_eval == 0 || ret.m_training_x == 0 || ret.m_training_y == 0 || ret.m_apply_gradient == 0) {
+        return {};
+    }
+    return ret;
+}
+
+// The cached sizes and the sizes in the device config may not fit the device, e.g. when the config is shared between machines
+bool IsLinearWorkgroupSizeValid(uint32_t size, const WorkgroupSizeLimits& limits) { return size > 0 && size <= limits.m_max_invocations && size <= limits.m_max_size_x; }
+
+bool IsTrainingWorkgroupSizeValid(uint32_t size_x, uint32_t size_y, const WorkgroupSizeLimits& limits)
+{
+    return size_x > 0 && size_y > 0 && size_x <= limits.m_max_size_x && size_y <= limits.m_max_size_y && uint64_t(size_x) * size_y <= limits.m_max_invocations;
+}
+
+bool AreWorkgroupSizesValid(const WorkgroupSizes& sizes, const WorkgroupSizeLimits& limits)
+{
+    return IsLinearWorkgroupSizeValid(sizes.m_eval, limits) && IsTrainingWorkgroupSizeValid(sizes.m_training_x, sizes.m_training_y, limits) &&
+           IsLinearWorkgroupSizeValid(sizes.m_apply_gradient, limits);
+}
+
+nlohmann::json ReadWorkgroupSizesCache(const std::filesystem::path& cache_directory)
+{
+    if (auto data = ReadCacheFile(cache_directory / workgroup_sizes_cache_file_name)) {
+        auto ret = nlohmann::json::parse(data->begin(), data->end(), nullptr, false);
+        if (ret.is_object()) {
+            return ret;
+        }
+    }
+    return nlohmann::json::object();
+}
+} // namespace
+
+WorkgroupSizes TuneWorkgroupSizes(IComputeDevice& device, const WorkgroupSizes& initial_sizes, const WorkgroupSizeLimits& limits,
+                                  const std::function<void(const WorkgroupSizes&)>& apply_workgroup_sizes)
+{
+    WorkgroupSizes sizes = initial_sizes;
+
+    std::vector<uint32_t> linear_candidates;
+    for (uint32_t size : {16u, 32u, 64u, 128u, 256u, 512u, 1024u}) {
+        if (size <= limits.m_max_invocations && size <= limits.m_max_size_x) {
+            linear_candidates.emplace_back(size);
+        }
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> training_candidates;
+    for (uint32_t x : {4u, 8u, 16u, 32u, 64u}) {
+        for (uint32_t y : {4u, 8u, 16u, 32u}) {
+            if (x * y >= 32 && x * y <= limits.m_max_invocations && x <= limits.m_max_size_x && y <= limits.m_max_size_y) {
+                training_candidates.emplace_back(x, y);
+            }
+        }
+    }
+
+    // Layer evaluation, with a single input and with a batch of inputs
+    {
+        constexpr uint32_t input_count = 1024;
+        constexpr uint32_t neuron_count = 1024;
+        constexpr uint32_t batch_size = 16;
+
+        const DenseLayout layout{.m_num_neurons = neuron_count, .m_weights_per_neuron = input_count};
+        auto tensor = device.CreateBuffer(size_t(layout.GetElementCount()) * sizeof(float), BufferUsage::ReadOnly, "tuning_tensor");
+        auto input = device.CreateBuffer(size_t(batch_size) * input_count * sizeof(float), BufferUsage::ReadOnly, "tuning_input");
+        auto output = device.CreateBuffer(size_t(batch_size) * neuron_count * sizeof(float), BufferUsage::ReadWrite, "tuning_output");
+        device.QueueFillBuffer(tensor.get(), 0, 0, tensor->GetSize());
+        device.QueueFillBuffer(input.get(), 0, 0, input->GetSize());
+
+        sizes.m_eval = SelectFastest<uint32_t>(
+            device, linear_candidates, sizes.m_eval,
+            [&](const uint32_t& candidate) {
+                sizes.m_eval = candidate;
+                apply_workgroup_sizes(sizes);
+            },
+            [&]() {
+                device.QueueEvaluateLayerBatched(tensor.get(), input.get(), output.get(), ActivationFunction::Sigmoid, input_count, neuron_count, 1, 0);
+                device.QueueEvaluateLayerBatched(tensor.get(), input.get(), output.get(), ActivationFunction::Sigmoid, input_count, neuron_count, batch_size, 0);
+            });
+    }
+
+    // Forward and backward pass of training
+    {
+        constexpr uint32_t input_count = 256;
+        constexpr uint32_t neuron_count = 256;
+        constexpr uint32_t sample_count = 64;
+
+        const DenseLayout layout{.m_num_neurons = neuron_count, .m_weights_per_neuron = input_count};
+        auto tensor = device.CreateBuffer(size_t(layout.GetElementCount()) * sizeof(float), BufferUsage::ReadOnly, "tuning_tensor");
+        auto prev_activations = device.CreateBuffer(size_t(sample_count) * input_count * sizeof(float), BufferUsage::ReadOnly, "tuning_prev_activations");
+        auto activations = device.CreateBuffer(size_t(sample_count) * neuron_count * sizeof(float), BufferUsage::ReadWrite, "tuning_activations");
+        auto zvalues = device.CreateBuffer(size_t(sample_count) * neuron_count * sizeof(float), BufferUsage::ReadWrite, "tuning_zvalues");
+        auto desired_output = device.CreateBuffer(size_t(sample_count) * neuron_count * sizeof(float), BufferUsage::ReadOnly, "tuning_desired_output");
+        auto delta_k = device.CreateBuffer(size_t(sample_count) * neuron_count * sizeof(float), BufferUsage::ReadWrite, "tuning_delta_k");
+        device.QueueFillBuffer(tensor.get(), 0, 0, tensor->GetSize());
+        device.QueueFillBuffer(prev_activations.get(), 0, 0, prev_activations->GetSize());
+        device.QueueFillBuffer(desired_output.get(), 0, 0, desired_output->GetSize());
+
+        const auto training_size = SelectFastest<std::pair<uint32_t, uint32_t>>(
+            device, training_candidates, {sizes.m_training_x, sizes.m_training_y},
+            [&](const std::pair<uint32_t, uint32_t>& candidate) {
+                sizes.m_training_x = candidate.first;
+                sizes.m_training_y = candidate.second;
+                apply_workgroup_sizes(sizes);
+            },
+            [&]() {
+                device.QueueTrainForwardPass(tensor.get(), prev_activations.get(), activations.get(), zvalues.get(), ActivationFunction::Sigmoid, neuron_count, input_count, sample_count);
+                device.QueueTrainBackwardPass(true, desired_output.get(), activations.get(), zvalues.get(), delta_k.get(), delta_k.get(), neuron_count, ActivationFunction::Sigmoid, sample_count,
+                                              CostFunction::MeanSquared, 0);
+            });
+        sizes.m_training_x = training_size.first;
+        sizes.m_training_y = training_size.second;
+    }
+
+    // Element-wise kernels (gradient apply, mutation, crossover)
+    {
+        constexpr uint32_t neuron_count = 1024;
+        constexpr uint32_t weights_per_neuron = 1023;
+
+        const DenseLayout layout{.m_num_neurons = neuron_count, .m_weights_per_neuron = weights_per_neuron};
+        auto tensor = device.CreateBuffer(size_t(layout.GetElementCount()) * sizeof(float), BufferUsage::ReadWrite, "tuning_tensor");
+        auto gradient = device.CreateBuffer(size_t(layout.GetElementCount()) * sizeof(float), BufferUsage::ReadOnly, "tuning_gradient");
+        device.QueueFillBuffer(tensor.get(), 0, 0, tensor->GetSize());
+        device.QueueFillBuffer(gradient.get(), 0, 0, gradient->GetSize());
+
+        OptimizerParameters optimizer_parameters{};
+        optimizer_parameters.m_optimizer = Optimizer::SGD;
+
+        sizes.m_apply_gradient = SelectFastest<uint32_t>(
+            device, linear_candidates, sizes.m_apply_gradient,
+            [&](const uint32_t& candidate) {
+                sizes.m_apply_gradient = candidate;
+                apply_workgroup_sizes(sizes);
+            },
+            [&]() { device.QueueApplyGradients(tensor.get(), gradient.get(), nullptr, nullptr, neuron_count, weights_per_neuron, optimizer_parameters); });
+    }
+
+    apply_workgroup_sizes(sizes);
+    return sizes;
+}
+
+WorkgroupSizes LoadOrTuneWorkgroupSizes(IComputeDevice& device, const nlohmann::json& device_config, const std::string& device_key, const WorkgroupSizes& default_sizes,
+                                        const WorkgroupSizeLimits& limits, const std::function<void(const WorkgroupSizes&)>& apply_workgroup_sizes)
+{
+    WorkgroupSizes sizes = default_sizes;
+
+    const auto cache_directory = GetCacheDirectory(device_config);
+
+    std::optional<WorkgroupSizes> cached_sizes;
+    if (cache_directory) {
+        const auto cache = ReadWorkgroupSizesCache(*cache_directory);
+        if (cache.contains(device_key)) {
+            cached_sizes = ParseWorkgroupSizes(cache[device_key]);
+        }
+    }
+
+    // An entry that doesn't fit the device is tuned again, and overwritten with the new results
+    if (cached_sizes && !AreWorkgroupSizesValid(*cached_sizes, limits)) {
+        cached_sizes.reset();
+    }
+
+    if (cached_sizes) {
+        sizes = *cached_sizes;
+    } else if (GetBoolFlagFromJson(device_config, "autotune_workgroup_sizes", true)) {
+        sizes = TuneWorkgroupSizes(device, default_sizes, limits, apply_workgroup_sizes);
+
+        if (cache_directory) {
+            // Re-read the cache right before writing, to keep the entries that other processes added in the meantime
+            auto cache = ReadWorkgroupSizesCache(*cache_directory);
+            cache[device_key] = {{"eval", sizes.m_eval}, {"training_x", sizes.m_training_x}, {"training_y", sizes.m_training_y}, {"apply_gradient", sizes.m_apply_gradient}};
+            const auto cache_str = cache.dump(4);
+            WriteCacheFile(*cache_directory / workgroup_sizes_cache_file_name, std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(cache_str.data()), cache_str.size()));
+        }
+    }
+
+    // Sizes set explicitly in the device config take precedence, unless they don't fit the device, then the tuned sizes are kept
+    const uint32_t eval_size = GetIntFromJson(device_config, "eval_threadgroup_size", sizes.m_eval);
+    if (IsLinearWorkgroupSizeValid(eval_size, limits)) {
+        sizes.m_eval = eval_size;
+    }
+
+    const uint32_t training_size_x = GetIntFromJson(device_config, "training_threadgroup_size_x", sizes.m_training_x);
+    const uint32_t training_size_y = GetIntFromJson(device_config, "training_threadgroup_size_y", sizes.m_training_y);
+    if (IsTrainingWorkgroupSizeValid(training_size_x, training_size_y, limits)) {
+        sizes.m_training_x = training_size_x;
+        sizes.m_training_y = training_size_y;
+    }
+
+    const uint32_t apply_gradient_size = GetIntFromJson(device_config, "gradient_apply_threadgroup_size", sizes.m_apply_gradient);
+    if (IsLinearWorkgroupSizeValid(apply_gradient_size, limits)) {
+        sizes.m_apply_gradient = apply_gradient_size;
+    }
+
+    apply_workgroup_sizes(sizes);
+    return sizes;
+}
+
+} // namespace macademy
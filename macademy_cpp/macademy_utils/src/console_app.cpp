@@ -164,6 +164,78 @@ ConsoleApp::ConsoleApp()
         return false;
     };
 
+    m_commands["benchmark_device_startup"].m_description = "Measure the creation time of the currently selected device [repeat count] times, with and without the kernel caches";
+    m_commands["benchmark_device_startup"].m_handler = [this](const std::vector<std::string>& args) {
+        const uint32_t repeat_count = args.size() > 1 ? uint32_t(std::max(1ul, std::stoul(args[1]))) : 5;
+
+        const auto measure_startup = [&](const nlohmann::json& device_config) {
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < repeat_count; ++i) {
+                ComputeDeviceFactory::CreateComputeDevice(m_selected_device_info, device_config);
+            }
+            auto end = std::chrono::steady_clock::now();
+            return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / repeat_count;
+        };
+
+        std::cout << "Measuring startup time of device: " << m_selected_device_info.m_device_name << std::endl;
+
+        // Autotuning is disabled without the cache, otherwise it would be measured too
+        const auto uncached_time = measure_startup(nlohmann::json{{"cache_directory", ""}, {"autotune_workgroup_sizes", false}});
+        std::cout << "Startup time without cache: " << uncached_time << "us" << std::endl;
+
+        // The first creation fills the cache
+        ComputeDeviceFactory::CreateComputeDevice(m_selected_device_info);
+        const auto cached_time = measure_startup(nlohmann::json::object());
+        std::cout << "Startup time with cache: " << cached_time << "us" << std::endl;
+
+        return false;
+    };
+
+    m_commands["benchmark_population"].m_description = "Compare evaluating a population of [population size] small networks one by one and as a single batch";
+    m_commands["benchmark_population"].m_handler = [this](const std::vector<std::string>& args) {
+        if (!m_compute_device) {
+            std::cout << "No selected device!";
+            return false;
+        }
+
+        const uint32_t population_size = args.size() > 1 ? uint32_t(std::stoul(args[1])) : 256;
+
+        macademy::XavierWeightInitializer weight_initializer{};
+        std::vector<macademy::LayerConfig> layers;
+        layers.emplace_back(LayerConfig{.m_activation_function = macademy::ActivationFunction::Tanh, .m_num_neurons = 32});
+        layers.emplace_back(LayerConfig{.m_activation_function = macademy::ActivationFunction::Tanh, .m_num_neurons = 32});
+        layers.emplace_back(LayerConfig{.m_activation_function = macademy::ActivationFunction::Tanh, .m_num_neurons = 4});
+        auto network = BuildSequentialNetwork("benchmark_population", 16, layers, weight_initializer);
+
+        std::vector<float> inputs{};
+        inputs.reserve(population_size * network->GetInputCount());
+        for (uint32_t i = 0; i < population_size * network->GetInputCount(); ++i) {
+            inputs.emplace_back(float(i % network->GetInputCount()) / (network->GetInputCount() - 1));
+        }
+
+        std::cout << "Running population benchmark with " << population_size << " networks on device: " << m_compute_device->GetDeviceName() << std::endl;
+
+        std::vector<std::unique_ptr<NetworkResourceHandle>> network_resources;
+        for (uint32_t i = 0; i < population_size; ++i) {
+            network_resources.emplace_back(std::make_unique<NetworkResourceHandle>(*network, *m_compute_device));
+        }
+        PopulationResourceHandle population(*network, population_size, *m_compute_device);
+
+        auto start = std::chrono::system_clock::now();
+        for (uint32_t i = 0; i < population_size; ++i) {
+            m_compute_tasks.Evaluate(*network_resources[i], std::span<const float>(inputs.data() + i * network->GetInputCount(), network->GetInputCount()));
+        }
+        auto end = std::chrono::system_clock::now();
+        std::cout << "Evaluation time one by one: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << "us" << std::endl;
+
+        start = std::chrono::system_clock::now();
+        m_compute_tasks.EvaluatePopulation(population, inputs);
+        end = std::chrono::system_clock::now();
+        std::cout << "Evaluation time as a population: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << "us" << std::endl;
+
+        return false;
+    };
+
     m_commands["export"].m_description = "Export a neural network to file";
     m_commands["export"].m_handler = [this](const std::vector<std::string>& args) {
         if (!m_network) {
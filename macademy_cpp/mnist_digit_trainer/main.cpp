@@ -68,12 +68,12 @@ class MnistTrainerApp : public ConsoleApp
     {
         std::vector<macademy::LayerConfig> layers;
         layers.emplace_back(macademy::LayerConfig{.m_activation_function = macademy::ActivationFunction::Sigmoid, .m_num_neurons = 24});
-        layers.emplace_back(macademy::LayerConfig{.m_activation_function = macademy::ActivationFunction::Sigmoid, .m_num_neurons = 10});
+        layers.emplace_back(macademy::LayerConfig{.m_activation_function = macademy::ActivationFunction::Softmax, .m_num_neurons = 10});
         m_network = BuildSequentialNetwork("MNIST digit recognizer", img_dimension * img_dimension, layers, XavierWeightInitializer{});
 
         m_training_suite = std::make_shared<TrainingSuite>();
         m_training_suite->m_mini_batch_size = 100;
-        m_training_suite->m_cost_function = CostFunction::CrossEntropy_Sigmoid;
+        m_training_suite->m_cost_function = CostFunction::CrossEntropy_Softmax;
         m_training_suite->m_regularization = Regularization::L2;
         m_training_suite->m_learning_rate = 0.005f;
         m_training_suite->m_shuffle_training_data = true;
@@ -185,6 +185,84 @@ class MnistTrainerApp : public ConsoleApp
             return false;
         };
 
+        m_commands["benchmark_optimizers"].m_description = "Compare the training time needed by each optimizer to reach [target accuracy %] on the test dataset in at most [max epochs]";
+        m_commands["benchmark_optimizers"].m_handler = [this](const std::vector<std::string>& args) {
+            float target_accuracy = 90.0f;
+            uint32_t max_epochs = 20;
+            for (int i = 1; i < args.size(); ++i) {
+                switch (i) {
+                case 1:
+                    target_accuracy = atof(args[i].c_str());
+                    break;
+                case 2:
+                    max_epochs = atoi(args[i].c_str());
+                    break;
+                }
+            }
+
+            struct OptimizerBenchmark
+            {
+                std::string m_name;
+                Optimizer m_optimizer;
+                float m_learning_rate;
+            };
+
+            const std::vector<OptimizerBenchmark> benchmarks{
+                {"SGD", Optimizer::SGD, m_training_suite->m_learning_rate},
+                {"Momentum", Optimizer::Momentum, m_training_suite->m_learning_rate},
+                {"Nesterov", Optimizer::Nesterov, m_training_suite->m_learning_rate},
+                {"Adam", Optimizer::Adam, 0.001f},
+                {"AdamW", Optimizer::AdamW, 0.001f},
+            };
+
+            for (const auto& benchmark : benchmarks) {
+                // every optimizer starts from the same weights
+                Network network{m_network->GetName(), m_network->GetInputCount(), m_network->GetLayers()};
+                NetworkResourceHandle network_resources{network, *m_compute_device};
+
+                TrainingSuite& training_suite = *m_training_suite;
+                const auto original_optimizer = training_suite.m_optimizer;
+                const auto original_learning_rate = training_suite.m_learning_rate;
+                training_suite.m_optimizer = benchmark.m_optimizer;
+                training_suite.m_learning_rate = benchmark.m_learning_rate;
+
+                std::chrono::milliseconds training_time{0};
+                float accuracy = 0.0f;
+                uint32_t epoch = 0;
+
+                // The minibatches are trained directly, so the optimizer state is kept between the epochs while the accuracy is tested
+                const uint64_t mini_batch_size = training_suite.m_mini_batch_size ? *training_suite.m_mini_batch_size : training_suite.m_training_data.size();
+                network_resources.AllocateTrainingResources(training_suite);
+
+                while (epoch < max_epochs && accuracy < target_accuracy) {
+                    auto time_begin = std::chrono::high_resolution_clock::now();
+
+                    for (uint64_t i = 0; i < training_suite.m_training_data.size(); i += mini_batch_size) {
+                        m_compute_tasks.TrainMinibatch(network_resources, training_suite, i, std::min(i + mini_batch_size, uint64_t(training_suite.m_training_data.size())));
+                    }
+
+                    training_time += duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - time_begin);
+                    ++epoch;
+
+                    accuracy = (float(TestNetwork(network_resources)) / m_test_data.size()) * 100.0f;
+                    std::cout << "\r" << benchmark.m_name << ": epoch " << epoch << ", accuracy: " << accuracy << "%          ";
+                    std::cout.flush();
+                }
+
+                std::cout << "\r" << benchmark.m_name << ": ";
+                if (accuracy >= target_accuracy) {
+                    std::cout << "reached " << accuracy << "% in " << epoch << " epochs, training time: " << training_time.count() << "ms" << std::endl;
+                } else {
+                    std::cout << "did not reach the target accuracy in " << epoch << " epochs (" << accuracy << "%), training time: " << training_time.count() << "ms" << std::endl;
+                }
+
+                training_suite.m_optimizer = original_optimizer;
+                training_suite.m_learning_rate = original_learning_rate;
+            }
+
+            return false;
+        };
+
         m_commands["test"].m_description = "Test on the 10k test dataset";
         m_commands["test"].m_handler = [this](const std::vector<std::string>& args) {
             EnsureNetworkResources();
@@ -12,6 +12,13 @@
 #include "compute_device_factory.h"
 #include "compute_tasks.h"
 #include "utils.h"
+#include "workgroup_tuner.h"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
 
 using namespace macademy;
 
@@ -90,7 +97,7 @@ class ComputeDevicesTest : public ::testing::Test
         auto test_device = [activation_fnc](IComputeDevice& compute_device) {
             const uint32_t prev_layer_num_neurons = 5;
             const uint32_t num_neurons = 10;
-            const uint32_t num_weights = (prev_layer_num_neurons + 1) * num_neurons;
+            const uint32_t num_weights = DenseLayout{.m_num_neurons = num_neurons, .m_weights_per_neuron = prev_layer_num_neurons}.GetElementCount();
             const uint32_t num_training_samples = 5;
 
             auto tensor_buffer = compute_device.CreateBuffer(num_weights * sizeof(float), BufferUsage::ReadWrite, "tensor");
@@ -136,51 +143,392 @@ class ComputeDevicesTest : public ::testing::Test
         }
     }
 
-    void TestApplyGradient(const ComputeDeviceInfo& device_info, float regularization_term_1, float regularization_term_2, float normalized_learning_rate)
+    void TestApplyGradient(const ComputeDeviceInfo& device_info, const OptimizerParameters& optimizer_parameters)
     {
         auto reference_device = ComputeDeviceFactory::CreateComputeDevice(CPUComputeDevice::GetCpuComputeDeviceInfo());
         auto compute_device = ComputeDeviceFactory::CreateComputeDevice(device_info);
 
-        auto test_device = [regularization_term_1, regularization_term_2, normalized_learning_rate](IComputeDevice& compute_device) {
+        auto test_device = [&optimizer_parameters](IComputeDevice& compute_device) {
             const uint32_t prev_layer_num_neurons = 5;
             const uint32_t num_neurons = 10;
-            const uint32_t num_weights = (prev_layer_num_neurons + 1) * num_neurons;
-            const uint32_t num_training_samples = 5;
+            const uint32_t num_weights = DenseLayout{.m_num_neurons = num_neurons, .m_weights_per_neuron = prev_layer_num_neurons}.GetElementCount();
 
             auto tensor_buffer = compute_device.CreateBuffer(num_weights * sizeof(float), BufferUsage::ReadWrite, "tensor");
             auto gradient_buffer = compute_device.CreateBuffer(num_weights * sizeof(float), BufferUsage::ReadWrite, "prev_activations");
+            auto moment1_buffer = compute_device.CreateBuffer(num_weights * sizeof(float), BufferUsage::ReadWrite, "moment1");
+            auto moment2_buffer = compute_device.CreateBuffer(num_weights * sizeof(float), BufferUsage::ReadWrite, "moment2");
 
             std::vector<float> weights{};
             std::vector<float> gradients{};
+            std::vector<float> moment1{};
+            std::vector<float> moment2{};
             for (int i = 0; i < num_weights; ++i) {
                 weights.emplace_back(fmod(weights.size() * 13412.3231341f, 2.5213f) - 0.0356f * weights.size() - 1.2421f);
                 gradients.emplace_back(fmod(gradients.size() * 1342.3231341f, 2.0f) - 1.0f);
+                moment1.emplace_back(fmod(moment1.size() * 342.3231341f, 0.2f) - 0.1f);
+                moment2.emplace_back(fmod(moment2.size() * 42.3231341f, 0.01f));
             }
 
             compute_device.QueueWriteToBuffer(tensor_buffer.get(), ToReadOnlyUi8Span(weights), 0);
             compute_device.QueueWriteToBuffer(gradient_buffer.get(), ToReadOnlyUi8Span(gradients), 0);
+            compute_device.QueueWriteToBuffer(moment1_buffer.get(), ToReadOnlyUi8Span(moment1), 0);
+            compute_device.QueueWriteToBuffer(moment2_buffer.get(), ToReadOnlyUi8Span(moment2), 0);
 
-            compute_device.QueueApplyGradients(tensor_buffer.get(), gradient_buffer.get(), num_neurons, prev_layer_num_neurons, regularization_term_1, regularization_term_2, normalized_learning_rate);
+            // Two steps, so the second one works on the moments updated by the first one
+            for (int i = 0; i < 2; ++i) {
+                compute_device.QueueApplyGradients(tensor_buffer.get(), gradient_buffer.get(), moment1_buffer.get(), moment2_buffer.get(), num_neurons, prev_layer_num_neurons,
+                                                   optimizer_parameters);
+            }
 
             compute_device.QueueReadFromBuffer(tensor_buffer.get(), ToWriteableUi8Span(weights), 0);
+            compute_device.QueueReadFromBuffer(moment1_buffer.get(), ToWriteableUi8Span(moment1), 0);
+            compute_device.QueueReadFromBuffer(moment2_buffer.get(), ToWriteableUi8Span(moment2), 0);
 
             compute_device.SubmitQueue();
             compute_device.WaitQueueIdle();
-            return weights;
+            return std::make_tuple(weights, moment1, moment2);
         };
 
-        auto reference_weights = test_device(*reference_device);
-        auto test_weights = test_device(*compute_device);
+        auto [reference_weights, reference_moment1, reference_moment2] = test_device(*reference_device);
+        auto [test_weights, test_moment1, test_moment2] = test_device(*compute_device);
+
+        ASSERT_EQ(reference_weights.size(), test_weights.size());
+        for (size_t i = 0; i < reference_weights.size(); i++) {
+            EXPECT_NEAR(reference_weights[i], test_weights[i], 0.0001f);
+            EXPECT_NEAR(reference_moment1[i], test_moment1[i], 0.0001f);
+            EXPECT_NEAR(reference_moment2[i], test_moment2[i], 0.0001f);
+        }
+    }
+
+    void TestOptimizers(const ComputeDeviceInfo& device_info)
+    {
+        TestApplyGradient(device_info, OptimizerParameters{.m_learning_rate = 0.0001f});
+        TestApplyGradient(device_info, OptimizerParameters{.m_learning_rate = 0.0001f, .m_regularization_term_2 = 0.25f});
+        TestApplyGradient(device_info, OptimizerParameters{.m_optimizer = Optimizer::Momentum, .m_learning_rate = 0.001f, .m_regularization_term_1 = 0.99f, .m_beta1 = 0.9f});
+        TestApplyGradient(device_info, OptimizerParameters{.m_optimizer = Optimizer::Nesterov, .m_learning_rate = 0.001f, .m_beta1 = 0.9f});
+        TestApplyGradient(device_info, OptimizerParameters{.m_optimizer = Optimizer::Adam,
+                                                           .m_learning_rate = 0.001f,
+                                                           .m_gradient_scale = 0.2f,
+                                                           .m_l2_gradient_term = 0.01f,
+                                                           .m_beta1 = 0.9f,
+                                                           .m_beta2 = 0.999f,
+                                                           .m_epsilon = 1e-8f,
+                                                           .m_bias_correction_1 = 10.0f,
+                                                           .m_bias_correction_2 = 1000.0f});
+        TestApplyGradient(device_info, OptimizerParameters{.m_optimizer = Optimizer::AdamW,
+                                                           .m_learning_rate = 0.001f,
+                                                           .m_gradient_scale = 0.2f,
+                                                           .m_regularization_term_1 = 0.9999f,
+                                                           .m_l1_gradient_term = 0.01f,
+                                                           .m_beta1 = 0.9f,
+                                                           .m_beta2 = 0.999f,
+                                                           .m_epsilon = 1e-8f,
+                                                           .m_bias_correction_1 = 5.0f,
+                                                           .m_bias_correction_2 = 500.0f});
+    }
+
+    std::vector<float> ApplyMutation(IComputeDevice& compute_device, uint32_t num_neurons, uint32_t weights_per_neuron, const MutationParameters& mutation_parameters,
+                                     uint32_t tensor_count = 1)
+    {
+        const uint32_t num_weights = DenseLayout{.m_num_neurons = num_neurons, .m_weights_per_neuron = weights_per_neuron}.GetTensorStride() * tensor_count;
+
+        auto tensor_buffer = compute_device.CreateBuffer(num_weights * sizeof(float), BufferUsage::ReadWrite, "tensor");
+
+        std::vector<float> weights(num_weights, 0.0f);
+        compute_device.QueueWriteToBuffer(tensor_buffer.get(), ToReadOnlyUi8Span(weights), 0);
+        compute_device.QueueApplyMutation(tensor_buffer.get(), num_neurons, weights_per_neuron, tensor_count, mutation_parameters);
+        compute_device.QueueReadFromBuffer(tensor_buffer.get(), ToWriteableUi8Span(weights), 0);
+
+        compute_device.SubmitQueue();
+        compute_device.WaitQueueIdle();
+        return weights;
+    }
+
+    void TestApplyMutation(const ComputeDeviceInfo& device_info)
+    {
+        auto reference_device = ComputeDeviceFactory::CreateComputeDevice(CPUComputeDevice::GetCpuComputeDeviceInfo());
+        auto compute_device = ComputeDeviceFactory::CreateComputeDevice(device_info);
+
+        const MutationParameters mutation_parameters{.m_seed = 0x1234567890abcdefULL,
+                                                     .m_stream = 3,
+                                                     .m_weight_distribution = RandomDistribution::Gaussian,
+                                                     .m_weight_scale = 0.5f,
+                                                     .m_bias_distribution = RandomDistribution::Uniform,
+                                                     .m_bias_scale = 0.25f};
+
+        const auto reference_weights = ApplyMutation(*reference_device, 37, 21, mutation_parameters, 3);
+        const auto test_weights = ApplyMutation(*compute_device, 37, 21, mutation_parameters, 3);
 
         ASSERT_EQ(reference_weights.size(), test_weights.size());
+        const DenseLayout layout{.m_num_neurons = 37, .m_weights_per_neuron = 21};
         for (size_t i = 0; i < reference_weights.size(); i++) {
             EXPECT_NEAR(reference_weights[i], test_weights[i], 0.0001f);
+            if (i % layout.GetTensorStride() >= layout.GetElementCount()) {
+                EXPECT_EQ(test_weights[i], 0.0f); // the padding between the tensors is never mutated
+            }
+        }
+    }
+
+    void TestConcurrentEvaluation(const ComputeDeviceInfo& device_info)
+    {
+        // Multiple threads evaluate different inputs on the same network handle, each result must match the single threaded result
+        auto compute_device = ComputeDeviceFactory::CreateComputeDevice(device_info);
+        auto network_resources = std::make_unique<NetworkResourceHandle>(*m_network, *compute_device);
+
+        constexpr uint32_t num_threads = 8;
+        constexpr uint32_t evaluations_per_thread = 4;
+
+        std::vector<std::vector<float>> inputs;
+        std::vector<std::vector<float>> reference_results;
+        for (uint32_t i = 0; i < num_threads; ++i) {
+            inputs.emplace_back(std::vector<float>{float(i), -2, 3, -10, 10 - float(i)});
+            reference_results.emplace_back(m_compute_tasks.Evaluate(*network_resources, inputs.back()));
+        }
+
+        std::vector<std::vector<std::vector<float>>> results(num_threads);
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < num_threads; ++i) {
+            threads.emplace_back([&, i]() {
+                for (uint32_t j = 0; j < evaluations_per_thread; ++j) {
+                    results[i].emplace_back(m_compute_tasks.Evaluate(*network_resources, inputs[i]));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (uint32_t i = 0; i < num_threads; ++i) {
+            ASSERT_EQ(results[i].size(), evaluations_per_thread);
+            for (const auto& result : results[i]) {
+                EXPECT_EQ(reference_results[i], result);
+            }
+        }
+    }
+
+    void TestPopulation(const ComputeDeviceInfo& device_info)
+    {
+        // Checks batched population evaluation against evaluating each member one by one, and that crossover children only inherit whole neurons of their parents
+        auto compute_device = ComputeDeviceFactory::CreateComputeDevice(device_info);
+
+        std::vector<LayerConfig> layers;
+        layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::ReLU, .m_num_neurons = 17});
+        layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Tanh, .m_num_neurons = 9});
+        layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = 3});
+        auto network = BuildSequentialNetwork("population", 5, std::span<LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
+        auto member_network = BuildSequentialNetwork("member", 5, std::span<LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
+
+        const uint32_t population_size = 7;
+        PopulationResourceHandle population(*network, population_size, *compute_device);
+        m_compute_tasks.ApplyRandomMutation(population, GaussianDistribution{0.5f}, UniformDistribution{0.1f}, 1234);
+
+        std::vector<float> inputs;
+        for (uint32_t i = 0; i < population_size * network->GetInputCount(); ++i) {
+            inputs.emplace_back(fmod(i * 1342.3231341f, 2.0f) - 1.0f);
+        }
+
+        const auto results = m_compute_tasks.EvaluatePopulation(population, inputs);
+        ASSERT_EQ(results.size(), population_size * network->GetOutputCount());
+
+        std::vector<std::vector<float>> members;
+        for (uint32_t m = 0; m < population_size; ++m) {
+            population.ReadMember(m, *member_network);
+            members.emplace_back();
+            for (const auto& layer : member_network->GetLayers()) {
+                const auto weights = layer.m_tensor->AsFloat32();
+                members.back().insert(members.back().end(), weights.begin(), weights.end());
+            }
+
+            NetworkResourceHandle member_resources(*member_network, *compute_device);
+            const auto member_result = m_compute_tasks.Evaluate(member_resources, std::span<const float>(inputs.data() + m * network->GetInputCount(), network->GetInputCount()));
+            for (uint32_t i = 0; i < member_result.size(); ++i) {
+                EXPECT_NEAR(member_result[i], results[m * network->GetOutputCount() + i], 1e-5);
+            }
+        }
+        EXPECT_NE(members[0], members[1]);
+
+        std::vector<std::pair<uint32_t, uint32_t>> parents;
+        for (uint32_t m = 0; m < population_size; ++m) {
+            parents.emplace_back(m, (m + 3) % population_size);
+        }
+        m_compute_tasks.Crossover(population, parents, 42);
+
+        for (uint32_t m = 0; m < population_size; ++m) {
+            population.ReadMember(m, *member_network);
+
+            size_t offset = 0;
+            for (uint32_t l = 0; l < member_network->GetLayerCount(); ++l) {
+                const auto& layer = member_network->GetLayers()[l];
+                const auto& layout = layer.m_tensor->GetLayout();
+                const float* child = layer.m_tensor->AsFloat32().data();
+                for (uint32_t n = 0; n < layer.m_num_neurons; ++n) {
+                    const auto inherits_neuron = [&](uint32_t parent_id) {
+                        const float* parent = members[parent_id].data() + offset;
+                        return std::equal(child + layout.GetWeightIndex(n, 0), child + layout.GetWeightIndex(n, layout.m_weights_per_neuron), parent + layout.GetWeightIndex(n, 0)) &&
+                               child[layout.GetBiasIndex(n)] == parent[layout.GetBiasIndex(n)];
+                    };
+                    EXPECT_TRUE(inherits_neuron(parents[m].first) || inherits_neuron(parents[m].second));
+                }
+                offset += layer.m_tensor->GetElementSize();
+            }
+        }
+    }
+
+    void TestMapBuffer(const ComputeDeviceInfo& device_info)
+    {
+        auto compute_device = ComputeDeviceFactory::CreateComputeDevice(device_info);
+
+        constexpr uint32_t element_count = 1000;
+        auto buffer = compute_device->CreateBuffer(element_count * sizeof(float), BufferUsage::ReadWrite, "mapped");
+
+        // The buffer is filled in place, and read back with a copy
+        auto mapped_data = compute_device->MapBuffer(buffer.get(), BufferUsage::WriteOnly, 0, element_count * sizeof(float));
+        ASSERT_EQ(mapped_data.size(), element_count * sizeof(float));
+        float* values = reinterpret_cast<float*>(mapped_data.data());
+        for (uint32_t i = 0; i < element_count; ++i) {
+            values[i] = float(i) * 0.5f;
+        }
+        compute_device->UnmapBuffer(buffer.get());
+
+        std::vector<float> result(element_count);
+        compute_device->QueueReadFromBuffer(buffer.get(), ToWriteableUi8Span(result), 0);
+        compute_device->SubmitQueue();
+        compute_device->WaitQueueIdle();
+        for (uint32_t i = 0; i < element_count; ++i) {
+            EXPECT_EQ(result[i], float(i) * 0.5f);
+        }
+
+        // The queued write is finished before the mapped range is accessible
+        const std::vector<float> written(100, 7.0f);
+        compute_device->QueueWriteToBuffer(buffer.get(), ToReadOnlyUi8Span(written), 200 * sizeof(float));
+        const auto mapped_range = compute_device->MapBuffer(buffer.get(), BufferUsage::ReadOnly, 100 * sizeof(float), 200 * sizeof(float));
+        const float* range_values = reinterpret_cast<const float*>(mapped_range.data());
+        for (uint32_t i = 0; i < 100; ++i) {
+            EXPECT_EQ(range_values[i], float(i + 100) * 0.5f);
+            EXPECT_EQ(range_values[i + 100], 7.0f);
+        }
+        compute_device->UnmapBuffer(buffer.get());
+    }
+
+    void TestCalculateGradient(const ComputeDeviceInfo& device_info)
+    {
+        // Checks the gradient reduction against a reference calculated on the host. The sizes are not multiples of the tile sizes used by the GPU kernels.
+        auto compute_device = ComputeDeviceFactory::CreateComputeDevice(device_info);
+
+        const uint32_t prev_layer_num_neurons = 21;
+        const uint32_t num_neurons = 37;
+        const DenseLayout layout{.m_num_neurons = num_neurons, .m_weights_per_neuron = prev_layer_num_neurons};
+        const uint32_t num_weights = layout.GetElementCount();
+        const uint32_t num_training_samples = 45;
+
+        auto delta_k_buffer = compute_device->CreateBuffer(num_training_samples * num_neurons * sizeof(float), BufferUsage::ReadWrite, "delta_k");
+        auto prev_activations_buffer = compute_device->CreateBuffer(num_training_samples * prev_layer_num_neurons * sizeof(float), BufferUsage::ReadWrite, "prev_activations");
+        auto gradient_buffer = compute_device->CreateBuffer(num_weights * sizeof(float), BufferUsage::ReadWrite, "gradient");
+
+        std::vector<float> delta_k{};
+        for (uint32_t i = 0; i < num_training_samples * num_neurons; ++i) {
+            delta_k.emplace_back(fmod(delta_k.size() * 1342.3231341f, 2.0f) - 1.0f);
+        }
+        std::vector<float> prev_activations{};
+        for (uint32_t i = 0; i < num_training_samples * prev_layer_num_neurons; ++i) {
+            prev_activations.emplace_back(fmod(prev_activations.size() * 13412.3231341f, 1.0f));
+        }
+        std::vector<float> gradients{};
+        for (uint32_t i = 0; i < num_weights; ++i) {
+            gradients.emplace_back(fmod(gradients.size() * 3412.3231341f, 0.5f)); // the kernel accumulates into the existing gradient
+        }
+
+        std::vector<float> reference_gradients = gradients;
+        for (uint32_t n = 0; n < num_neurons; ++n) {
+            for (uint32_t w = 0; w <= prev_layer_num_neurons; ++w) {
+                double acc = 0.0;
+                for (uint32_t s = 0; s < num_training_samples; ++s) {
+                    const double activation = w == prev_layer_num_neurons ? 1.0 : prev_activations[s * prev_layer_num_neurons + w];
+                    acc += delta_k[s * num_neurons + n] * activation;
+                }
+                reference_gradients[w == prev_layer_num_neurons ? layout.GetBiasIndex(n) : layout.GetWeightIndex(n, w)] += float(acc);
+            }
+        }
+
+        compute_device->QueueWriteToBuffer(delta_k_buffer.get(), ToReadOnlyUi8Span(delta_k), 0);
+        compute_device->QueueWriteToBuffer(prev_activations_buffer.get(), ToReadOnlyUi8Span(prev_activations), 0);
+        compute_device->QueueWriteToBuffer(gradient_buffer.get(), ToReadOnlyUi8Span(gradients), 0);
+
+        compute_device->QueueTrainCalculateGradient(delta_k_buffer.get(), prev_activations_buffer.get(), gradient_buffer.get(), num_neurons, prev_layer_num_neurons, num_training_samples);
+
+        compute_device->QueueReadFromBuffer(gradient_buffer.get(), ToWriteableUi8Span(gradients), 0);
+
+        compute_device->SubmitQueue();
+        compute_device->WaitQueueIdle();
+
+        ASSERT_EQ(reference_gradients.size(), gradients.size());
+        for (size_t i = 0; i < reference_gradients.size(); i++) {
+            EXPECT_NEAR(reference_gradients[i], gradients[i], 0.0001f);
         }
     }
 };
 
 TEST_F(ComputeDevicesTest, Utils) { EXPECT_EQ(2048, CalculateLargestLayerNeuronCount(m_network->GetLayers())); }
 
+TEST_F(ComputeDevicesTest, DenseLayout)
+{
+    // Rows are padded to the alignment, the biases follow the weight matrix
+    const DenseLayout layout{.m_num_neurons = 3, .m_weights_per_neuron = 17};
+    EXPECT_EQ(layout.GetRowStride(), 32);
+    EXPECT_EQ(layout.GetWeightIndex(2, 5), 69);
+    EXPECT_EQ(layout.GetBiasIndex(1), 97);
+    EXPECT_EQ(layout.GetElementCount(), 99);
+    EXPECT_EQ(layout.GetTensorStride(), 112);
+    EXPECT_TRUE(layout.IsPadding(17));
+    EXPECT_FALSE(layout.IsPadding(32));
+    EXPECT_TRUE(layout.IsBias(96));
+    EXPECT_EQ(DenseLayout::GetRowStride(16), 16);
+
+    // The exported file stores the weights packed, importing it restores the same network
+    std::stringstream stream;
+    ExportNetworkAsBinary(*m_network, stream);
+    EXPECT_EQ(stream.str().size(), 4 + 4 + m_network->GetName().size() + 4 + 4 + m_network->GetLayerCount() * (4 + 4 + 4 + 8) +
+                                       sizeof(float) * (m_network->GetNeuronCount() + (5 * 4 + 4 * 15 + 15 * 2 + 2 * 2003 + 2003 * 2048 + 2048 * 8)));
+
+    const auto imported = ImportNetworkFromBinary(stream);
+    ASSERT_NE(imported, nullptr);
+    ASSERT_EQ(imported->GetLayerCount(), m_network->GetLayerCount());
+    EXPECT_EQ(imported->GetInputCount(), m_network->GetInputCount());
+    EXPECT_EQ(imported->GetName(), m_network->GetName());
+    for (uint32_t i = 0; i < m_network->GetLayerCount(); ++i) {
+        EXPECT_EQ(imported->GetLayers()[i].m_activation, m_network->GetLayers()[i].m_activation);
+        EXPECT_EQ(imported->GetLayers()[i].m_num_neurons, m_network->GetLayers()[i].m_num_neurons);
+        EXPECT_EQ(imported->GetLayers()[i].m_tensor->m_data, m_network->GetLayers()[i].m_tensor->m_data);
+    }
+}
+
+TEST_F(ComputeDevicesTest, NetworkConstruction)
+{
+    // The weights are generated into the dense layout with zero padding
+    std::vector<Layer> layers;
+    layers.emplace_back(Layer{.m_tensor = GenerateWeights(DType::Float32, XavierWeightInitializer{}, 3, 17), .m_activation = ActivationFunction::Tanh, .m_num_neurons = 3});
+    layers.emplace_back(Layer{.m_tensor = GenerateWeights(DType::Float32, XavierWeightInitializer{}, 2, 3), .m_activation = ActivationFunction::Sigmoid, .m_num_neurons = 2});
+
+    const auto& layout = layers[0].m_tensor->GetLayout();
+    const auto data = layers[0].m_tensor->AsFloat32();
+    ASSERT_EQ(data.size(), layout.GetElementCount());
+    for (uint32_t i = 0; i < layout.GetElementCount(); ++i) {
+        if (layout.IsPadding(i)) {
+            EXPECT_EQ(data[i], 0.0f);
+        }
+    }
+
+    // The span constructor copies the tensors, the vector constructor takes them
+    const Network copied("copied", 17, std::span<const Layer>(layers));
+    EXPECT_NE(copied.GetLayers()[0].m_tensor.get(), layers[0].m_tensor.get());
+    EXPECT_EQ(copied.GetLayers()[0].m_tensor->m_data, layers[0].m_tensor->m_data);
+
+    const Tensor* tensor = layers[1].m_tensor.get();
+    const Network moved("moved", 17, std::move(layers));
+    EXPECT_EQ(moved.GetLayers()[1].m_tensor.get(), tensor);
+    EXPECT_EQ(moved.GetLayers()[0].m_tensor->m_data, copied.GetLayers()[0].m_tensor->m_data);
+}
+
 TEST_F(ComputeDevicesTest, CPUComputeDevice)
 {
     // Checks results to reference values
@@ -210,6 +558,245 @@ TEST_F(ComputeDevicesTest, CPUComputeDevice)
     }
 }
 
+TEST_F(ComputeDevicesTest, CPUComputeDeviceCalculateGradientTest) { TestCalculateGradient(CPUComputeDevice::GetCpuComputeDeviceInfo()); }
+
+TEST_F(ComputeDevicesTest, CPUComputeDeviceMutationTest)
+{
+    auto compute_device = ComputeDeviceFactory::CreateComputeDevice(CPUComputeDevice::GetCpuComputeDeviceInfo());
+
+    const uint32_t num_neurons = 200;
+    const uint32_t weights_per_neuron = 99;
+
+    // Known answer of Philox4x32-10 for a zero counter and key: 0x6627e8d5
+    const auto uniform = ApplyMutation(*compute_device, num_neurons, weights_per_neuron,
+                                       MutationParameters{.m_seed = 0, .m_stream = 0, .m_weight_distribution = RandomDistribution::Uniform, .m_weight_scale = 2.0f});
+    EXPECT_FLOAT_EQ(uniform[0], (2.0f * float(0x6627e8d5u >> 8) / 16777216.0f - 1.0f) * 2.0f);
+
+    const DenseLayout layout{.m_num_neurons = num_neurons, .m_weights_per_neuron = weights_per_neuron};
+
+    double uniform_sum = 0.0;
+    for (uint32_t i = 0; i < uniform.size(); ++i) {
+        if (layout.IsBias(i) || layout.IsPadding(i)) {
+            EXPECT_EQ(uniform[i], 0.0f); // bias scale is zero, the padding is never mutated
+        } else {
+            EXPECT_LE(std::abs(uniform[i]), 2.0f);
+            uniform_sum += uniform[i];
+        }
+    }
+    EXPECT_NEAR(uniform_sum / (num_neurons * weights_per_neuron), 0.0, 0.05);
+
+    const MutationParameters gaussian_parameters{.m_seed = 42, .m_stream = 1, .m_weight_distribution = RandomDistribution::Gaussian, .m_weight_scale = 0.5f,
+                                                 .m_bias_distribution = RandomDistribution::Gaussian, .m_bias_scale = 0.5f};
+    const auto gaussian = ApplyMutation(*compute_device, num_neurons, weights_per_neuron, gaussian_parameters);
+
+    double sum = 0.0, sum_squared = 0.0;
+    for (uint32_t i = 0; i < gaussian.size(); ++i) {
+        if (layout.IsPadding(i)) {
+            EXPECT_EQ(gaussian[i], 0.0f);
+            continue;
+        }
+        sum += gaussian[i];
+        sum_squared += double(gaussian[i]) * gaussian[i];
+    }
+    const double mean = sum / (num_neurons * (weights_per_neuron + 1));
+    EXPECT_NEAR(mean, 0.0, 0.02);
+    EXPECT_NEAR(std::sqrt(sum_squared / (num_neurons * (weights_per_neuron + 1)) - mean * mean), 0.5, 0.02);
+
+    // The same seed and stream always generates the same values, a different stream generates different ones
+    EXPECT_EQ(gaussian, ApplyMutation(*compute_device, num_neurons, weights_per_neuron, gaussian_parameters));
+    auto other_stream_parameters = gaussian_parameters;
+    other_stream_parameters.m_stream = 2;
+    EXPECT_NE(gaussian, ApplyMutation(*compute_device, num_neurons, weights_per_neuron, other_stream_parameters));
+}
+
+TEST_F(ComputeDevicesTest, CPUComputeDeviceConcurrentEvaluationTest) { TestConcurrentEvaluation(CPUComputeDevice::GetCpuComputeDeviceInfo()); }
+
+TEST_F(ComputeDevicesTest, CPUComputeDevicePopulationTest) { TestPopulation(CPUComputeDevice::GetCpuComputeDeviceInfo()); }
+
+TEST_F(ComputeDevicesTest, CPUComputeDeviceMapBufferTest) { TestMapBuffer(CPUComputeDevice::GetCpuComputeDeviceInfo()); }
+
+TEST_F(ComputeDevicesTest, CPUComputeDeviceEvaluateToSpan)
+{
+    auto compute_device = ComputeDeviceFactory::CreateComputeDevice(CPUComputeDevice::GetCpuComputeDeviceInfo());
+    NetworkResourceHandle network_resources(*m_network, *compute_device);
+
+    const std::vector<float> input{1, -2, 3, -10, 10};
+
+    // Reference evaluation on the host, the layers have both small (serial) and large (parallel) sizes, and input counts that are not a multiple of the vector width
+    std::vector<float> expected = input;
+    for (const auto& layer : m_network->GetLayers()) {
+        const DenseLayout layout = layer.m_tensor->GetLayout();
+        const auto weights = layer.m_tensor->AsFloat32();
+        std::vector<float> layer_output(layout.m_num_neurons);
+        for (uint32_t n = 0; n < layout.m_num_neurons; ++n) {
+            double z = weights[layout.GetBiasIndex(n)];
+            for (uint32_t i = 0; i < layout.m_weights_per_neuron; ++i) {
+                z += double(weights[layout.GetWeightIndex(n, i)]) * expected[i];
+            }
+            layer_output[n] = layer.m_activation == ActivationFunction::ReLU ? float(std::max(z, 0.0)) : float(1.0 / (1.0 + std::exp(-z)));
+        }
+        expected = std::move(layer_output);
+    }
+
+    std::vector<float> output(m_network->GetOutputCount());
+    m_compute_tasks.Evaluate(network_resources, input, output);
+
+    ASSERT_EQ(expected.size(), output.size());
+    for (size_t i = 0; i < output.size(); ++i) {
+        EXPECT_NEAR(expected[i], output[i], 1e-4);
+    }
+    EXPECT_EQ(output, m_compute_tasks.Evaluate(network_resources, input));
+
+    std::vector<float> short_output(m_network->GetOutputCount() - 1);
+    EXPECT_THROW(m_compute_tasks.Evaluate(network_resources, input, short_output), std::runtime_error);
+}
+
+TEST_F(ComputeDevicesTest, CPUComputeDevicePreparedForInference)
+{
+    auto compute_device = ComputeDeviceFactory::CreateComputeDevice(CPUComputeDevice::GetCpuComputeDeviceInfo());
+
+    // Batches of 1 to 6 cover the partial sample blocks, the layers with 2, 15 and 2003 neurons the partial panels
+    constexpr uint32_t max_batch_size = 6;
+    std::vector<float> inputs;
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+    for (uint32_t i = 0; i < m_network->GetInputCount() * max_batch_size; ++i) {
+        inputs.emplace_back(dist(gen));
+    }
+
+    for (bool use_arena : {false, true}) {
+        NetworkResourceHandle reference_resources(*m_network, *compute_device, use_arena);
+        NetworkResourceHandle network_resources(*m_network, *compute_device, use_arena);
+        EXPECT_TRUE(network_resources.PrepareForInference());
+        EXPECT_TRUE(network_resources.IsPreparedForInference());
+
+        for (uint32_t batch_size = 1; batch_size <= max_batch_size; ++batch_size) {
+            const auto batch_inputs = std::span<const float>(inputs).first(m_network->GetInputCount() * batch_size);
+            const auto reference = m_compute_tasks.EvaluateBatch(reference_resources, batch_inputs, batch_size);
+            const auto result = m_compute_tasks.EvaluateBatch(network_resources, batch_inputs, batch_size);
+
+            ASSERT_EQ(reference.size(), result.size());
+            for (size_t i = 0; i < result.size(); ++i) {
+                EXPECT_NEAR(reference[i], result[i], 1e-4);
+            }
+        }
+
+        EXPECT_THROW(network_resources.AllocateTrainingResources(1), std::runtime_error);
+        EXPECT_THROW(m_compute_tasks.ApplyRandomMutation(network_resources, UniformDistribution{1.0f}, UniformDistribution{1.0f}), std::runtime_error);
+    }
+
+    // The prepared weights are never read back into the network
+    const auto weights_before = std::vector<float>(m_network->GetLayers()[0].m_tensor->AsFloat32().begin(), m_network->GetLayers()[0].m_tensor->AsFloat32().end());
+    NetworkResourceHandle network_resources(*m_network, *compute_device);
+    network_resources.PrepareForInference();
+    network_resources.SynchronizeNetworkData();
+    const auto weights_after = m_network->GetLayers()[0].m_tensor->AsFloat32();
+    EXPECT_TRUE(std::equal(weights_before.begin(), weights_before.end(), weights_after.begin(), weights_after.end()));
+}
+
+TEST_F(ComputeDevicesTest, CPUComputeDeviceBufferPool)
+{
+    EXPECT_EQ(0, CPUBufferAllocator::GetSizeClass(0));
+    EXPECT_EQ(64, CPUBufferAllocator::GetSizeClass(1));
+    EXPECT_EQ(4096, CPUBufferAllocator::GetSizeClass(4096));
+    EXPECT_EQ(5120, CPUBufferAllocator::GetSizeClass(4097));
+    EXPECT_EQ(10 << 20, CPUBufferAllocator::GetSizeClass((8 << 20) + 1));
+
+    CPUComputeDevice compute_device(nlohmann::json{{"buffer_pool_size_mb", 64}});
+
+    auto network_resources = std::make_unique<NetworkResourceHandle>(*m_network, compute_device);
+    network_resources->AllocateTrainingResources(16, Optimizer::Adam);
+    for (const auto& buffer : network_resources->m_tensor_buffers) {
+        EXPECT_EQ(0, uintptr_t(BufferCast<CPUBuffer>(buffer.get())->m_data.data()) % CPUBufferAllocator::ALIGNMENT);
+    }
+
+    const auto first_run = compute_device.GetAllocationStatistics();
+    EXPECT_EQ(0, first_run.m_pool_hit_count);
+    EXPECT_EQ(first_run.m_allocation_count, first_run.m_system_allocation_count);
+    EXPECT_GT(first_run.m_bytes_in_use, 0);
+
+    // The buffers of the second training run are served from the pool
+    network_resources->FreeCachedResources();
+    network_resources->AllocateTrainingResources(16, Optimizer::Adam);
+    const auto second_run = compute_device.GetAllocationStatistics();
+    EXPECT_EQ(first_run.m_system_allocation_count, second_run.m_system_allocation_count);
+    EXPECT_GT(second_run.m_pool_hit_count, 0);
+    EXPECT_EQ(first_run.m_bytes_in_use, second_run.m_bytes_in_use);
+
+    network_resources.reset();
+    EXPECT_EQ(0, compute_device.GetAllocationStatistics().m_bytes_in_use);
+    EXPECT_GT(compute_device.GetAllocationStatistics().m_bytes_cached, 0);
+    compute_device.ReleaseCachedMemory();
+    EXPECT_EQ(0, compute_device.GetAllocationStatistics().m_bytes_cached);
+    EXPECT_EQ(first_run.m_bytes_in_use, compute_device.GetAllocationStatistics().m_peak_bytes_in_use);
+}
+
+TEST_F(ComputeDevicesTest, WorkgroupTuningCache)
+{
+    // The CPU device ignores the work group sizes, but it can still run the tuning benchmarks
+    auto compute_device = ComputeDeviceFactory::CreateComputeDevice(CPUComputeDevice::GetCpuComputeDeviceInfo());
+
+    const auto cache_directory = std::filesystem::temp_directory_path() / ("macademy_test_cache_" + std::to_string(std::random_device{}()));
+    nlohmann::json device_config = {{"cache_directory", cache_directory.string()}};
+
+    const WorkgroupSizeLimits limits{.m_max_invocations = 128, .m_max_size_x = 64, .m_max_size_y = 64};
+
+    uint32_t apply_count = 0;
+    const auto apply = [&](const WorkgroupSizes& sizes) {
+        ++apply_count;
+        EXPECT_LE(sizes.m_eval, limits.m_max_invocations);
+        EXPECT_LE(sizes.m_training_x * sizes.m_training_y, limits.m_max_invocations);
+        EXPECT_LE(sizes.m_apply_gradient, limits.m_max_invocations);
+    };
+
+    const auto tuned = LoadOrTuneWorkgroupSizes(*compute_device, device_config, "test_device|1.0", WorkgroupSizes{}, limits, apply);
+    EXPECT_GT(apply_count, 1);
+    EXPECT_TRUE(std::filesystem::exists(cache_directory / "workgroup_sizes.json"));
+
+    // The second time the sizes are read from the cache, without benchmarking
+    apply_count = 0;
+    const auto cached = LoadOrTuneWorkgroupSizes(*compute_device, device_config, "test_device|1.0", WorkgroupSizes{}, limits, apply);
+    EXPECT_EQ(apply_count, 1);
+    EXPECT_EQ(tuned.m_eval, cached.m_eval);
+    EXPECT_EQ(tuned.m_training_x, cached.m_training_x);
+    EXPECT_EQ(tuned.m_training_y, cached.m_training_y);
+    EXPECT_EQ(tuned.m_apply_gradient, cached.m_apply_gradient);
+
+    // The sizes in the device config override the cached ones
+    device_config["training_threadgroup_size_y"] = 2;
+    EXPECT_EQ(LoadOrTuneWorkgroupSizes(*compute_device, device_config, "test_device|1.0", WorkgroupSizes{}, limits, apply).m_training_y, 2);
+
+    // Sizes in the device config that don't fit the device are ignored
+    device_config["eval_threadgroup_size"] = 1024;
+    device_config["training_threadgroup_size_x"] = 64;
+    EXPECT_EQ(LoadOrTuneWorkgroupSizes(*compute_device, device_config, "test_device|1.0", WorkgroupSizes{}, limits, apply).m_eval, tuned.m_eval);
+    EXPECT_EQ(LoadOrTuneWorkgroupSizes(*compute_device, device_config, "test_device|1.0", WorkgroupSizes{}, limits, apply).m_training_x, 64);
+    device_config["training_threadgroup_size_y"] = 4;
+    EXPECT_EQ(LoadOrTuneWorkgroupSizes(*compute_device, device_config, "test_device|1.0", WorkgroupSizes{}, limits, apply).m_training_x, tuned.m_training_x);
+    device_config.erase("eval_threadgroup_size");
+    device_config.erase("training_threadgroup_size_x");
+    device_config.erase("training_threadgroup_size_y");
+
+    // Cached sizes that exceed the limits of the device are tuned again
+    {
+        std::ifstream cache_file(cache_directory / "workgroup_sizes.json");
+        auto cache = nlohmann::json::parse(cache_file);
+        cache_file.close();
+        cache["test_device|1.0"]["eval"] = 1024;
+        std::ofstream(cache_directory / "workgroup_sizes.json") << cache.dump();
+    }
+    apply_count = 0;
+    EXPECT_LE(LoadOrTuneWorkgroupSizes(*compute_device, device_config, "test_device|1.0", WorkgroupSizes{}, limits, apply).m_eval, limits.m_max_invocations);
+    EXPECT_GT(apply_count, 1);
+
+    // A different driver version is tuned again
+    apply_count = 0;
+    LoadOrTuneWorkgroupSizes(*compute_device, device_config, "test_device|2.0", WorkgroupSizes{}, limits, apply);
+    EXPECT_GT(apply_count, 1);
+
+    std::filesystem::remove_all(cache_directory);
+}
+
 #ifdef MACADEMY_OPENCL_BACKEND
 TEST_F(ComputeDevicesTest, OpenCLComputeDevice)
 {
@@ -241,6 +828,7 @@ TEST_F(ComputeDevicesTest, OpenCLComputeDeviceForwardPassTest)
         TestForwardPass(it, ActivationFunction::SoftPlus);
         TestForwardPass(it, ActivationFunction::Tanh);
         TestForwardPass(it, ActivationFunction::Threshold);
+        TestForwardPass(it, ActivationFunction::Softmax);
     }
 }
 
@@ -250,8 +838,57 @@ TEST_F(ComputeDevicesTest, OpenCLComputeDeviceGradientApplyTest)
 
     for (const auto& it : opencl_devices) {
         printf("Testing %s\n", it.m_device_name.c_str());
-        TestApplyGradient(it, 1.0f, 0.0f, 0.0001f);
-        TestApplyGradient(it, 1.0f, 0.25f, 0.0001f);
+        TestOptimizers(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, OpenCLComputeDeviceCalculateGradientTest)
+{
+    auto opencl_devices = OpenCLComputeDevice::GetOpenCLComputeDeviceInfo();
+
+    for (const auto& it : opencl_devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestCalculateGradient(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, OpenCLComputeDeviceMutationTest)
+{
+    auto devices = OpenCLComputeDevice::GetOpenCLComputeDeviceInfo();
+
+    for (const auto& it : devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestApplyMutation(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, OpenCLComputeDevicePopulationTest)
+{
+    auto devices = OpenCLComputeDevice::GetOpenCLComputeDeviceInfo();
+
+    for (const auto& it : devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestPopulation(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, OpenCLComputeDeviceMapBufferTest)
+{
+    auto opencl_devices = OpenCLComputeDevice::GetOpenCLComputeDeviceInfo();
+
+    for (const auto& it : opencl_devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestMapBuffer(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, OpenCLComputeDeviceConcurrentEvaluationTest)
+{
+    auto devices = OpenCLComputeDevice::GetOpenCLComputeDeviceInfo();
+
+    for (const auto& it : devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestConcurrentEvaluation(it);
     }
 }
 #endif
@@ -287,6 +924,7 @@ TEST_F(ComputeDevicesTest, VulkanComputeDeviceForwardPassTest)
         TestForwardPass(it, ActivationFunction::SoftPlus);
         TestForwardPass(it, ActivationFunction::Tanh);
         TestForwardPass(it, ActivationFunction::Threshold);
+        TestForwardPass(it, ActivationFunction::Softmax);
     }
 }
 
@@ -296,8 +934,57 @@ TEST_F(ComputeDevicesTest, VulkanComputeDeviceGradientApplyTest)
 
     for (const auto& it : vk_devices) {
         printf("Testing %s\n", it.m_device_name.c_str());
-        TestApplyGradient(it, 1.0f, 0.0f, 0.0001f);
-        TestApplyGradient(it, 1.0f, 0.25f, 0.0001f);
+        TestOptimizers(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, VulkanComputeDeviceCalculateGradientTest)
+{
+    auto vk_devices = VulkanComputeDevice::GetVulkanComputeDeviceInfo();
+
+    for (const auto& it : vk_devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestCalculateGradient(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, VulkanComputeDeviceMutationTest)
+{
+    auto devices = VulkanComputeDevice::GetVulkanComputeDeviceInfo();
+
+    for (const auto& it : devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestApplyMutation(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, VulkanComputeDevicePopulationTest)
+{
+    auto devices = VulkanComputeDevice::GetVulkanComputeDeviceInfo();
+
+    for (const auto& it : devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestPopulation(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, VulkanComputeDeviceMapBufferTest)
+{
+    auto vk_devices = VulkanComputeDevice::GetVulkanComputeDeviceInfo();
+
+    for (const auto& it : vk_devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestMapBuffer(it);
+    }
+}
+
+TEST_F(ComputeDevicesTest, VulkanComputeDeviceConcurrentEvaluationTest)
+{
+    auto devices = VulkanComputeDevice::GetVulkanComputeDeviceInfo();
+
+    for (const auto& it : devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestConcurrentEvaluation(it);
     }
 }
 
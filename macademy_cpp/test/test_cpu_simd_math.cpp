@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "cpu_backend/cpu_simd_math.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace macademy;
+
+namespace {
+// Evaluates the approximation on evenly spaced values of [min, max] with the vector type, and returns the largest error compared to the reference
+template <typename Approx, typename Reference> float MaxError(float min, float max, bool relative, Approx&& approx, Reference&& reference)
+{
+    constexpr size_t sample_count = 100003; // not a multiple of the vector width, so the tail is tested as well
+
+    std::vector<float> values(sample_count);
+    for (size_t i = 0; i < sample_count; ++i) {
+        values[i] = min + (max - min) * float(i) / float(sample_count - 1);
+    }
+
+    std::vector<float> results = values;
+    simd::Transform(results, [&](simd::FloatVec x) { return approx(x); });
+
+    float ret = 0.0f;
+    for (size_t i = 0; i < sample_count; ++i) {
+        const double expected = reference(double(values[i]));
+        double error = std::abs(double(results[i]) - expected);
+        if (relative) {
+            error /= std::max(std::abs(expected), 1e-30);
+        }
+        ret = std::max(ret, float(error));
+
+        // The scalar version uses the same approximation
+        EXPECT_NEAR(results[i], approx(simd::ScalarFloat(values[i])).m_value, 1e-6f * std::max(1.0f, std::abs(results[i])));
+    }
+    return ret;
+}
+} // namespace
+
+TEST(CpuSimdMathTest, Exp)
+{
+    EXPECT_LT(MaxError(-87.0f, 88.0f, true, [](auto x) { return simd::Exp(x); }, [](double x) { return std::exp(x); }), 3e-7f);
+}
+
+TEST(CpuSimdMathTest, Sigmoid)
+{
+    EXPECT_LT(MaxError(-100.0f, 100.0f, false, [](auto x) { return simd::Sigmoid(x); }, [](double x) { return 1.0 / (1.0 + std::exp(-x)); }), 2e-7f);
+}
+
+TEST(CpuSimdMathTest, Tanh)
+{
+    EXPECT_LT(MaxError(-50.0f, 50.0f, false, [](auto x) { return simd::Tanh(x); }, [](double x) { return std::tanh(x); }), 4e-7f);
+}
+
+TEST(CpuSimdMathTest, SoftPlus)
+{
+    EXPECT_LT(MaxError(-80.0f, 80.0f, true, [](auto x) { return simd::SoftPlus(x); }, [](double x) { return std::log1p(std::exp(x)); }), 4e-7f);
+}
+
+TEST(CpuSimdMathTest, ArcTan)
+{
+    EXPECT_LT(MaxError(-1000.0f, 1000.0f, false, [](auto x) { return simd::ArcTan(x); }, [](double x) { return std::atan(x); }), 3e-7f);
+    EXPECT_LT(MaxError(-3.0f, 3.0f, false, [](auto x) { return simd::ArcTan(x); }, [](double x) { return std::atan(x); }), 3e-7f);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include "network.h"
+#include "default_weight_initializer.h"
+#include "cpu_backend/cpu_compute_backend.h"
+#ifdef MACADEMY_OPENCL_BACKEND
+#include "opencl_backend/opencl_compute_device.h"
+#endif
+#ifdef MACADEMY_VULKAN_BACKEND
+#include "vulkan_backend/vulkan_compute_device.h"
+#endif
+#include "compute_device_factory.h"
+#include "compute_tasks.h"
+#include "inference_server.h"
+
+#include <cmath>
+#include <numeric>
+#include <thread>
+
+using namespace macademy;
+
+class InferenceServerTest : public ::testing::Test
+{
+  public:
+    std::unique_ptr<Network> m_network;
+    ComputeTasks m_compute_tasks;
+
+    InferenceServerTest()
+    {
+        std::vector<LayerConfig> layers;
+        layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::ReLU, .m_num_neurons = 33});
+        layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = 7});
+        m_network = BuildSequentialNetwork("test", 13, std::span<LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
+    }
+
+    std::vector<float> CreateInput(uint32_t id) const
+    {
+        std::vector<float> ret;
+        for (uint32_t i = 0; i < m_network->GetInputCount(); ++i) {
+            ret.emplace_back(std::fmod((id * m_network->GetInputCount() + i) * 1342.3231341f, 2.0f) - 1.0f);
+        }
+        return ret;
+    }
+
+    void TestInferenceServer(const ComputeDeviceInfo& device_info)
+    {
+        // Requests submitted concurrently from multiple threads must return the same results as evaluating them one by one
+        auto compute_device = ComputeDeviceFactory::CreateComputeDevice(device_info);
+        NetworkResourceHandle network_resources(*m_network, *compute_device);
+
+        constexpr uint32_t num_clients = 6;
+        constexpr uint32_t requests_per_client = 50;
+
+        std::vector<std::vector<float>> reference_results;
+        for (uint32_t i = 0; i < num_clients * requests_per_client; ++i) {
+            reference_results.emplace_back(m_compute_tasks.Evaluate(network_resources, CreateInput(i)));
+        }
+
+        InferenceServerConfig config{};
+        config.m_max_batch_size = 8;
+        config.m_max_wait_time = std::chrono::microseconds(500);
+        config.m_worker_count = 2;
+        InferenceServer server(network_resources, config);
+
+        std::vector<std::vector<std::vector<float>>> results(num_clients);
+        std::vector<std::thread> clients;
+        for (uint32_t c = 0; c < num_clients; ++c) {
+            clients.emplace_back([&, c]() {
+                std::vector<std::future<std::vector<float>>> futures;
+                for (uint32_t r = 0; r < requests_per_client; ++r) {
+                    futures.emplace_back(server.Submit(CreateInput(c * requests_per_client + r)));
+                }
+                for (auto& future : futures) {
+                    results[c].emplace_back(future.get());
+                }
+            });
+        }
+        for (auto& client : clients) {
+            client.join();
+        }
+
+        for (uint32_t c = 0; c < num_clients; ++c) {
+            for (uint32_t r = 0; r < requests_per_client; ++r) {
+                const auto& reference = reference_results[c * requests_per_client + r];
+                const auto& result = results[c][r];
+                ASSERT_EQ(reference.size(), result.size());
+                for (size_t i = 0; i < result.size(); ++i) {
+                    EXPECT_NEAR(reference[i], result[i], 1e-5);
+                }
+            }
+        }
+
+        const auto statistics = server.GetStatistics();
+        EXPECT_EQ(statistics.m_request_count, num_clients * requests_per_client);
+        ASSERT_EQ(statistics.m_batch_size_histogram.size(), config.m_max_batch_size + 1);
+        EXPECT_EQ(std::accumulate(statistics.m_batch_size_histogram.begin(), statistics.m_batch_size_histogram.end(), uint64_t(0)), statistics.m_batch_count);
+        uint64_t batched_requests = 0;
+        for (size_t i = 0; i < statistics.m_batch_size_histogram.size(); ++i) {
+            batched_requests += i * statistics.m_batch_size_histogram[i];
+        }
+        EXPECT_EQ(batched_requests, statistics.m_request_count);
+        EXPECT_LE(statistics.m_latency_p50, statistics.m_latency_p99);
+        EXPECT_LE(statistics.m_latency_p99, statistics.m_latency_max);
+    }
+};
+
+TEST_F(InferenceServerTest, CPUInferenceServer) { TestInferenceServer(CPUComputeDevice::GetCpuComputeDeviceInfo()); }
+
+TEST_F(InferenceServerTest, MaxWaitTime)
+{
+    // A single request must not wait for the batch to fill up
+    auto compute_device = ComputeDeviceFactory::CreateComputeDevice(CPUComputeDevice::GetCpuComputeDeviceInfo());
+    NetworkResourceHandle network_resources(*m_network, *compute_device);
+
+    InferenceServerConfig config{};
+    config.m_max_batch_size = 64;
+    config.m_max_wait_time = std::chrono::microseconds(2000);
+    InferenceServer server(network_resources, config);
+
+    auto future = server.Submit(CreateInput(0));
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(future.get().size(), m_network->GetOutputCount());
+
+    const auto statistics = server.GetStatistics();
+    EXPECT_EQ(statistics.m_batch_size_histogram[1], 1);
+
+    EXPECT_THROW(server.Submit(std::vector<float>(3, 0.0f)), std::runtime_error);
+}
+
+#ifdef MACADEMY_OPENCL_BACKEND
+TEST_F(InferenceServerTest, OpenCLInferenceServer)
+{
+    auto devices = OpenCLComputeDevice::GetOpenCLComputeDeviceInfo();
+
+    for (const auto& it : devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestInferenceServer(it);
+    }
+}
+#endif
+
+#ifdef MACADEMY_VULKAN_BACKEND
+TEST_F(InferenceServerTest, VulkanInferenceServer)
+{
+    auto devices = VulkanComputeDevice::GetVulkanComputeDeviceInfo();
+
+    for (const auto& it : devices) {
+        printf("Testing %s\n", it.m_device_name.c_str());
+        TestInferenceServer(it);
+    }
+}
+#endif
@@ -12,6 +12,7 @@
 #endif
 #include "compute_device_factory.h"
 #include "compute_tasks.h"
+#include "training.h"
 #include "utils.h"
 #include <span>
 
@@ -24,7 +25,8 @@ class TrainingTest : public ::testing::Test
 
     TrainingTest() {}
 
-    void RunTrainingTest(const ComputeDeviceInfo& device_info)
+    void RunTrainingTest(const ComputeDeviceInfo& device_info, Optimizer optimizer = Optimizer::SGD, float learning_rate = 0.01f, uint32_t epochs = 20000,
+                         ActivationFunction output_activation = ActivationFunction::Sigmoid, CostFunction cost_function = CostFunction::CrossEntropy_Sigmoid)
     {
         constexpr int input_output_size = 4;
 
@@ -32,7 +34,7 @@ class TrainingTest : public ::testing::Test
 
         std::vector<LayerConfig> layers;
         layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = input_output_size});
-        layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = input_output_size});
+        layers.emplace_back(LayerConfig{.m_activation_function = output_activation, .m_num_neurons = input_output_size});
 
         const auto network = BuildSequentialNetwork("test", input_output_size, std::span<const LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
 
@@ -40,9 +42,10 @@ class TrainingTest : public ::testing::Test
         auto network_resources = std::make_unique<NetworkResourceHandle>(*network, *compute_device);
 
         TrainingSuite ts{};
-        ts.m_cost_function = CostFunction::CrossEntropy_Sigmoid;
-        ts.m_epochs = 20000;
-        ts.m_learning_rate = 0.01f;
+        ts.m_cost_function = cost_function;
+        ts.m_epochs = epochs;
+        ts.m_learning_rate = learning_rate;
+        ts.m_optimizer = optimizer;
         ts.m_mini_batch_size = minibatch_size;
         ts.m_regularization = Regularization::L2;
         ts.m_shuffle_training_data = true;
@@ -64,7 +67,7 @@ class TrainingTest : public ::testing::Test
             ts.m_training_data.push_back(std::move(td));
         }
 
-        network_resources->AllocateTrainingResources(ts.m_mini_batch_size ? *ts.m_mini_batch_size : ts.m_training_data.size());
+        network_resources->AllocateTrainingResources(ts);
         for (int i = 0; i < ts.m_epochs; ++i) {
             int training_data_idx = 0;
             while (training_data_idx < uint32_t(ts.m_training_data.size())) {
@@ -88,10 +91,352 @@ class TrainingTest : public ::testing::Test
             }
         }
     }
+
+    std::vector<std::vector<float>> TrainDeterministic(const ComputeDeviceInfo& device_info, uint64_t seed, uint32_t device_count = 1, std::optional<uint64_t> micro_batch_size = {},
+                                                       bool use_arena = false, Optimizer optimizer = Optimizer::SGD)
+    {
+        constexpr int input_output_size = 4;
+
+        std::vector<LayerConfig> layers;
+        layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = 6});
+        layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = input_output_size});
+
+        auto network = BuildSequentialNetwork("test", input_output_size, std::span<const LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
+
+        std::vector<std::unique_ptr<IComputeDevice>> compute_devices;
+        std::vector<std::unique_ptr<NetworkResourceHandle>> network_resources;
+        std::vector<NetworkResourceHandle*> network_resources_ptrs;
+        for (uint32_t i = 0; i < device_count; ++i) {
+            compute_devices.emplace_back(ComputeDeviceFactory::CreateComputeDevice(device_info));
+            network_resources.emplace_back(std::make_unique<NetworkResourceHandle>(*network, *compute_devices.back(), use_arena));
+            network_resources_ptrs.emplace_back(network_resources.back().get());
+        }
+
+        auto ts = std::make_shared<TrainingSuite>();
+        ts->m_cost_function = CostFunction::CrossEntropy_Sigmoid;
+        ts->m_epochs = 20;
+        ts->m_learning_rate = 0.01f;
+        ts->m_optimizer = optimizer;
+        ts->m_mini_batch_size = 7;
+        ts->m_micro_batch_size = micro_batch_size;
+        ts->m_regularization = Regularization::L2;
+        ts->m_shuffle_training_data = true;
+        ts->m_deterministic = true;
+        ts->m_random_seed = seed;
+
+        for (uint32_t i = 0; i < 100; ++i) {
+            TrainingData td;
+            td.m_input.resize(input_output_size, 0.0f);
+            td.m_desired_output.resize(input_output_size, 0.0f);
+            td.m_input[i % input_output_size] = 1.0f;
+            td.m_desired_output[(i / input_output_size) % input_output_size] = 1.0f;
+            ts->m_training_data.push_back(std::move(td));
+        }
+
+        Training training;
+        auto tracker = training.Train(network_resources_ptrs, ts);
+        tracker->m_future.wait();
+        EXPECT_EQ(tracker->m_epochs_finished, ts->m_epochs);
+
+        std::vector<std::vector<float>> weights;
+        for (const auto& layer : network->GetLayers()) {
+            const auto layer_weights = layer.m_tensor->AsFloat32();
+            weights.emplace_back(layer_weights.begin(), layer_weights.end());
+        }
+        return weights;
+    }
 };
 
+TEST_F(TrainingTest, DeterministicTraining)
+{
+    auto cpu_compute_device_info = CPUComputeDevice::GetCpuComputeDeviceInfo();
+
+    const auto weights_a = TrainDeterministic(cpu_compute_device_info, 42);
+    const auto weights_b = TrainDeterministic(cpu_compute_device_info, 42);
+    const auto weights_c = TrainDeterministic(cpu_compute_device_info, 43);
+
+    ASSERT_EQ(weights_a.size(), weights_b.size());
+    for (size_t i = 0; i < weights_a.size(); ++i) {
+        ASSERT_EQ(weights_a[i].size(), weights_b[i].size());
+        for (size_t j = 0; j < weights_a[i].size(); ++j) {
+            EXPECT_EQ(weights_a[i][j], weights_b[i][j]);
+        }
+    }
+
+    // a different seed shuffles the training data differently
+    EXPECT_NE(weights_a, weights_c);
+}
+
+TEST_F(TrainingTest, DataParallelTraining)
+{
+    auto cpu_compute_device_info = CPUComputeDevice::GetCpuComputeDeviceInfo();
+
+    const auto reference_weights = TrainDeterministic(cpu_compute_device_info, 42);
+    const auto weights_a = TrainDeterministic(cpu_compute_device_info, 42, 2);
+    const auto weights_b = TrainDeterministic(cpu_compute_device_info, 42, 2);
+
+    // The minibatches are split between the devices, only the summation order of the gradients differs from training on a single device
+    ASSERT_EQ(reference_weights.size(), weights_a.size());
+    for (size_t i = 0; i < reference_weights.size(); ++i) {
+        ASSERT_EQ(reference_weights[i].size(), weights_a[i].size());
+        for (size_t j = 0; j < reference_weights[i].size(); ++j) {
+            EXPECT_NEAR(reference_weights[i][j], weights_a[i][j], 1e-4);
+        }
+    }
+
+    // The split is static in deterministic mode
+    EXPECT_EQ(weights_a, weights_b);
+}
+
+TEST_F(TrainingTest, MicroBatchTraining)
+{
+    auto cpu_compute_device_info = CPUComputeDevice::GetCpuComputeDeviceInfo();
+
+    const auto reference_weights = TrainDeterministic(cpu_compute_device_info, 42);
+    const auto weights = TrainDeterministic(cpu_compute_device_info, 42, 1, 3);
+    const auto data_parallel_weights = TrainDeterministic(cpu_compute_device_info, 42, 2, 2);
+
+    // The gradients of the micro-batches are accumulated in the order of the samples, so the minibatch gradient is the same
+    ASSERT_EQ(reference_weights.size(), weights.size());
+    for (size_t i = 0; i < reference_weights.size(); ++i) {
+        ASSERT_EQ(reference_weights[i].size(), weights[i].size());
+        for (size_t j = 0; j < reference_weights[i].size(); ++j) {
+            EXPECT_NEAR(reference_weights[i][j], weights[i][j], 1e-5);
+            EXPECT_NEAR(reference_weights[i][j], data_parallel_weights[i][j], 1e-4);
+        }
+    }
+
+    // Zero batch sizes are rejected when the resources are allocated
+    std::vector<LayerConfig> layers{LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = 2}};
+    auto network = BuildSequentialNetwork("test", 2, std::span<const LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
+    auto compute_device = ComputeDeviceFactory::CreateComputeDevice(cpu_compute_device_info);
+    NetworkResourceHandle network_resources(*network, *compute_device);
+
+    TrainingSuite training_suite;
+    training_suite.m_training_data.emplace_back(TrainingData{.m_input = {0.0f, 1.0f}, .m_desired_output = {1.0f, 0.0f}});
+    training_suite.m_micro_batch_size = 0;
+    EXPECT_THROW(network_resources.AllocateTrainingResources(training_suite), std::runtime_error);
+    training_suite.m_micro_batch_size = {};
+    training_suite.m_mini_batch_size = 0;
+    EXPECT_THROW(network_resources.AllocateTrainingResources(training_suite), std::runtime_error);
+}
+
+TEST_F(TrainingTest, ArenaTraining)
+{
+    auto cpu_compute_device_info = CPUComputeDevice::GetCpuComputeDeviceInfo();
+
+    // The buffers of the layers are views of the arenas, the kernels see the same data as with separate buffers
+    for (Optimizer optimizer : {Optimizer::SGD, Optimizer::Adam}) {
+        const auto reference_weights = TrainDeterministic(cpu_compute_device_info, 42, 1, {}, false, optimizer);
+        const auto weights = TrainDeterministic(cpu_compute_device_info, 42, 1, {}, true, optimizer);
+        const auto micro_batch_weights = TrainDeterministic(cpu_compute_device_info, 42, 1, 3, true, optimizer);
+
+        EXPECT_EQ(reference_weights, weights);
+
+        ASSERT_EQ(reference_weights.size(), micro_batch_weights.size());
+        for (size_t i = 0; i < reference_weights.size(); ++i) {
+            ASSERT_EQ(reference_weights[i].size(), micro_batch_weights[i].size());
+            for (size_t j = 0; j < reference_weights[i].size(); ++j) {
+                EXPECT_NEAR(reference_weights[i][j], micro_batch_weights[i][j], 1e-5);
+            }
+        }
+    }
+}
+
+TEST_F(TrainingTest, SwitchOptimizer)
+{
+    constexpr int input_output_size = 4;
+
+    std::vector<LayerConfig> layers;
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = 6});
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = input_output_size});
+
+    TrainingSuite ts{};
+    ts.m_cost_function = CostFunction::CrossEntropy_Sigmoid;
+    ts.m_learning_rate = 0.01f;
+    ts.m_regularization = Regularization::L2;
+    for (uint32_t i = 0; i < 8; ++i) {
+        TrainingData td;
+        td.m_input.resize(input_output_size, 0.0f);
+        td.m_desired_output.resize(input_output_size, 0.0f);
+        td.m_input[i % input_output_size] = 1.0f;
+        td.m_desired_output[(i / 2) % input_output_size] = 1.0f;
+        ts.m_training_data.push_back(std::move(td));
+    }
+
+    // The handles train on separate devices, so the memory they use can be compared
+    CPUComputeDevice compute_device(nlohmann::json::object());
+    CPUComputeDevice reference_compute_device(nlohmann::json::object());
+
+    const auto train = [&](NetworkResourceHandle& network_resources, Optimizer optimizer, uint32_t steps) {
+        ts.m_optimizer = optimizer;
+        network_resources.AllocateTrainingResources(ts);
+        for (uint32_t i = 0; i < steps; ++i) {
+            m_compute_tasks.TrainMinibatch(network_resources, ts, 0, ts.m_training_data.size());
+        }
+        network_resources.SynchronizeNetworkData();
+    };
+
+    const auto get_weights = [](const Network& network) {
+        std::vector<std::vector<float>> weights;
+        for (const auto& layer : network.GetLayers()) {
+            const auto layer_weights = layer.m_tensor->AsFloat32();
+            weights.emplace_back(layer_weights.begin(), layer_weights.end());
+        }
+        return weights;
+    };
+
+    for (const auto& [first_optimizer, second_optimizer] : {std::pair{Optimizer::Momentum, Optimizer::Adam}, std::pair{Optimizer::Adam, Optimizer::Momentum}}) {
+        auto network = BuildSequentialNetwork("test", input_output_size, std::span<const LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
+        auto reference_network = BuildSequentialNetwork("test", input_output_size, std::span<const LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
+
+        NetworkResourceHandle network_resources(*network, compute_device);
+        train(network_resources, first_optimizer, 5);
+
+        // A fresh handle starts the second optimizer from the same weights, without any optimizer state
+        for (uint32_t i = 0; i < network->GetLayerCount(); ++i) {
+            const auto tensor_data = network->GetLayers()[i].m_tensor->GetRawData();
+            std::copy(tensor_data.begin(), tensor_data.end(), reference_network->GetLayers()[i].m_tensor->GetRawData().begin());
+        }
+        NetworkResourceHandle reference_network_resources(*reference_network, reference_compute_device);
+
+        train(network_resources, second_optimizer, 5);
+        train(reference_network_resources, second_optimizer, 5);
+
+        EXPECT_EQ(get_weights(*network), get_weights(*reference_network));
+
+        // The moments the second optimizer doesn't use are released
+        EXPECT_EQ(compute_device.GetAllocationStatistics().m_bytes_in_use, reference_compute_device.GetAllocationStatistics().m_bytes_in_use);
+    }
+}
+
 TEST_F(TrainingTest, Training)
 {
     auto cpu_compute_device_info = CPUComputeDevice::GetCpuComputeDeviceInfo();
     RunTrainingTest(cpu_compute_device_info);
 }
+
+TEST_F(TrainingTest, TrainingAdam)
+{
+    auto cpu_compute_device_info = CPUComputeDevice::GetCpuComputeDeviceInfo();
+    RunTrainingTest(cpu_compute_device_info, Optimizer::Adam, 0.01f, 100);
+}
+
+TEST_F(TrainingTest, TrainingMomentum)
+{
+    auto cpu_compute_device_info = CPUComputeDevice::GetCpuComputeDeviceInfo();
+    RunTrainingTest(cpu_compute_device_info, Optimizer::Momentum, 0.01f, 2000);
+}
+
+TEST_F(TrainingTest, TrainingSoftmax)
+{
+    auto cpu_compute_device_info = CPUComputeDevice::GetCpuComputeDeviceInfo();
+    RunTrainingTest(cpu_compute_device_info, Optimizer::Adam, 0.01f, 100, ActivationFunction::Softmax, CostFunction::CrossEntropy_Softmax);
+}
+
+TEST_F(TrainingTest, TrainingMemoryPlan)
+{
+    std::vector<LayerConfig> layers;
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = 24});
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = 10});
+
+    const auto network = BuildSequentialNetwork("test", 784, std::span<const LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
+
+    constexpr uint32_t sample_count = 16;
+    const auto plan = CreateTrainingMemoryPlan(*network, sample_count, Optimizer::Adam);
+
+    // The per-sample buffers are sized by the neuron count of the layers, not by their weight count
+    EXPECT_EQ(plan.GetBuffer(TrainingBufferRole::Input).m_size, sample_count * 784 * sizeof(float));
+    EXPECT_EQ(plan.GetBuffer(TrainingBufferRole::DesiredOutput).m_size, sample_count * 10 * sizeof(float));
+    EXPECT_EQ(plan.GetBuffer(TrainingBufferRole::Activations, 0).m_size, sample_count * 24 * sizeof(float));
+    EXPECT_FALSE(plan.HasBuffer(TrainingBufferRole::ZValues, 1)); // the derivative of sigmoid is calculated from the activations
+    EXPECT_EQ(plan.GetBuffer(TrainingBufferRole::DeltaK, 0).m_size, sample_count * 24 * sizeof(float));
+
+    const size_t weights_size = network->GetLayers()[0].m_tensor->GetByteSize() + network->GetLayers()[1].m_tensor->GetByteSize();
+    EXPECT_EQ(plan.m_weights_size, weights_size);
+    EXPECT_EQ(plan.m_optimizer_size, 2 * weights_size);
+
+    EXPECT_LT(plan.GetTransientSize(), plan.GetTransientSizeWithoutReuse());
+
+    // Buffers that are alive at the same time never share a physical buffer
+    for (const auto& a : plan.m_buffers) {
+        for (const auto& b : plan.m_buffers) {
+            if (&a != &b && a.m_physical_buffer_id == b.m_physical_buffer_id) {
+                EXPECT_TRUE(a.m_last_use < b.m_first_use || b.m_last_use < a.m_first_use);
+            }
+        }
+        EXPECT_GE(plan.m_physical_buffer_sizes[a.m_physical_buffer_id], a.m_size);
+    }
+
+    const uint32_t max_sample_count = CalculateMaxTrainingSampleCount(*network, Optimizer::Adam, plan.GetTotalSize());
+    EXPECT_GE(max_sample_count, sample_count);
+    EXPECT_LE(CreateTrainingMemoryPlan(*network, max_sample_count, Optimizer::Adam).GetTotalSize(), plan.GetTotalSize());
+    EXPECT_GT(CreateTrainingMemoryPlan(*network, max_sample_count + 1, Optimizer::Adam).GetTotalSize(), plan.GetTotalSize());
+    EXPECT_EQ(CalculateMaxTrainingSampleCount(*network, Optimizer::Adam, weights_size), 0);
+}
+
+TEST_F(TrainingTest, CheckpointedTraining)
+{
+    constexpr int input_output_size = 8;
+
+    std::vector<LayerConfig> layers;
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Tanh, .m_num_neurons = 16});
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::SoftPlus, .m_num_neurons = 12});
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::ReLU, .m_num_neurons = 4});
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::ArcTan, .m_num_neurons = 12});
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::LeakyReLU, .m_num_neurons = 16});
+    layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = input_output_size});
+
+    const auto network = BuildSequentialNetwork("test", input_output_size, std::span<const LayerConfig>(layers.data(), layers.size()), XavierWeightInitializer{});
+
+    TrainingSuite ts{};
+    ts.m_mini_batch_size = 10;
+    for (uint32_t i = 0; i < 10; ++i) {
+        TrainingData td;
+        td.m_input.resize(input_output_size, 0.0f);
+        td.m_input[i % input_output_size] = 1.0f;
+        td.m_desired_output = td.m_input;
+        ts.m_training_data.push_back(std::move(td));
+    }
+
+    const auto calculate_gradients = [&](std::optional<uint32_t> checkpoint_interval) {
+        ts.m_checkpoint_interval = checkpoint_interval;
+
+        auto compute_device = ComputeDeviceFactory::CreateComputeDevice(CPUComputeDevice::GetCpuComputeDeviceInfo());
+        NetworkResourceHandle network_resources(*network, *compute_device);
+        network_resources.AllocateTrainingResources(ts);
+        m_compute_tasks.CalculateGradients(network_resources, ts, 0, ts.m_training_data.size());
+
+        std::vector<std::vector<float>> gradients;
+        for (uint32_t i = 0; i < network->GetLayerCount(); ++i) {
+            gradients.emplace_back(network->GetLayers()[i].m_tensor->GetElementSize());
+            compute_device->QueueReadFromBuffer(network_resources.m_gradient_buffers[i].get(), ToWriteableUi8Span(gradients.back()), 0);
+        }
+        compute_device->SubmitQueue();
+        compute_device->WaitQueueIdle();
+        return std::make_pair(gradients, network_resources.GetTrainingMemoryPlan().GetTransientSize());
+    };
+
+    const auto [reference_gradients, reference_size] = calculate_gradients({});
+    for (uint32_t checkpoint_interval : {1, 2, 3}) {
+        // The recomputed layers produce the same activations, so the gradients are identical
+        const auto [gradients, size] = calculate_gradients(checkpoint_interval);
+        EXPECT_EQ(gradients, reference_gradients);
+        EXPECT_LE(size, reference_size);
+    }
+
+    // The deep autoencoder of the text model keeps only a fraction of its activations
+    std::vector<LayerConfig> autoencoder_layers;
+    for (uint32_t neuron_count : {1024, 2048, 512, 32, 512, 2048, 1024}) {
+        autoencoder_layers.emplace_back(LayerConfig{.m_activation_function = ActivationFunction::Sigmoid, .m_num_neurons = neuron_count});
+    }
+    const auto autoencoder = BuildSequentialNetwork("autoencoder", 784, std::span<const LayerConfig>(autoencoder_layers.data(), autoencoder_layers.size()), XavierWeightInitializer{});
+
+    const auto plan = CreateTrainingMemoryPlan(*autoencoder, 100, Optimizer::SGD);
+    const auto checkpointed_plan = CreateTrainingMemoryPlan(*autoencoder, 100, Optimizer::SGD, 3);
+    EXPECT_TRUE(checkpointed_plan.IsRecomputedLayer(0));
+    EXPECT_FALSE(checkpointed_plan.IsRecomputedLayer(2));
+    EXPECT_FALSE(checkpointed_plan.IsRecomputedLayer(6));
+    EXPECT_LT(checkpointed_plan.GetTransientSize(), plan.GetTransientSize());
+    EXPECT_GT(CalculateMaxTrainingSampleCount(*autoencoder, Optimizer::SGD, plan.GetTotalSize(), 3), 100);
+}
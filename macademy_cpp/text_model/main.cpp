@@ -80,6 +80,7 @@ class MnistTrainerApp : public ConsoleApp
 
         m_training_suite = std::make_shared<TrainingSuite>();
         m_training_suite->m_mini_batch_size = 100;
+        m_training_suite->m_checkpoint_interval = 3;
         m_training_suite->m_cost_function = CostFunction::CrossEntropy_Sigmoid;
         m_training_suite->m_regularization = Regularization::L2;
         m_training_suite->m_learning_rate = 0.005f;